@@ -0,0 +1,111 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// Thread-safe pool of reusable track or track state container backends.
+///
+/// Containers like @c VectorMultiTrajectory or @c VectorTrackContainer keep
+/// their allocated capacity when they are cleared. Handing out containers from
+/// this pool instead of creating them per event means that, once the pool has
+/// warmed up, filling them does not allocate anymore.
+///
+/// Containers are handed out as shared pointers. When the last reference is
+/// released, the container is cleared and returned to the pool, so it can be
+/// stored in an event store like any other container. Dynamic columns are
+/// kept when a container is reused.
+///
+/// @tparam container_t the mutable container backend, needs to provide
+///         @c clear() and to be constructible from an rvalue of the read-only
+///         backend for @c makeConst
+template <typename container_t>
+class ContainerPool {
+ public:
+  ContainerPool() = default;
+
+  /// Take a container from the pool, or create a new one if the pool is empty.
+  ///
+  /// The container is empty but might still have dynamic columns from earlier
+  /// use. It is returned to the pool when the last reference to it is
+  /// released. The pool itself can be destroyed before that.
+  ///
+  /// @return shared pointer to the container
+  std::shared_ptr<container_t> acquire() {
+    std::unique_ptr<container_t> container;
+    {
+      std::lock_guard<std::mutex> lock{m_state->mutex};
+      if (!m_state->free.empty()) {
+        container = std::move(m_state->free.back());
+        m_state->free.pop_back();
+      }
+    }
+    if (!container) {
+      container = std::make_unique<container_t>();
+    }
+
+    return std::shared_ptr<container_t>(
+        container.release(),
+        [state = std::weak_ptr<State>(m_state)](container_t* ptr) {
+          std::unique_ptr<container_t> owned{ptr};
+          auto s = state.lock();
+          if (!s) {
+            return;
+          }
+          owned->clear();
+          std::lock_guard<std::mutex> lock{s->mutex};
+          s->free.push_back(std::move(owned));
+        });
+  }
+
+  /// Move the content of a container into its read-only counterpart.
+  ///
+  /// The storage is moved back into @p container once the read-only
+  /// container is released, so that the allocated capacity returns to the
+  /// pool together with @p container.
+  ///
+  /// @tparam const_container_t the read-only container backend
+  /// @param container the container to convert, usually from @c acquire()
+  /// @return shared pointer to the read-only container
+  template <typename const_container_t>
+  static std::shared_ptr<const_container_t> makeConst(
+      std::shared_ptr<container_t> container) {
+    auto* ptr = new const_container_t(std::move(*container));
+    return std::shared_ptr<const_container_t>(
+        ptr, [container = std::move(container)](const_container_t* p) mutable {
+          std::unique_ptr<const_container_t> owned{p};
+          std::destroy_at(container.get());
+          std::construct_at(container.get(), std::move(*owned));
+          container.reset();
+        });
+  }
+
+  /// @return number of containers which are currently available for reuse
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock{m_state->mutex};
+    return m_state->free.size();
+  }
+
+ private:
+  struct State {
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<container_t>> free;
+  };
+
+  // shared with the deleters of the handed out containers
+  std::shared_ptr<State> m_state = std::make_shared<State>();
+};
+
+}  // namespace Acts
@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <iterator>
 #include <string_view>
+#include <vector>
 
 namespace Acts {
 
@@ -204,6 +205,57 @@ class TrackContainer {
     m_container->removeTrack_impl(itrack);
   }
 
+  /// Remove the tracks rejected by @p keepTrack and all track states which
+  /// are not part of the remaining tracks
+  ///
+  /// The remaining tracks and track states keep their order and are
+  /// renumbered. Track states shared between tracks, like the common trunk of
+  /// the branches of the combinatorial Kalman filter, are kept once.
+  /// @note Only available if the backends support compaction, e.g.
+  ///       @c VectorTrackContainer and @c VectorMultiTrajectory
+  /// @note This invalidates all track and track state indices and proxies
+  /// @param keepTrack Predicate which is called with every track and returns
+  ///        whether to keep it
+  template <typename track_predicate_t>
+  void compact(const track_predicate_t& keepTrack)
+    requires(!ReadOnly &&
+             requires(track_container_t& c, traj_t& t,
+                      const std::vector<bool>& keep,
+                      const std::vector<IndexType>& indices) {
+               c.compact(keep, indices);
+               t.compact(keep);
+             })
+  {
+    std::vector<bool> keepTracks(size(), false);
+    std::vector<bool> keepTrackStates(m_traj->size(), false);
+    for (IndexType itrack = 0; itrack < size(); ++itrack) {
+      TrackProxy track = getTrack(itrack);
+      if (!keepTrack(track)) {
+        continue;
+      }
+      keepTracks[itrack] = true;
+      // the previous states of an already kept state are kept as well
+      IndexType istate = track.tipIndex();
+      while (istate != kInvalid && !keepTrackStates[istate]) {
+        keepTrackStates[istate] = true;
+        istate = m_traj->getTrackState(istate).previous();
+      }
+    }
+
+    const std::vector<IndexType> newTrackStateIndices =
+        m_traj->compact(keepTrackStates);
+    m_container->compact(keepTracks, newTrackStateIndices);
+  }
+
+  /// Remove all track states which are not part of a track
+  /// @note Only available if the backends support compaction
+  /// @note This invalidates all track state indices and proxies
+  void compact()
+    requires(!ReadOnly)
+  {
+    compact([](const TrackProxy& /*track*/) { return true; });
+  }
+
   /// Get a mutable iterator to the first track in the container
   /// @note Only available if the track container is not read-only
   /// @return a mutable iterator to the first track
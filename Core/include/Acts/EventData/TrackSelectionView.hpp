@@ -0,0 +1,96 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/Iterator.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// Read-only view of a selection of the tracks of a track container
+///
+/// The view refers to the selected tracks by their index and does not copy
+/// any track or track state. It can be used like a read-only track container
+/// to pass the result of a selection, e.g. of an ambiguity resolution, to
+/// consumers which only read the tracks. The tracks are visited in the order
+/// in which they were selected.
+///
+/// @note The view does not own the track container, which has to outlive it
+///       and must not be modified while the view is used
+/// @tparam track_container_t the track container type
+template <typename track_container_t>
+class TrackSelectionView {
+ public:
+  using IndexType = typename track_container_t::IndexType;
+  using ConstTrackProxy = typename track_container_t::ConstTrackProxy;
+
+  using size_type = std::size_t;
+  using const_iterator =
+      ContainerIndexIterator<TrackSelectionView, ConstTrackProxy, true>;
+
+  /// Create an empty selection
+  /// @param tracks the track container to select from
+  explicit TrackSelectionView(const track_container_t& tracks)
+      : m_tracks(&tracks) {}
+
+  /// Create a selection of tracks
+  /// @param tracks the track container to select from
+  /// @param indices the indices of the selected tracks
+  TrackSelectionView(const track_container_t& tracks,
+                     std::vector<IndexType> indices)
+      : m_tracks(&tracks), m_indices(std::move(indices)) {
+    for ([[maybe_unused]] IndexType itrack : m_indices) {
+      assert(itrack < m_tracks->size() && "Track index out of range");
+    }
+  }
+
+  /// Add a track to the selection
+  /// @param itrack the index of the track in the track container
+  void add(IndexType itrack) {
+    assert(itrack < m_tracks->size() && "Track index out of range");
+    m_indices.push_back(itrack);
+  }
+
+  /// @return the number of selected tracks
+  std::size_t size() const { return m_indices.size(); }
+
+  /// @return whether no track is selected
+  bool empty() const { return m_indices.empty(); }
+
+  /// Get a selected track
+  /// @param i the position of the track in the selection
+  /// @return a read-only proxy of the track
+  ConstTrackProxy at(std::size_t i) const {
+    return m_tracks->getTrack(m_indices.at(i));
+  }
+
+  /// Get a selected track
+  /// @param i the position of the track in the selection
+  /// @return a read-only proxy of the track
+  ConstTrackProxy getTrack(std::size_t i) const { return at(i); }
+
+  const_iterator begin() const { return const_iterator{*this, 0}; }
+  const_iterator end() const { return const_iterator{*this, size()}; }
+
+  /// @return the indices of the selected tracks in the track container
+  const std::vector<IndexType>& trackIndices() const { return m_indices; }
+
+  /// @return the track container the tracks are selected from
+  const track_container_t& tracks() const { return *m_tracks; }
+
+ private:
+  const track_container_t* m_tracks;
+  std::vector<IndexType> m_indices;
+};
+
+}  // namespace Acts
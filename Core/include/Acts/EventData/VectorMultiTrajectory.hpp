@@ -344,6 +344,7 @@ class VectorMultiTrajectoryBase {
 }  // namespace detail_vmt
 
 class VectorMultiTrajectory;
+class ConstVectorMultiTrajectory;
 
 template <>
 struct IsReadOnlyMultiTrajectory<VectorMultiTrajectory> : std::false_type {};
@@ -363,6 +364,10 @@ class VectorMultiTrajectory final
   VectorMultiTrajectory(VectorMultiTrajectory&& other)
       : VectorMultiTrajectoryBase{std::move(other)} {}
 
+  /// Take over the storage of a read-only container, e.g. to reuse its
+  /// allocated capacity once it is no longer needed.
+  explicit VectorMultiTrajectory(ConstVectorMultiTrajectory&& other);
+
   Statistics statistics() const {
     return detail_vmt::VectorMultiTrajectoryBase::statistics(*this);
   }
@@ -430,6 +435,19 @@ class VectorMultiTrajectory final
 
   void reserve(std::size_t n);
 
+  /// Remove the track states which are not flagged in @p keep
+  ///
+  /// The remaining track states keep their order and are renumbered, and the
+  /// previous and next indices between them are updated. Components which are
+  /// shared between track states are kept once, the storage of removed track
+  /// states and of components which are not referenced anymore is released.
+  /// Links to removed track states are reset to invalid.
+  ///
+  /// @note This invalidates all track state indices and proxies
+  /// @param keep Flags of the track states to keep, indexed by track state
+  /// @return the new index of every track state, invalid for removed states
+  std::vector<IndexType> compact(const std::vector<bool>& keep);
+
   void shareFrom_impl(IndexType iself, IndexType iother,
                       TrackStatePropMask shareSource,
                       TrackStatePropMask shareTarget);
@@ -457,6 +475,10 @@ class VectorMultiTrajectory final
   template <typename T>
   void addColumn_impl(std::string_view key) {
     HashedString hashedKey = hashString(key);
+    // keep existing columns, e.g. of a container reused after clear()
+    if (m_dynamic.contains(hashedKey)) {
+      return;
+    }
     m_dynamic.insert({hashedKey, std::make_unique<detail::DynamicColumn<T>>()});
   }
 
@@ -503,8 +525,6 @@ static_assert(
     MutableMultiTrajectoryBackend<VectorMultiTrajectory>,
     "VectorMultiTrajectory does not fulfill MutableMultiTrajectoryBackend");
 
-class ConstVectorMultiTrajectory;
-
 template <>
 struct IsReadOnlyMultiTrajectory<ConstVectorMultiTrajectory> : std::true_type {
 };
@@ -586,4 +606,8 @@ static_assert(
     ConstMultiTrajectoryBackend<ConstVectorMultiTrajectory>,
     "ConctVectorMultiTrajectory does not fulfill ConstMultiTrajectoryBackend");
 
+inline VectorMultiTrajectory::VectorMultiTrajectory(
+    ConstVectorMultiTrajectory&& other)
+    : VectorMultiTrajectoryBase{std::move(other)} {}
+
 }  // namespace Acts
@@ -206,6 +206,10 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
 
   VectorTrackContainer(const ConstVectorTrackContainer& other);
 
+  /// Take over the storage of a read-only container, e.g. to reuse its
+  /// allocated capacity once it is no longer needed.
+  explicit VectorTrackContainer(ConstVectorTrackContainer&& other);
+
  public:
   // BEGIN INTERFACE
 
@@ -226,6 +230,10 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
   template <typename T>
   constexpr void addColumn_impl(const std::string_view& key) {
     HashedString hashedKey = hashString(key);
+    // keep existing columns, e.g. of a container reused after clear()
+    if (m_dynamic.contains(hashedKey)) {
+      return;
+    }
     m_dynamic.insert({hashedKey, std::make_unique<detail::DynamicColumn<T>>()});
   }
 
@@ -254,6 +262,15 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
   void reserve(IndexType size);
   void clear();
 
+  /// Remove the tracks which are not flagged in @p keep and renumber the
+  /// track states of the remaining tracks
+  ///
+  /// @param keep Flags of the tracks to keep, indexed by track
+  /// @param newTrackStateIndices The new index of every track state, e.g. as
+  ///        returned by @c VectorMultiTrajectory::compact
+  void compact(const std::vector<bool>& keep,
+               const std::vector<IndexType>& newTrackStateIndices);
+
   void setReferenceSurface_impl(IndexType itrack,
                                 std::shared_ptr<const Surface> surface) {
     m_referenceSurfaces[itrack] = std::move(surface);
@@ -321,4 +338,10 @@ inline VectorTrackContainer::VectorTrackContainer(
   assert(checkConsistency());
 }
 
+inline VectorTrackContainer::VectorTrackContainer(
+    ConstVectorTrackContainer&& other)
+    : VectorTrackContainerBase{std::move(other)} {
+  assert(checkConsistency());
+}
+
 }  // namespace Acts
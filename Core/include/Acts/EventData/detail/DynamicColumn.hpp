@@ -11,10 +11,29 @@
 #include <any>
 #include <cassert>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace Acts::detail {
 
+/// Remove the elements of @p vec which are not flagged in @p keep, keeping
+/// the order of the remaining elements
+template <typename T>
+void compactVector(std::vector<T>& vec, const std::vector<bool>& keep) {
+  assert(vec.size() == keep.size() && "Compaction mask has wrong size");
+  std::size_t n = 0;
+  for (std::size_t i = 0; i < vec.size(); ++i) {
+    if (!keep[i]) {
+      continue;
+    }
+    if (n != i) {
+      vec[n] = std::move(vec[i]);
+    }
+    ++n;
+  }
+  vec.erase(vec.begin() + n, vec.end());
+}
+
 struct DynamicColumnBase {
   virtual ~DynamicColumnBase() = default;
 
@@ -25,6 +44,7 @@ struct DynamicColumnBase {
   virtual void clear() = 0;
   virtual void reserve(std::size_t size) = 0;
   virtual void erase(std::size_t i) = 0;
+  virtual void compact(const std::vector<bool>& keep) = 0;
   virtual std::size_t size() const = 0;
   virtual void copyFrom(std::size_t dstIdx, const DynamicColumnBase& src,
                         std::size_t srcIdx) = 0;
@@ -50,6 +70,9 @@ struct DynamicColumn : public DynamicColumnBase {
   void clear() override { m_vector.clear(); }
   void reserve(std::size_t size) override { m_vector.reserve(size); }
   void erase(std::size_t i) override { m_vector.erase(m_vector.begin() + i); }
+  void compact(const std::vector<bool>& keep) override {
+    compactVector(m_vector, keep);
+  }
   std::size_t size() const override { return m_vector.size(); }
 
   std::unique_ptr<DynamicColumnBase> clone(bool empty) const override {
@@ -97,6 +120,9 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
   void reserve(std::size_t size) override { m_vector.reserve(size); }
   void clear() override { m_vector.clear(); }
   void erase(std::size_t i) override { m_vector.erase(m_vector.begin() + i); }
+  void compact(const std::vector<bool>& keep) override {
+    compactVector(m_vector, keep);
+  }
   std::size_t size() const override { return m_vector.size(); }
 
   std::unique_ptr<DynamicColumnBase> clone(bool empty) const override {
@@ -158,4 +158,56 @@ solenoidFieldMap(std::pair<double, double> rlim, std::pair<double, double> zlim,
                  std::pair<std::size_t, std::size_t> nbins,
                  const SolenoidBField& field);
 
+/// Jacobian of the transformation of a global position onto the (r,z)
+/// coordinates of a cylindrical field map, as used by @c fieldMapRZ and
+/// @c solenoidFieldMap
+///
+/// @param pos global position
+/// @return the derivatives of (r,z) with respect to (x,y,z)
+ActsMatrix<2, 3> transformPosJacobianRZ(const Vector3& pos);
+
+/// Derivative of the transformation of a field (Br,Bz) of a cylindrical field
+/// map onto global coordinates (Bx,By,Bz) with respect to the global position,
+/// as used by @c fieldMapRZ and @c solenoidFieldMap
+///
+/// @param field field (Br,Bz) in cylindrical coordinates
+/// @param pos global position
+/// @return the derivatives of (Bx,By,Bz) with respect to (x,y,z)
+ActsMatrix<3, 3> transformBFieldJacobianRZ(const Vector2& field,
+                                           const Vector3& pos);
+
+/// Create a copy of a field map which stores the field values in single
+/// precision.
+///
+/// This halves the memory footprint of the field grid. The lookup positions,
+/// the interpolation and the returned field values remain in double precision,
+/// the single precision values are converted on the fly whenever a field cell
+/// is created.
+///
+/// @tparam T value type of the input grid, must be an Eigen vector type
+/// @tparam Axes axis types of the input grid
+///
+/// @param fieldMap the double precision field map to convert
+/// @return A field map instance with single precision storage.
+template <typename T, typename... Axes>
+InterpolatedBFieldMap<
+    Grid<Eigen::Matrix<float, T::RowsAtCompileTime, 1>, Axes...>>
+singlePrecisionFieldMap(
+    const InterpolatedBFieldMap<Grid<T, Axes...>>& fieldMap) {
+  using FloatField = Eigen::Matrix<float, T::RowsAtCompileTime, 1>;
+  using FloatFieldMap = InterpolatedBFieldMap<Grid<FloatField, Axes...>>;
+
+  const auto& cfg = fieldMap.config();
+  auto grid = cfg.grid.template convertType<FloatField>();
+  for (std::size_t i = 0; i < grid.size(); ++i) {
+    grid.at(i) = cfg.grid.at(i).template cast<float>();
+  }
+
+  // the field is interpolated and transformed in double precision for both
+  // maps, so the transformations can be shared
+  return FloatFieldMap(typename FloatFieldMap::Config{
+      cfg.transformPos, cfg.transformBField, std::move(grid), cfg.scale,
+      cfg.transformPosJacobian, cfg.transformBFieldJacobian});
+}
+
 }  // namespace Acts
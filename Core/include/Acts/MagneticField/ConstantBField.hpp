@@ -11,6 +11,9 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace Acts {
 
 /// @ingroup MagneticField
@@ -59,6 +62,38 @@ class ConstantBField final : public MagneticFieldProvider {
     return Result<Vector3>::success(m_BField);
   }
 
+  using MagneticFieldProvider::getFields;
+
+  /// @copydoc MagneticFieldProvider::getFields(std::span<const Vector3>,std::span<Vector3>,MagneticFieldProvider::Cache&) const
+  ///
+  /// @note The @p positions are ignored, only their number is used.
+  Result<void> getFields(std::span<const Vector3> positions,
+                         std::span<Vector3> fields,
+                         MagneticFieldProvider::Cache& cache) const override {
+    (void)cache;
+    if (positions.size() != fields.size()) {
+      throw std::invalid_argument(
+          "Number of positions and field values do not match");
+    }
+    std::ranges::fill(fields, m_BField);
+    return Result<void>::success();
+  }
+
+  /// @copydoc MagneticFieldProvider::getFields(std::span<const Vector3>,std::span<Vector3>,std::span<MagneticFieldProvider::Cache* const>) const
+  ///
+  /// @note The @p positions are ignored, only their number is used.
+  Result<void> getFields(
+      std::span<const Vector3> positions, std::span<Vector3> fields,
+      std::span<MagneticFieldProvider::Cache* const> caches) const override {
+    if (positions.size() != fields.size() ||
+        positions.size() != caches.size()) {
+      throw std::invalid_argument(
+          "Number of positions, field values and caches do not match");
+    }
+    std::ranges::fill(fields, m_BField);
+    return Result<void>::success();
+  }
+
   /// @copydoc MagneticFieldProvider::makeCache(const MagneticFieldContext&) const
   Acts::MagneticFieldProvider::Cache makeCache(
       const Acts::MagneticFieldContext& mctx) const override {
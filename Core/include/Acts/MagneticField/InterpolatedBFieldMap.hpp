@@ -16,12 +16,33 @@
 #include "Acts/Utilities/Interpolation.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <array>
 #include <functional>
 #include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace Acts {
 
+namespace detail {
+
+/// Double precision equivalent of the value type of a field map grid
+template <typename T>
+struct DoublePrecisionField {
+  using type = T;
+};
+
+template <typename Scalar, int Rows, int Cols, int Options, int MaxRows,
+          int MaxCols>
+struct DoublePrecisionField<
+    Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>> {
+  using type = Eigen::Matrix<double, Rows, Cols, Options, MaxRows, MaxCols>;
+};
+
+}  // namespace detail
+
 class InterpolatedMagneticField : public MagneticFieldProvider {
  public:
   /// @brief get the number of bins for all axes of the field map
@@ -70,6 +91,12 @@ class InterpolatedMagneticField : public MagneticFieldProvider {
 /// - looking up the magnetic field values on the closest grid points,
 /// - doing a linear interpolation of these magnetic field values.
 ///
+/// The grid values can be stored with reduced precision, e.g. as
+/// @c Eigen::Vector3f instead of @c Acts::Vector3, to reduce the memory
+/// footprint of large field maps. The interpolation and the transformation
+/// into global coordinates are always carried out in double precision, see
+/// @c InterpolatedFieldType.
+///
 /// @tparam grid_t The Grid type which provides the field storage and
 /// interpolation
 template <typename grid_t>
@@ -77,6 +104,10 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
  public:
   using Grid = grid_t;
   using FieldType = typename Grid::value_type;
+  /// Type in which the grid values are interpolated and passed to
+  /// @c Config::transformBField, i.e. @c FieldType in double precision
+  using InterpolatedFieldType =
+      typename detail::DoublePrecisionField<FieldType>::type;
   static constexpr std::size_t DIM_POS = Grid::DIM;
 
   /// @brief struct representing smallest grid unit in magnetic field grid
@@ -98,12 +129,18 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     ///                         each Dimension)
     /// @param [in] fieldValues field values at the hyper box corners sorted in
     ///                         the canonical order defined in Acts::interpolate
+    /// @param [in] localFieldValues field values at the hyper box corners in
+    ///                         grid coordinates, i.e. before they are
+    ///                         transformed by @c Config::transformBField,
+    ///                         in the same order as @p fieldValues
     FieldCell(std::array<double, DIM_POS> lowerLeft,
               std::array<double, DIM_POS> upperRight,
-              std::array<Vector3, N> fieldValues)
+              std::array<Vector3, N> fieldValues,
+              std::array<InterpolatedFieldType, N> localFieldValues)
         : m_lowerLeft(std::move(lowerLeft)),
           m_upperRight(std::move(upperRight)),
-          m_fieldValues(std::move(fieldValues)) {}
+          m_fieldValues(std::move(fieldValues)),
+          m_localFieldValues(std::move(localFieldValues)) {}
 
     /// @brief retrieve field at given position
     ///
@@ -116,6 +153,26 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
       return interpolate(position, m_lowerLeft, m_upperRight, m_fieldValues);
     }
 
+    /// @brief retrieve field and its gradient in grid coordinates
+    ///
+    /// The gradient is obtained analytically from the derivative of the
+    /// multi-linear interpolation with respect to the grid coordinates. Both
+    /// are interpolated from the corner values before the transformation
+    /// into global coordinates, which depends on the position.
+    ///
+    /// @param [in]  position position in grid coordinates
+    /// @param [out] gradient derivative of the field in grid coordinates along
+    ///                       each grid axis
+    /// @return magnetic field value in grid coordinates at the given position
+    ///
+    /// @pre The given @c position must lie within the current field cell.
+    InterpolatedFieldType getFieldGradient(
+        const ActsVector<DIM_POS>& position,
+        std::array<InterpolatedFieldType, DIM_POS>& gradient) const {
+      return interpolateWithGradient(position, m_lowerLeft, m_upperRight,
+                                     m_localFieldValues, gradient);
+    }
+
     /// @brief check whether given 3D position is inside this field cell
     ///
     /// @param [in] position global 3D position
@@ -142,6 +199,10 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     /// @note These values must be order according to the prescription detailed
     ///       in Acts::interpolate.
     std::array<Vector3, N> m_fieldValues;
+
+    /// @brief magnetic field values at the hyper-box corners in grid
+    /// coordinates, in the same order as @c m_fieldValues
+    std::array<InterpolatedFieldType, N> m_localFieldValues;
   };
 
   struct Cache {
@@ -161,7 +222,8 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     /// @brief calculating the global 3D coordinates
     /// (cartesian) of the magnetic field with the local n dimensional field and
     /// the global 3D position as input
-    std::function<Vector3(const FieldType&, const Vector3&)> transformBField;
+    std::function<Vector3(const InterpolatedFieldType&, const Vector3&)>
+        transformBField;
 
     /// @brief grid storing magnetic field values
     Grid grid;
@@ -171,6 +233,26 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     /// @note Negative values for @p scale are accepted and will invert the
     ///       direction of the magnetic field.
     double scale = 1.;
+
+    /// @brief jacobian of @c transformPos, i.e. the derivatives of the grid
+    /// coordinates with respect to the global cartesian coordinates
+    ///
+    /// @note This is only needed for the field gradient. If it is not set,
+    ///       the jacobian is obtained from central finite differences of
+    ///       @c transformPos, which does not require any field lookup.
+    std::function<ActsMatrix<DIM_POS, 3>(const Vector3&)> transformPosJacobian =
+        nullptr;
+
+    /// @brief derivative of @c transformBField with respect to the global
+    /// position for a fixed local field, e.g. of the rotation by phi of a
+    /// field in (r,z) coordinates
+    ///
+    /// @note This is only needed for the field gradient. If it is not set,
+    ///       the derivative is obtained from central finite differences of
+    ///       @c transformBField, which does not require any field lookup.
+    std::function<ActsMatrix<3, 3>(const InterpolatedFieldType&,
+                                   const Vector3&)>
+        transformBFieldJacobian = nullptr;
   };
 
   /// @brief default constructor
@@ -198,6 +280,7 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     // loop through all corner points
     constexpr std::size_t nCorners = 1 << DIM_POS;
     std::array<Vector3, nCorners> neighbors;
+    std::array<InterpolatedFieldType, nCorners> localNeighbors;
     const auto& cornerIndices = m_cfg.grid.closestPointsIndices(gridPosition);
 
     if (!isInsideLocal(gridPosition)) {
@@ -206,12 +289,15 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
 
     std::size_t i = 0;
     for (std::size_t index : cornerIndices) {
-      neighbors.at(i++) = m_cfg.transformBField(m_cfg.grid.at(index), position);
+      localNeighbors.at(i) = toInterpolated(m_cfg.grid.at(index));
+      neighbors.at(i) = m_cfg.transformBField(localNeighbors.at(i), position);
+      ++i;
     }
 
     assert(i == nCorners);
 
-    return FieldCell(lowerLeft, upperRight, std::move(neighbors));
+    return FieldCell(lowerLeft, upperRight, std::move(neighbors),
+                     std::move(localNeighbors));
   }
 
   /// @brief get the number of bins for all axes of the field map
@@ -265,6 +351,11 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
   /// @return grid reference
   const Grid& getGrid() const { return m_cfg.grid; }
 
+  /// @brief Get a const reference on the configuration
+  ///
+  /// @return configuration reference
+  const Config& config() const { return m_cfg; }
+
   /// @copydoc MagneticFieldProvider::makeCache(const MagneticFieldContext&) const
   MagneticFieldProvider::Cache makeCache(
       const MagneticFieldContext& mctx) const final {
@@ -285,43 +376,270 @@ class InterpolatedBFieldMap : public InterpolatedMagneticField {
     }
 
     return Result<Vector3>::success(
-        m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition), position));
+        m_cfg.transformBField(interpolateGrid(gridPosition), position));
   }
 
   Vector3 getFieldUnchecked(const Vector3& position) const final {
     const auto gridPosition = m_cfg.transformPos(position);
-    return m_cfg.transformBField(m_cfg.grid.interpolate(gridPosition),
-                                 position);
+    return m_cfg.transformBField(interpolateGrid(gridPosition), position);
   }
 
   /// @copydoc MagneticFieldProvider::getField(const Vector3&,MagneticFieldProvider::Cache&) const
   Result<Vector3> getField(const Vector3& position,
                            MagneticFieldProvider::Cache& cache) const final {
+    return getCachedField(position, cache.as<Cache>());
+  }
+
+  /// @copydoc MagneticFieldProvider::getFields(std::span<const Vector3>,std::span<Vector3>,MagneticFieldProvider::Cache&) const
+  ///
+  /// @note Every position is looked up like with @c getField and the cache,
+  ///       i.e. the cached field cell is reused as long as consecutive
+  ///       positions are inside of it, so spatially close positions should be
+  ///       passed next to each other.
+  Result<void> getFields(std::span<const Vector3> positions,
+                         std::span<Vector3> fields,
+                         MagneticFieldProvider::Cache& cache) const final {
+    if (positions.size() != fields.size()) {
+      throw std::invalid_argument(
+          "Number of positions and field values do not match");
+    }
     Cache& lcache = cache.as<Cache>();
-    const auto gridPosition = m_cfg.transformPos(position);
-    if (!lcache.fieldCell || !(*lcache.fieldCell).isInside(gridPosition)) {
-      auto res = getFieldCell(position);
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      auto res = getCachedField(positions[i], lcache);
       if (!res.ok()) {
-        return Result<Vector3>::failure(res.error());
+        return res.error();
       }
-      lcache.fieldCell = *res;
+      fields[i] = *res;
     }
-    return Result<Vector3>::success((*lcache.fieldCell).getField(gridPosition));
+    return Result<void>::success();
+  }
+
+  /// @copydoc MagneticFieldProvider::getFields(std::span<const Vector3>,std::span<Vector3>,std::span<MagneticFieldProvider::Cache* const>) const
+  ///
+  /// @note Every position is looked up like with @c getField and its own
+  ///       cache, so the field values are identical to the single lookups.
+  Result<void> getFields(
+      std::span<const Vector3> positions, std::span<Vector3> fields,
+      std::span<MagneticFieldProvider::Cache* const> caches) const final {
+    if (positions.size() != fields.size() ||
+        positions.size() != caches.size()) {
+      throw std::invalid_argument(
+          "Number of positions, field values and caches do not match");
+    }
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      auto res = getCachedField(positions[i], caches[i]->as<Cache>());
+      if (!res.ok()) {
+        return res.error();
+      }
+      fields[i] = *res;
+    }
+    return Result<void>::success();
   }
 
   /// @copydoc MagneticFieldProvider::getFieldGradient(const Vector3&,ActsMatrix<3,3>&,MagneticFieldProvider::Cache&) const
   ///
-  /// @note currently the derivative is not calculated
-  /// @note Cache is not used currently
-  /// @todo return derivative
+  /// @note The field and its derivative along the grid axes are interpolated
+  ///       in grid coordinates from the cached field cell and then
+  ///       transformed into global coordinates at @p position. The gradient
+  ///       is the derivative along the grid axes, mapped with the jacobian of
+  ///       @c transformPos, plus the derivative of @c transformBField with
+  ///       respect to the position. The field transformation must therefore
+  ///       be linear in the field.
   Result<Vector3> getFieldGradient(
       const Vector3& position, ActsMatrix<3, 3>& derivative,
       MagneticFieldProvider::Cache& cache) const final {
-    (void)derivative;
-    return getField(position, cache);
+    Cache& lcache = cache.as<Cache>();
+    const auto gridPosition = m_cfg.transformPos(position);
+    if (auto res = updateFieldCell(lcache, position, gridPosition);
+        !res.ok()) {
+      return Result<Vector3>::failure(res.error());
+    }
+
+    std::array<InterpolatedFieldType, DIM_POS> gridGradient;
+    const InterpolatedFieldType localField =
+        (*lcache.fieldCell).getFieldGradient(gridPosition, gridGradient);
+
+    ActsMatrix<3, DIM_POS> gridDerivative;
+    for (std::size_t k = 0; k < DIM_POS; ++k) {
+      gridDerivative.col(k) = m_cfg.transformBField(gridGradient[k], position);
+    }
+    derivative = gridDerivative * transformPosJacobian(position) +
+                 transformBFieldJacobian(localField, position);
+    return Result<Vector3>::success(
+        m_cfg.transformBField(localField, position));
   }
 
  private:
+  /// @brief multi-linear interpolation and its derivative along the grid axes
+  ///
+  /// @param [in]  position   position in grid coordinates
+  /// @param [in]  lowerLeft  lower-left corner of the confining hyper box
+  /// @param [in]  upperRight upper-right corner of the confining hyper box
+  /// @param [in]  corners    values at the hyper box corners sorted in the
+  ///                         canonical order defined in Acts::interpolate
+  /// @param [out] gradient   derivative of the interpolated value along each
+  ///                         grid axis
+  /// @return interpolated value at @p position
+  template <typename value_t>
+  static value_t interpolateWithGradient(
+      const ActsVector<DIM_POS>& position,
+      const std::array<double, DIM_POS>& lowerLeft,
+      const std::array<double, DIM_POS>& upperRight,
+      const std::array<value_t, (1 << DIM_POS)>& corners,
+      std::array<value_t, DIM_POS>& gradient) {
+    // normalized position inside the cell along every axis
+    std::array<double, DIM_POS> t{};
+    std::array<double, DIM_POS> invWidth{};
+    for (unsigned int d = 0; d < DIM_POS; ++d) {
+      invWidth[d] = 1. / (upperRight[d] - lowerLeft[d]);
+      t[d] = (position[d] - lowerLeft[d]) * invWidth[d];
+    }
+
+    value_t value = 0. * corners[0];
+    gradient.fill(value);
+    for (unsigned int c = 0; c < corners.size(); ++c) {
+      // the left-most bit of the corner number belongs to the first axis,
+      // see Acts::interpolate for the canonical ordering
+      std::array<double, DIM_POS> w{};
+      for (unsigned int d = 0; d < DIM_POS; ++d) {
+        const bool upper = ((c >> (DIM_POS - 1 - d)) & 1u) != 0u;
+        w[d] = upper ? t[d] : 1. - t[d];
+      }
+      double weight = 1.;
+      for (unsigned int d = 0; d < DIM_POS; ++d) {
+        weight *= w[d];
+      }
+      value += weight * corners[c];
+
+      for (unsigned int k = 0; k < DIM_POS; ++k) {
+        const bool upper = ((c >> (DIM_POS - 1 - k)) & 1u) != 0u;
+        double dWeight = upper ? invWidth[k] : -invWidth[k];
+        for (unsigned int d = 0; d < DIM_POS; ++d) {
+          if (d != k) {
+            dWeight *= w[d];
+          }
+        }
+        gradient[k] += dWeight * corners[c];
+      }
+    }
+    return value;
+  }
+
+  /// @brief convert a grid value to the precision of the interpolation
+  ///
+  /// @param [in] value grid value
+  /// @return @p value in double precision
+  static InterpolatedFieldType toInterpolated(const FieldType& value) {
+    if constexpr (std::is_same_v<FieldType, InterpolatedFieldType>) {
+      return value;
+    } else {
+      return value.template cast<double>();
+    }
+  }
+
+  /// @brief interpolate the grid values at the given grid position
+  ///
+  /// Grid values with reduced precision are converted to double precision
+  /// before the interpolation, and the result is kept in double precision.
+  ///
+  /// @param [in] gridPosition position in grid coordinates
+  /// @return interpolated grid value
+  InterpolatedFieldType interpolateGrid(
+      const ActsVector<DIM_POS>& gridPosition) const {
+    if constexpr (std::is_same_v<FieldType, InterpolatedFieldType>) {
+      return m_cfg.grid.interpolate(gridPosition);
+    } else {
+      constexpr std::size_t nCorners = 1 << DIM_POS;
+      std::array<InterpolatedFieldType, nCorners> neighbors;
+      const auto& indices = m_cfg.grid.localBinsFromPosition(gridPosition);
+      std::size_t i = 0;
+      for (std::size_t index : m_cfg.grid.closestPointsIndices(gridPosition)) {
+        neighbors.at(i++) = toInterpolated(m_cfg.grid.at(index));
+      }
+      return interpolate(gridPosition, m_cfg.grid.lowerLeftBinEdge(indices),
+                         m_cfg.grid.upperRightBinEdge(indices), neighbors);
+    }
+  }
+
+  /// @brief retrieve the field from the cached field cell
+  ///
+  /// @param [in] position global 3D position
+  /// @param [in,out] lcache the field map cache
+  /// @return magnetic field value at @p position
+  Result<Vector3> getCachedField(const Vector3& position, Cache& lcache) const {
+    const auto gridPosition = m_cfg.transformPos(position);
+    if (auto res = updateFieldCell(lcache, position, gridPosition);
+        !res.ok()) {
+      return Result<Vector3>::failure(res.error());
+    }
+    return Result<Vector3>::success((*lcache.fieldCell).getField(gridPosition));
+  }
+
+  /// @brief make sure the cached field cell contains the given position
+  ///
+  /// @param [in,out] lcache the field map cache
+  /// @param [in] position global 3D position
+  /// @param [in] gridPosition @p position transformed into grid coordinates
+  /// @return failure if @p position is outside of the field map
+  Result<void> updateFieldCell(Cache& lcache, const Vector3& position,
+                               const ActsVector<DIM_POS>& gridPosition) const {
+    if (!lcache.fieldCell || !(*lcache.fieldCell).isInside(gridPosition)) {
+      auto res = getFieldCell(position);
+      if (!res.ok()) {
+        return res.error();
+      }
+      lcache.fieldCell = *res;
+    }
+    return Result<void>::success();
+  }
+
+  /// @brief jacobian of the mapping from global to grid coordinates
+  ///
+  /// @param [in] position global 3D position
+  /// @return derivatives of the grid coordinates w.r.t. @p position
+  ActsMatrix<DIM_POS, 3> transformPosJacobian(const Vector3& position) const {
+    if (m_cfg.transformPosJacobian) {
+      return m_cfg.transformPosJacobian(position);
+    }
+
+    // step size for the finite differences in internal length units
+    constexpr double h = 1e-4;
+    ActsMatrix<DIM_POS, 3> jacobian;
+    for (unsigned int j = 0; j < 3; ++j) {
+      Vector3 delta = Vector3::Zero();
+      delta[j] = h;
+      jacobian.col(j) = (m_cfg.transformPos(position + delta) -
+                         m_cfg.transformPos(position - delta)) /
+                        (2. * h);
+    }
+    return jacobian;
+  }
+
+  /// @brief derivative of the field transformation w.r.t. the position
+  ///
+  /// @param [in] field local field in grid coordinates
+  /// @param [in] position global 3D position
+  /// @return derivatives of the global field w.r.t. @p position for a fixed
+  ///         local @p field
+  ActsMatrix<3, 3> transformBFieldJacobian(const InterpolatedFieldType& field,
+                                           const Vector3& position) const {
+    if (m_cfg.transformBFieldJacobian) {
+      return m_cfg.transformBFieldJacobian(field, position);
+    }
+
+    // step size for the finite differences in internal length units
+    constexpr double h = 1e-4;
+    ActsMatrix<3, 3> jacobian;
+    for (unsigned int j = 0; j < 3; ++j) {
+      Vector3 delta = Vector3::Zero();
+      delta[j] = h;
+      jacobian.col(j) = (m_cfg.transformBField(field, position + delta) -
+                         m_cfg.transformBField(field, position - delta)) /
+                        (2. * h);
+    }
+    return jacobian;
+  }
+
   Config m_cfg;
 
   typename Grid::point_t m_lowerLeft;
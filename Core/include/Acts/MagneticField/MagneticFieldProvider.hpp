@@ -15,6 +15,8 @@
 
 #include <array>
 #include <memory>
+#include <span>
+#include <stdexcept>
 
 namespace Acts {
 
@@ -56,9 +58,81 @@ class MagneticFieldProvider {
                                            ActsMatrix<3, 3>& derivative,
                                            Cache& cache) const = 0;
 
+  /// Retrieve magnetic field values for a batch of positions. Requires a
+  /// cache object created through makeCache().
+  ///
+  /// The default implementation calls getField() for every position.
+  /// Implementations are encouraged to override this to avoid the per
+  /// position virtual dispatch and to share work between the lookups.
+  ///
+  /// @param [in] positions global 3D positions for the lookup
+  /// @param [out] fields magnetic field vectors at @p positions, must have
+  ///              the same size as @p positions
+  /// @param [in,out] cache Field provider specific cache object
+  ///
+  /// @return failure if any of the lookups failed, in which case the content
+  ///         of @p fields is only valid up to the failing position
+  virtual Result<void> getFields(std::span<const Vector3> positions,
+                                 std::span<Vector3> fields,
+                                 Cache& cache) const;
+
+  /// Retrieve magnetic field values for a batch of positions, each with its
+  /// own cache object created through makeCache().
+  ///
+  /// This is meant for callers which follow several trajectories at once,
+  /// e.g. the components of a multi-component stepper, where one shared cache
+  /// would be invalidated by every other trajectory. The default
+  /// implementation calls getField() for every position with its cache.
+  ///
+  /// @param [in] positions global 3D positions for the lookup
+  /// @param [out] fields magnetic field vectors at @p positions, must have
+  ///              the same size as @p positions
+  /// @param [in,out] caches Field provider specific cache objects, one per
+  ///                 position
+  ///
+  /// @return failure if any of the lookups failed, in which case the content
+  ///         of @p fields is only valid up to the failing position
+  virtual Result<void> getFields(std::span<const Vector3> positions,
+                                 std::span<Vector3> fields,
+                                 std::span<Cache* const> caches) const;
+
   virtual ~MagneticFieldProvider();
 };
 
+inline Result<void> MagneticFieldProvider::getFields(
+    std::span<const Vector3> positions, std::span<Vector3> fields,
+    Cache& cache) const {
+  if (positions.size() != fields.size()) {
+    throw std::invalid_argument(
+        "Number of positions and field values do not match");
+  }
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    auto res = getField(positions[i], cache);
+    if (!res.ok()) {
+      return res.error();
+    }
+    fields[i] = *res;
+  }
+  return Result<void>::success();
+}
+
+inline Result<void> MagneticFieldProvider::getFields(
+    std::span<const Vector3> positions, std::span<Vector3> fields,
+    std::span<Cache* const> caches) const {
+  if (positions.size() != fields.size() || positions.size() != caches.size()) {
+    throw std::invalid_argument(
+        "Number of positions, field values and caches do not match");
+  }
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    auto res = getField(positions[i], *caches[i]);
+    if (!res.ok()) {
+      return res.error();
+    }
+    fields[i] = *res;
+  }
+  return Result<void>::success();
+}
+
 inline MagneticFieldProvider::~MagneticFieldProvider() = default;
 
 }  // namespace Acts
@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <span>
 
 namespace Acts {
 
@@ -119,6 +120,18 @@ class SolenoidBField final : public MagneticFieldProvider {
       const Vector3& position, ActsMatrix<3, 3>& derivative,
       MagneticFieldProvider::Cache& cache) const override;
 
+  using MagneticFieldProvider::getFields;
+
+  /// @copydoc MagneticFieldProvider::getFields(std::span<const Vector3>,std::span<Vector3>,MagneticFieldProvider::Cache&) const
+  Result<void> getFields(std::span<const Vector3> positions,
+                         std::span<Vector3> fields,
+                         MagneticFieldProvider::Cache& cache) const override;
+
+  /// @copydoc MagneticFieldProvider::getFields(std::span<const Vector3>,std::span<Vector3>,std::span<MagneticFieldProvider::Cache* const>) const
+  Result<void> getFields(
+      std::span<const Vector3> positions, std::span<Vector3> fields,
+      std::span<MagneticFieldProvider::Cache* const> caches) const override;
+
  private:
   Config m_cfg;
   double m_scale;
@@ -83,6 +83,28 @@ concept ActorHasAbort =
     ActorHasAbortWithResult<actor_t, propagator_state_t, stepper_t, navigator_t,
                             Args...>;
 
+template <typename actor_t, typename propagator_state_t, typename stepper_t,
+          typename navigator_t, typename... Args>
+concept ActorHasPreStepWithoutResult = requires(
+    const actor_t& a, propagator_state_t& state, const stepper_t& stepper,
+    const navigator_t& navigator, Args&&... args) {
+  {
+    a.preStep(state, stepper, navigator, std::move<Args>(args)...)
+  } -> std::same_as<void>;
+};
+
+template <typename actor_t, typename propagator_state_t, typename stepper_t,
+          typename navigator_t, typename... Args>
+concept ActorHasPreStepWithResult =
+    ActorHasResult<actor_t> &&
+    requires(const actor_t& a, propagator_state_t& state,
+             const stepper_t& stepper, const navigator_t& navigator,
+             typename actor_t::result_type& result, Args&&... args) {
+      {
+        a.preStep(state, stepper, navigator, result, std::move<Args>(args)...)
+      } -> std::same_as<void>;
+    };
+
 template <typename actor_t, typename propagator_state_t, typename stepper_t,
           typename navigator_t, typename... Args>
 concept Actor =
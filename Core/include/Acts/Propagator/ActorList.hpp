@@ -104,6 +104,27 @@ struct ActorList {
     return ActorList<actors_t..., appendices_t...>(std::move(catTuple));
   }
 
+  /// Pre-step call which is broadcast to the members of the list which
+  /// implement it, i.e. after the navigator has set its target and before
+  /// the stepper performs the step
+  ///
+  /// @tparam propagator_state_t is the state type of the propagator
+  /// @tparam stepper_t Type of the stepper used for the propagation
+  /// @tparam navigator_t Type of the navigator used for the propagation
+  ///
+  /// @param [in,out] state This is the propagator state object
+  /// @param [in] stepper The stepper in use
+  /// @param [in] navigator The navigator in use
+  /// @param [in] args The arguments to be passed to the actions
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t, typename... Args>
+  void preStep(propagator_state_t& state, const stepper_t& stepper,
+               const navigator_t& navigator, Args&&... args) const {
+    using impl = detail::actor_list_impl<actors_t...>;
+    impl::preStep(m_actors, state, stepper, navigator,
+                  std::forward<Args>(args)...);
+  }
+
   /// Act call which broadcasts the call to the tuple() members of the list
   ///
   /// @tparam propagator_state_t is the state type of the propagator
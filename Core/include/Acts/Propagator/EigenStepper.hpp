@@ -29,6 +29,7 @@
 
 #include <functional>
 #include <limits>
+#include <span>
 #include <type_traits>
 
 namespace Acts {
@@ -431,6 +432,24 @@ class EigenStepper {
   Result<double> step(propagator_state_t& state,
                       const navigator_t& navigator) const;
 
+  /// Perform a Runge-Kutta step for each of several independent propagations
+  ///
+  /// With the default extension propagations which transport a covariance are
+  /// stepped together in SIMD lanes, see detail::EigenStepperLanes, otherwise
+  /// they are stepped one after the other. Without the transport the lanes
+  /// do not pay off. Every state ends up exactly as after a call to @c step,
+  /// as long as the batched field lookup returns the same values as the single
+  /// lookups with the same caches, which holds for all field providers of
+  /// Acts.
+  ///
+  /// @param [in,out] states the propagation states
+  /// @param [in] navigator the navigator of the propagations
+  /// @param [out] results the step results, one per propagation state
+  template <typename propagator_state_t, typename navigator_t>
+  void stepBatch(std::span<propagator_state_t* const> states,
+                 const navigator_t& navigator,
+                 std::span<Result<double>> results) const;
+
   /// Method that reset the Jacobian to the Identity for when no bound state are
   /// available
   ///
@@ -10,8 +10,14 @@
 #include "Acts/Propagator/ConstrainedStep.hpp"
 #include "Acts/Propagator/EigenStepperError.hpp"
 #include "Acts/Propagator/detail/CovarianceEngine.hpp"
+#include "Acts/Propagator/detail/EigenStepperLanes.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <limits>
+#include <optional>
+#include <utility>
 
 template <typename E>
 Acts::EigenStepper<E>::EigenStepper(
@@ -362,6 +368,54 @@ Acts::Result<double> Acts::EigenStepper<E>::step(
   return h;
 }
 
+template <typename E>
+template <typename propagator_state_t, typename navigator_t>
+void Acts::EigenStepper<E>::stepBatch(
+    std::span<propagator_state_t* const> states, const navigator_t& navigator,
+    std::span<Result<double>> results) const {
+  assert(states.size() == results.size());
+
+  if constexpr (std::is_same_v<E, EigenStepperDefaultExtension>) {
+    // four lanes fill a vector register of doubles with AVX
+    constexpr int kLanes = 4;
+    using Lanes = detail::EigenStepperLanes<kLanes>;
+    using Lane = typename Lanes::template Lane<State>;
+
+    std::array<Lane, kLanes> lanes;
+    std::array<std::optional<Result<double>>, kLanes> laneResults;
+    for (std::size_t begin = 0; begin < states.size(); begin += kLanes) {
+      const std::size_t nLanes =
+          std::min<std::size_t>(kLanes, states.size() - begin);
+      const auto chunk = states.subspan(begin, nLanes);
+      if (std::none_of(chunk.begin(), chunk.end(), [](const auto* state) {
+            return state->stepping.covTransport;
+          })) {
+        for (std::size_t l = 0; l < nLanes; ++l) {
+          results[begin + l] = step(*chunk[l], navigator);
+        }
+        continue;
+      }
+
+      for (std::size_t l = 0; l < nLanes; ++l) {
+        auto& state = *states[begin + l];
+        lanes[l] = Lane(state.stepping, state.options.stepping,
+                        state.options.direction);
+      }
+
+      Lanes::step(*m_bField, std::span<const Lane>(lanes.data(), nLanes),
+                  std::span(laneResults.data(), nLanes));
+
+      for (std::size_t l = 0; l < nLanes; ++l) {
+        results[begin + l] = std::move(*laneResults[l]);
+      }
+    }
+  } else {
+    for (std::size_t i = 0; i < states.size(); ++i) {
+      results[i] = step(*states[i], navigator);
+    }
+  }
+}
+
 template <typename E>
 void Acts::EigenStepper<E>::setIdentityJacobian(State& state) const {
   state.jacobian = BoundMatrix::Identity();
@@ -151,6 +151,7 @@ class MultiEigenStepperLoop : public EigenStepper<extension_t> {
   /// The logger (used if no logger is provided by caller of methods)
   std::unique_ptr<const Acts::Logger> m_logger;
 
+ protected:
   /// Small vector type for speeding up some computations where we need to
   /// accumulate stuff of components. We think 16 is a reasonable amount here.
   template <typename T>
@@ -763,6 +764,20 @@ class MultiEigenStepperLoop : public EigenStepper<extension_t> {
   template <typename propagator_state_t, typename navigator_t>
   Result<double> step(propagator_state_t& state,
                       const navigator_t& navigator) const;
+
+ protected:
+  /// Perform the multi-component step with a given stepping of the components
+  ///
+  /// Handles the step limit after the first component reached a surface,
+  /// removes failed components, reweights and accumulates the path length.
+  ///
+  /// @param [in,out] state is the propagation state
+  /// @param [in] stepComponents is called with a vector of empty results, one
+  /// per component, and has to step all components which are not on a
+  /// surface and store their results at the component index
+  template <typename propagator_state_t, typename step_components_t>
+  Result<double> stepImpl(propagator_state_t& state,
+                          step_components_t&& stepComponents) const;
 };
 
 }  // namespace Acts
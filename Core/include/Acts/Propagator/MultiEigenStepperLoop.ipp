@@ -95,6 +95,32 @@ Result<double> MultiEigenStepperLoop<E, R>::step(
     propagator_state_t& state, const navigator_t& navigator) const {
   using Status = Acts::Intersection3D::Status;
 
+  // Type of the proxy single propagation2 state
+  using ThisSinglePropState =
+      detail::SinglePropState<SingleState, decltype(state.navigation),
+                              decltype(state.options),
+                              decltype(state.geoContext)>;
+
+  return stepImpl(state, [&](auto& results) {
+    auto& components = state.stepping.components;
+    for (std::size_t i = 0; i < components.size(); ++i) {
+      if (components[i].status == Status::onSurface) {
+        continue;
+      }
+
+      ThisSinglePropState single_state(components[i].state, state.navigation,
+                                       state.options, state.geoContext);
+      results[i] = SingleStepper::step(single_state, navigator);
+    }
+  });
+}
+
+template <typename E, typename R>
+template <typename propagator_state_t, typename step_components_t>
+Result<double> MultiEigenStepperLoop<E, R>::stepImpl(
+    propagator_state_t& state, step_components_t&& stepComponents) const {
+  using Status = Acts::Intersection3D::Status;
+
   State& stepping = state.stepping;
   auto& components = stepping.components;
   const Logger& logger = *m_logger;
@@ -147,47 +173,31 @@ Result<double> MultiEigenStepperLoop<E, R>::step(
     reweightNecessary = true;
   }
 
-  // Loop over all components and collect results in vector, write some
-  // summary information to a stringstream
-  SmallVector<std::optional<Result<double>>> results;
+  // Step all components which are not on a surface, the results of the
+  // components on a surface stay empty, so the propagation does not fail if we
+  // have only components on surfaces and failing states
+  SmallVector<std::optional<Result<double>>> results(components.size());
+  stepComponents(results);
+
+  // Accumulate the path length and remove the erroneous components
   double accumulatedPathLength = 0.0;
   std::size_t errorSteps = 0;
-
-  // Type of the proxy single propagation2 state
-  using ThisSinglePropState =
-      detail::SinglePropState<SingleState, decltype(state.navigation),
-                              decltype(state.options),
-                              decltype(state.geoContext)>;
-
-  // Lambda that performs the step for a component and returns false if the step
-  // went ok and true if there was an error
-  auto errorInStep = [&](auto& component) {
-    if (component.status == Status::onSurface) {
-      // We need to add these, so the propagation does not fail if we have only
-      // components on surfaces and failing states
-      results.emplace_back(std::nullopt);
-      return false;
-    }
-
-    ThisSinglePropState single_state(component.state, state.navigation,
-                                     state.options, state.geoContext);
-
-    results.emplace_back(SingleStepper::step(single_state, navigator));
-
-    if (results.back()->ok()) {
-      accumulatedPathLength += component.weight * results.back()->value();
-      return false;
-    } else {
+  std::size_t nKept = 0;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    if (results[i] && !results[i]->ok()) {
       ++errorSteps;
       reweightNecessary = true;
-      return true;
+      continue;
     }
-  };
-
-  // Loop over components and remove errorous components
-  stepping.components.erase(
-      std::remove_if(components.begin(), components.end(), errorInStep),
-      components.end());
+    if (results[i]) {
+      accumulatedPathLength += components[i].weight * results[i]->value();
+    }
+    if (nKept != i) {
+      components[nKept] = std::move(components[i]);
+    }
+    ++nKept;
+  }
+  components.erase(components.begin() + nKept, components.end());
 
   // Reweight if necessary
   if (reweightNecessary) {
@@ -0,0 +1,88 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Propagator/EigenStepperDefaultExtension.hpp"
+#include "Acts/Propagator/MultiEigenStepperLoop.hpp"
+#include "Acts/Propagator/detail/EigenStepperLanes.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <cstddef>
+#include <optional>
+
+namespace Acts {
+
+/// @brief Multi-component stepper which steps the components in SIMD lanes
+///
+/// This stepper manages the components exactly like the MultiEigenStepperLoop,
+/// but instead of stepping each component with the single-component
+/// EigenStepper, it steps batches of @p kLanes components together with
+/// detail::EigenStepperLanes. The arithmetic of the Runge-Kutta integration and
+/// of the transport matrix is vectorized across the components of a batch, and
+/// the magnetic field of a batch is retrieved with a single call to
+/// MagneticFieldProvider::getFields, where every lane uses the field cache of
+/// its own component.
+///
+/// The result for a component is identical to the one of the
+/// MultiEigenStepperLoop as long as the batched field lookup returns the same
+/// values as the single one with the same caches, which is the case for all
+/// field providers of Acts.
+///
+/// @note Only the default extension of the EigenStepper is supported
+/// @tparam component_reducer_t How to map the multi-component state to a single
+/// component
+/// @tparam kLanes the number of components which are stepped together
+template <typename component_reducer_t = MaxWeightReducerLoop, int kLanes = 4>
+class MultiEigenStepperSIMD
+    : public MultiEigenStepperLoop<EigenStepperDefaultExtension,
+                                   component_reducer_t> {
+  static_assert(kLanes > 0, "The number of lanes must be positive");
+
+ public:
+  using Base =
+      MultiEigenStepperLoop<EigenStepperDefaultExtension, component_reducer_t>;
+
+  using SingleStepper = typename Base::SingleStepper;
+  using SingleState = typename Base::SingleState;
+  using State = typename Base::State;
+
+  using Base::Base;
+
+  /// Perform a Runge-Kutta track parameter propagation step for all
+  /// components which are not on a surface
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  /// parameters that are being propagated.
+  /// @param [in] navigator is the navigator of the propagation
+  ///
+  /// The state contains the desired step size. It can be negative during
+  /// backwards track propagation, and since we're using an adaptive
+  /// algorithm, it can be modified by the stepper class during propagation.
+  template <typename propagator_state_t, typename navigator_t>
+  Result<double> step(propagator_state_t& state,
+                      const navigator_t& navigator) const;
+
+ private:
+  template <typename T>
+  using SmallVector = typename Base::template SmallVector<T>;
+
+  /// Step a batch of components
+  ///
+  /// @param [in,out] state is the propagation state
+  /// @param [in] indices are the indices of the at most @p kLanes components
+  /// @param [out] results are the step results of all components
+  template <typename propagator_state_t>
+  void stepBatch(propagator_state_t& state,
+                 const SmallVector<std::size_t>& indices,
+                 SmallVector<std::optional<Result<double>>>& results) const;
+};
+
+}  // namespace Acts
+
+#include "MultiEigenStepperSIMD.ipp"
@@ -0,0 +1,73 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/Intersection.hpp"
+
+#include <array>
+#include <cassert>
+#include <optional>
+#include <span>
+#include <utility>
+
+namespace Acts {
+
+template <typename R, int kLanes>
+template <typename propagator_state_t, typename navigator_t>
+Result<double> MultiEigenStepperSIMD<R, kLanes>::step(
+    propagator_state_t& state, const navigator_t& /*navigator*/) const {
+  using Status = Acts::Intersection3D::Status;
+
+  return Base::stepImpl(state, [&](auto& results) {
+    const auto& components = state.stepping.components;
+
+    SmallVector<std::size_t> batch;
+    for (std::size_t i = 0; i < components.size(); ++i) {
+      if (components[i].status == Status::onSurface) {
+        continue;
+      }
+      batch.push_back(i);
+      if (batch.size() == static_cast<std::size_t>(kLanes)) {
+        stepBatch(state, batch, results);
+        batch.clear();
+      }
+    }
+    if (!batch.empty()) {
+      stepBatch(state, batch, results);
+    }
+  });
+}
+
+template <typename R, int kLanes>
+template <typename propagator_state_t>
+void MultiEigenStepperSIMD<R, kLanes>::stepBatch(
+    propagator_state_t& state, const SmallVector<std::size_t>& indices,
+    SmallVector<std::optional<Result<double>>>& results) const {
+  assert(!indices.empty() && indices.size() <= kLanes);
+
+  using Lane = typename detail::EigenStepperLanes<kLanes>::template Lane<
+      SingleState>;
+
+  // All components are stepped with the options of the multi-component state
+  std::array<Lane, kLanes> lanes;
+  std::array<std::optional<Result<double>>, kLanes> laneResults;
+  for (std::size_t l = 0; l < indices.size(); ++l) {
+    lanes[l] = Lane(state.stepping.components[indices[l]].state,
+                    state.options.stepping, state.options.direction);
+  }
+
+  detail::EigenStepperLanes<kLanes>::step(
+      *SingleStepper::m_bField,
+      std::span<const Lane>(lanes.data(), indices.size()),
+      std::span(laneResults.data(), indices.size()));
+
+  for (std::size_t l = 0; l < indices.size(); ++l) {
+    results[indices[l]] = std::move(laneResults[l]);
+  }
+}
+
+}  // namespace Acts
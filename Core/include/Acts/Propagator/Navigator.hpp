@@ -15,12 +15,17 @@
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
 #include "Acts/Propagator/NavigatorOptions.hpp"
+#include "Acts/Propagator/detail/NavigationCandidateCache.hpp"
 #include "Acts/Surfaces/BoundaryTolerance.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/StringHelpers.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -109,6 +114,34 @@ class Navigator {
     bool resolveMaterial = true;
     /// stop at every surface regardless what it is
     bool resolvePassive = false;
+
+    /// Reuse the layer and boundary candidates which earlier propagations in
+    /// the same thread found when searching a volume from a similar position
+    /// in a similar direction. The cached candidates are intersected again
+    /// with the current position, direction and path limit. A candidate can
+    /// only be missed if it is compatible with this track but not with the
+    /// one which filled the cache, i.e. close to the edge of a layer.
+    bool cacheCandidates = false;
+    /// Size of the position bins which share cached candidates
+    double candidateCachePositionBinSize = 10 * UnitConstants::mm;
+    /// Size of the eta bins of directions which share cached candidates
+    double candidateCacheEtaBinSize = 0.05;
+    /// Size of the phi bins of directions which share cached candidates
+    double candidateCachePhiBinSize = 0.05;
+  };
+
+  /// Counters which are filled during the navigation
+  struct Statistics {
+    /// Number of volume searches served by the candidate cache
+    std::size_t nCandidateCacheHits = 0;
+    /// Number of volume searches which could not be served by the cache
+    std::size_t nCandidateCacheMisses = 0;
+
+    /// @return the fraction of volume searches served by the candidate cache
+    double candidateCacheHitRate() const {
+      const std::size_t n = nCandidateCacheHits + nCandidateCacheMisses;
+      return n > 0 ? static_cast<double>(nCandidateCacheHits) / n : 0.;
+    }
   };
 
   struct Options : public NavigatorPlainOptions {
@@ -179,6 +212,9 @@ class Navigator {
     // The navigation stage (@todo: integrate break, target)
     Stage navigationStage = Stage::undefined;
 
+    /// Navigation statistics of this propagation
+    Statistics statistics;
+
     void reset() {
       navSurfaces.clear();
       navSurfaceIndex = navSurfaces.size();
@@ -202,7 +238,11 @@ class Navigator {
   explicit Navigator(Config cfg,
                      std::shared_ptr<const Logger> _logger =
                          getDefaultLogger("Navigator", Logging::Level::INFO))
-      : m_cfg{std::move(cfg)}, m_logger{std::move(_logger)} {}
+      : m_cfg{std::move(cfg)}, m_logger{std::move(_logger)} {
+    if (m_cfg.cacheCandidates) {
+      m_candidateCacheId = detail::NavigationCandidateCache::makeOwnerId();
+    }
+  }
 
   State makeState(const Options& options) const {
     assert(options.startSurface != nullptr && "Start surface must be set");
@@ -884,12 +924,49 @@ class Navigator {
                    << stepper.position(state.stepping).transpose() << ", dir: "
                    << stepper.direction(state.stepping).transpose());
 
-      // Evaluate the boundary surfaces
-      state.navigation.navBoundaries =
-          state.navigation.currentVolume->compatibleBoundaries(
-              state.geoContext, stepper.position(state.stepping),
-              state.options.direction * stepper.direction(state.stepping),
-              navOpts, logger());
+      const Vector3 position = stepper.position(state.stepping);
+      const Vector3 direction =
+          state.options.direction * stepper.direction(state.stepping);
+
+      // Try the boundaries found by earlier propagations first
+      state.navigation.navBoundaries.clear();
+      detail::NavigationCandidateCache::Key cacheKey;
+      if (m_cfg.cacheCandidates) {
+        cacheKey = candidateCacheKey(state.navigation.currentVolume,
+                                     navOpts.startObject, navOpts.endObject,
+                                     position, direction);
+        const auto* boundaries =
+            detail::NavigationCandidateCache::local().findBoundaries(cacheKey);
+        if (boundaries != nullptr) {
+          for (const BoundarySurface* boundary : *boundaries) {
+            auto intersection = intersectBoundary(state.geoContext, position,
+                                                  direction, navOpts, boundary);
+            if (intersection.first.isValid()) {
+              state.navigation.navBoundaries.push_back(intersection);
+            }
+          }
+        }
+      }
+      if (!state.navigation.navBoundaries.empty()) {
+        ++state.navigation.statistics.nCandidateCacheHits;
+      } else if (!m_cfg.cacheCandidates) {
+        // Evaluate the boundary surfaces
+        state.navigation.navBoundaries =
+            state.navigation.currentVolume->compatibleBoundaries(
+                state.geoContext, position, direction, navOpts, logger());
+      } else {
+        // Cache the boundaries without the path limit of this propagation
+        ++state.navigation.statistics.nCandidateCacheMisses;
+        NavigationOptions<Surface> unlimitedOpts = navOpts;
+        unlimitedOpts.farLimit = std::numeric_limits<double>::max();
+        state.navigation.navBoundaries =
+            state.navigation.currentVolume->compatibleBoundaries(
+                state.geoContext, position, direction, unlimitedOpts,
+                logger());
+        detail::NavigationCandidateCache::local().insertBoundaries(
+            cacheKey, state.navigation.navBoundaries);
+        applyFarLimit(state.navigation.navBoundaries, navOpts.farLimit);
+      }
       std::ranges::sort(
           state.navigation.navBoundaries, [](const auto& a, const auto& b) {
             return SurfaceIntersection::pathLengthOrder(a.first, b.first);
@@ -1072,12 +1149,56 @@ class Navigator {
     navOpts.farLimit =
         stepper.getStepSize(state.stepping, ConstrainedStep::aborter);
 
-    // Request the compatible layers
-    state.navigation.navLayers =
-        state.navigation.currentVolume->compatibleLayers(
-            state.geoContext, stepper.position(state.stepping),
-            state.options.direction * stepper.direction(state.stepping),
-            navOpts);
+    const Vector3 position = stepper.position(state.stepping);
+    const Vector3 direction =
+        state.options.direction * stepper.direction(state.stepping);
+
+    // Try the layers found by earlier propagations first
+    state.navigation.navLayers.clear();
+    detail::NavigationCandidateCache::Key cacheKey;
+    if (m_cfg.cacheCandidates) {
+      cacheKey = candidateCacheKey(state.navigation.currentVolume,
+                                   navOpts.startObject, navOpts.endObject,
+                                   position, direction);
+      const auto* layers =
+          detail::NavigationCandidateCache::local().findLayers(cacheKey);
+      if (layers != nullptr) {
+        for (const Layer* layer : *layers) {
+          auto intersection = layer->surfaceOnApproach(
+              state.geoContext, position, direction, navOpts);
+          if (intersection.isValid()) {
+            state.navigation.navLayers.emplace_back(intersection, layer);
+          }
+        }
+        // Discard far intersection solutions in the same way as
+        // TrackingVolume::compatibleLayers does
+        auto& navLayers = state.navigation.navLayers;
+        auto min = std::ranges::min_element(
+            navLayers, [](const auto& a, const auto& b) {
+              return a.first.pathLength() < b.first.pathLength();
+            });
+        navLayers.erase(navLayers.begin(), min);
+      }
+    }
+    if (!state.navigation.navLayers.empty()) {
+      ++state.navigation.statistics.nCandidateCacheHits;
+    } else if (!m_cfg.cacheCandidates) {
+      // Request the compatible layers
+      state.navigation.navLayers =
+          state.navigation.currentVolume->compatibleLayers(
+              state.geoContext, position, direction, navOpts);
+    } else {
+      // Cache the layers without the path limit of this propagation
+      ++state.navigation.statistics.nCandidateCacheMisses;
+      NavigationOptions<Layer> unlimitedOpts = navOpts;
+      unlimitedOpts.farLimit = std::numeric_limits<double>::max();
+      state.navigation.navLayers =
+          state.navigation.currentVolume->compatibleLayers(
+              state.geoContext, position, direction, unlimitedOpts);
+      detail::NavigationCandidateCache::local().insertLayers(
+          cacheKey, state.navigation.navLayers);
+      applyFarLimit(state.navigation.navLayers, navOpts.farLimit);
+    }
     std::ranges::sort(
         state.navigation.navLayers, [](const auto& a, const auto& b) {
           return SurfaceIntersection::pathLengthOrder(a.first, b.first);
@@ -1173,6 +1294,63 @@ class Navigator {
   }
 
  private:
+  /// Key of the cached candidates for a search in @p volume
+  detail::NavigationCandidateCache::Key candidateCacheKey(
+      const TrackingVolume* volume, const void* start, const void* end,
+      const Vector3& position, const Vector3& direction) const {
+    auto bin = [](double value, double binSize) {
+      return static_cast<std::int32_t>(std::floor(value / binSize));
+    };
+    // directions along the z axis end up in the outermost eta bins
+    constexpr double maxEta = 10.;
+    const double eta =
+        std::clamp(VectorHelpers::eta(direction), -maxEta, maxEta);
+    const double phi = VectorHelpers::phi(direction);
+    const double positionBinSize = m_cfg.candidateCachePositionBinSize;
+    return {m_candidateCacheId,
+            volume,
+            start,
+            end,
+            {bin(position.x(), positionBinSize),
+             bin(position.y(), positionBinSize),
+             bin(position.z(), positionBinSize)},
+            bin(eta, m_cfg.candidateCacheEtaBinSize),
+            bin(phi, m_cfg.candidateCachePhiBinSize)};
+  }
+
+  /// Remove the candidates which are found by a search without path limit
+  /// but are beyond @p farLimit
+  template <typename intersections_t>
+  static void applyFarLimit(intersections_t& intersections, double farLimit) {
+    auto beyond = std::ranges::remove_if(intersections, [&](const auto& i) {
+      return !detail::checkPathLength(i.first.pathLength(),
+                                      std::numeric_limits<double>::lowest(),
+                                      farLimit);
+    });
+    intersections.erase(beyond.begin(), beyond.end());
+  }
+
+  /// Intersect a cached boundary in the same way as
+  /// @c TrackingVolume::compatibleBoundaries does
+  BoundaryIntersection intersectBoundary(
+      const GeometryContext& gctx, const Vector3& position,
+      const Vector3& direction, const NavigationOptions<Surface>& navOpts,
+      const BoundarySurface* boundary) const {
+    const Surface& surface = boundary->surfaceRepresentation();
+    if (&surface != navOpts.startObject) {
+      auto candidates = surface.intersect(gctx, position, direction,
+                                          navOpts.boundaryTolerance);
+      for (const auto& intersection : candidates.split()) {
+        if (intersection.isValid() &&
+            detail::checkPathLength(intersection.pathLength(),
+                                    navOpts.nearLimit, navOpts.farLimit)) {
+          return {intersection, boundary};
+        }
+      }
+    }
+    return {SurfaceIntersection::invalid(), nullptr};
+  }
+
   template <typename propagator_state_t>
   std::string volInfo(const propagator_state_t& state) const {
     return (state.navigation.currentVolume != nullptr
@@ -1185,6 +1363,9 @@ class Navigator {
 
   Config m_cfg;
 
+  /// Identifies the entries of this navigator in the candidate cache
+  std::uint64_t m_candidateCacheId = 0;
+
   std::shared_ptr<const Logger> m_logger;
 };
 
@@ -0,0 +1,261 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/PropagatorState.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+namespace Acts {
+
+/// @brief Step statistics of many propagations, aggregated per volume
+///
+/// This is filled by the @c PropagationProfiler actor and shows where the
+/// propagation time goes: which constraint limits the steps, how often the
+/// navigator has to target a surface again because a step did not reach it,
+/// and how much time is spent stepping in each volume.
+///
+/// Merging is thread-safe, one profile can be shared by all propagations of
+/// a job.
+class PropagationProfile {
+ public:
+  /// What determined the size of a step
+  enum class StepLimit : std::uint8_t {
+    /// Navigation or an actor, see @c ConstrainedStep::actor
+    actor = ConstrainedStep::actor,
+    /// Target or path limit, see @c ConstrainedStep::aborter
+    aborter = ConstrainedStep::aborter,
+    /// User given maximum step size, see @c ConstrainedStep::user
+    user = ConstrainedStep::user,
+    /// Step size estimate of the stepper
+    accuracy,
+    /// Reduced by the error control of the stepper during the step
+    errorControl,
+  };
+
+  static constexpr std::size_t s_nStepLimits = 5;
+
+  /// @return a printable name of @p limit
+  static std::string_view name(StepLimit limit);
+
+  /// Step statistics of a single volume
+  struct VolumeCost {
+    /// Number of steps
+    std::size_t steps = 0;
+    /// Number of steps which were limited by the navigation, but did not
+    /// reach a surface, so that the navigator had to target it again
+    std::size_t retargets = 0;
+    /// Path length of all steps
+    double pathLength = 0;
+    /// Time spent in the stepper and in the navigator after the steps
+    std::chrono::duration<double, std::nano> time{0};
+    /// Number of steps per limit, indexed by @c StepLimit
+    std::array<std::size_t, s_nStepLimits> limits = {};
+
+    /// @return the number of steps with the given limit
+    std::size_t& limit(StepLimit stepLimit) {
+      return limits[static_cast<std::size_t>(stepLimit)];
+    }
+
+    /// @return the number of steps with the given limit
+    std::size_t limit(StepLimit stepLimit) const {
+      return limits[static_cast<std::size_t>(stepLimit)];
+    }
+
+    VolumeCost& operator+=(const VolumeCost& other);
+  };
+
+  /// Statistics of a single propagation, which usually crosses few volumes
+  using VolumeCosts =
+      boost::container::small_vector<std::pair<GeometryIdentifier, VolumeCost>,
+                                     8>;
+
+  /// Add the statistics of one propagation
+  ///
+  /// @param costs The statistics of the propagation per volume
+  void merge(const VolumeCosts& costs);
+
+  /// @return the number of merged propagations
+  std::size_t propagations() const;
+
+  /// @return the statistics of all volumes, sorted by decreasing time
+  std::vector<std::pair<GeometryIdentifier, VolumeCost>> volumes() const;
+
+  /// @return the sum of the statistics of all volumes
+  VolumeCost total() const;
+
+  /// Remove all statistics
+  void clear();
+
+  /// Print the per volume cost table
+  ///
+  /// @param os The output stream
+  std::ostream& toStream(std::ostream& os) const;
+
+ private:
+  mutable std::mutex m_mutex;
+  std::size_t m_propagations = 0;
+  std::unordered_map<GeometryIdentifier, VolumeCost> m_volumes;
+};
+
+std::ostream& operator<<(std::ostream& os, const PropagationProfile& profile);
+
+/// @brief Actor which profiles the steps of a propagation
+///
+/// Records which constraint limits every step, whether a step which was
+/// limited by the navigation reached its surface, and the time and path
+/// length per volume. The statistics of the propagation are merged into the
+/// configured @c PropagationProfile at its end. Propagations which fail
+/// because of a stepper error are not merged.
+///
+/// The profiler does nothing if no profile is set. Propagations without this
+/// actor are not affected at all.
+struct PropagationProfiler {
+  using Clock = std::chrono::steady_clock;
+
+  struct this_result {
+    /// Statistics of this propagation
+    PropagationProfile::VolumeCosts volumes;
+    /// Step size constraints before the current step
+    ConstrainedStep stepSize;
+    /// Path length before the current step
+    double pathLength = 0;
+    /// Volume of the current step
+    GeometryIdentifier volume;
+    /// Start time of the current step
+    Clock::time_point start;
+    /// Whether the statistics have already been merged
+    bool merged = false;
+  };
+
+  using result_type = this_result;
+
+  /// The profile to merge into, nothing is recorded if not set
+  PropagationProfile* profile = nullptr;
+
+  /// Relative difference of the performed and the allowed step size above
+  /// which a step counts as reduced by the error control of the stepper
+  double errorControlTolerance = 1e-6;
+
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t>
+  void preStep(propagator_state_t& state, const stepper_t& /*stepper*/,
+               const navigator_t& navigator, result_type& result,
+               const Logger& /*logger*/) const {
+    if (profile == nullptr) {
+      return;
+    }
+
+    result.stepSize = state.stepping.stepSize;
+    result.pathLength = state.pathLength;
+    const auto* volume = navigator.currentVolume(state.navigation);
+    result.volume =
+        volume != nullptr ? volume->geometryId() : GeometryIdentifier();
+    result.start = Clock::now();
+  }
+
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t>
+  void act(propagator_state_t& state, const stepper_t& /*stepper*/,
+           const navigator_t& navigator, result_type& result,
+           const Logger& /*logger*/) const {
+    if (profile == nullptr) {
+      return;
+    }
+
+    if (state.stage == PropagatorStage::postPropagation) {
+      merge(result);
+      return;
+    }
+    if (state.stage != PropagatorStage::postStep) {
+      return;
+    }
+
+    const auto time = Clock::now() - result.start;
+
+    PropagationProfile::VolumeCost& cost = find(result.volumes, result.volume);
+    const double stepLength = std::abs(state.pathLength - result.pathLength);
+    const PropagationProfile::StepLimit stepLimit =
+        limit(result.stepSize, stepLength);
+    ++cost.steps;
+    ++cost.limit(stepLimit);
+    if (stepLimit == PropagationProfile::StepLimit::actor &&
+        navigator.currentSurface(state.navigation) == nullptr) {
+      ++cost.retargets;
+    }
+    cost.pathLength += stepLength;
+    cost.time += time;
+
+    // the propagation fails after this step if it is not aborted, in which
+    // case there is no post propagation call
+    if (state.steps + 1 >= state.options.maxSteps) {
+      merge(result);
+    }
+  }
+
+ private:
+  static PropagationProfile::VolumeCost& find(
+      PropagationProfile::VolumeCosts& volumes, GeometryIdentifier volume) {
+    for (auto& [id, cost] : volumes) {
+      if (id == volume) {
+        return cost;
+      }
+    }
+    return volumes.emplace_back(volume, PropagationProfile::VolumeCost())
+        .second;
+  }
+
+  PropagationProfile::StepLimit limit(const ConstrainedStep& stepSize,
+                                      double stepLength) const {
+    using enum PropagationProfile::StepLimit;
+
+    // same precedence as in ConstrainedStep::value()
+    PropagationProfile::StepLimit stepLimit = actor;
+    for (auto type : {ConstrainedStep::aborter, ConstrainedStep::user}) {
+      if (stepSize.value(type) <
+          stepSize.value(static_cast<ConstrainedStep::Type>(stepLimit))) {
+        stepLimit = static_cast<PropagationProfile::StepLimit>(type);
+      }
+    }
+    if (std::abs(stepSize.value(static_cast<ConstrainedStep::Type>(
+            stepLimit))) >= stepSize.accuracy()) {
+      stepLimit = accuracy;
+    }
+
+    const double allowed = std::abs(stepSize.value());
+    if (stepLength < allowed * (1 - errorControlTolerance)) {
+      stepLimit = errorControl;
+    }
+    return stepLimit;
+  }
+
+  void merge(result_type& result) const {
+    if (!result.merged) {
+      profile->merge(result.volumes);
+      result.merged = true;
+    }
+  }
+};
+
+}  // namespace Acts
@@ -33,6 +33,7 @@
 #include "Acts/Utilities/Result.hpp"
 
 #include <optional>
+#include <vector>
 
 namespace Acts {
 
@@ -341,6 +342,57 @@ class Propagator final
   template <typename propagator_state_t>
   Result<void> propagate(propagator_state_t& state) const;
 
+  /// @brief Propagate a bundle of propagator states in lock-step
+  ///
+  /// The states are advanced by one step each per iteration, until all of
+  /// them have finished. A state drops out of the bundle as soon as an abort
+  /// condition is fulfilled, the maximum number of steps is reached or a step
+  /// fails, while the others continue. Every state ends up exactly as after a
+  /// call to @c propagate(state), as long as the batched field lookup of the
+  /// stepper returns the same values as the single lookups with the same
+  /// caches. This holds for all field providers of Acts, including the
+  /// interpolated field maps; a custom provider which overrides
+  /// MagneticFieldProvider::getFields with a different approximation only
+  /// yields close results.
+  ///
+  /// If the stepper provides a @c stepBatch method, like the EigenStepper
+  /// with its default extension, the Runge-Kutta steps of all states of an
+  /// iteration are done in a single call, which steps them together in SIMD
+  /// lanes. Otherwise the states are stepped one after the other.
+  ///
+  /// @tparam propagator_state_t Type of the propagator state with options
+  ///
+  /// @param [in,out] states the propagator state objects
+  ///
+  /// @return Propagation result for every state, in the same order
+  template <typename propagator_state_t>
+  std::vector<Result<void>> propagateBatch(
+      std::vector<propagator_state_t>& states) const;
+
+  /// @brief Propagate a bundle of track parameters in lock-step
+  ///
+  /// Convenience wrapper around @c makeState, @c propagateBatch and
+  /// @c makeResult, which is equivalent to calling @c propagate for every
+  /// start parameters with the same options.
+  ///
+  /// @tparam parameters_t Type of initial track parameters to propagate
+  /// @tparam propagator_options_t Type of the propagator options
+  /// @tparam path_aborter_t The path aborter type to be added
+  ///
+  /// @param [in] starts initial track parameters to propagate
+  /// @param [in] options Propagation options, type Options<,>
+  /// @param [in] makeCurvilinear Produce curvilinear parameters at the end of the propagation
+  ///
+  /// @return Propagation result for every start parameters, in the same order
+  template <typename parameters_t, typename propagator_options_t,
+            typename path_aborter_t = PathLimitReached>
+  std::vector<Result<actor_list_t_result_t<
+      StepperCurvilinearTrackParameters,
+      typename propagator_options_t::actor_list_type>>>
+  propagateBatch(const std::vector<parameters_t>& starts,
+                 const propagator_options_t& options,
+                 bool makeCurvilinear = true) const;
+
   /// @brief Builds the propagator result object
   ///
   /// This function creates the propagator result object from the propagator
@@ -399,6 +451,36 @@ class Propagator final
   template <typename propagator_state_t, typename result_t>
   void moveStateToResult(propagator_state_t& state, result_t& result) const;
 
+  /// Pre-propagation call to the actors
+  ///
+  /// @return true if an abort condition is already fulfilled and no step
+  ///         has to be done
+  template <typename propagator_state_t>
+  bool startStepping(propagator_state_t& state) const;
+
+  /// Pre-step calls to the navigator and the actors
+  template <typename propagator_state_t>
+  void prepareStep(propagator_state_t& state) const;
+
+  /// Post-step calls to the navigator and the actors after the stepper step
+  ///
+  /// @return true if an abort condition is fulfilled after the step
+  template <typename propagator_state_t>
+  Result<bool> completeStep(propagator_state_t& state,
+                            const Result<double>& res) const;
+
+  /// Perform a single step including the navigator and actor calls
+  ///
+  /// @return true if an abort condition is fulfilled after the step
+  template <typename propagator_state_t>
+  Result<bool> performStep(propagator_state_t& state) const;
+
+  /// Post-propagation call to the actors, or the step count limit error if
+  /// the propagation did not terminate normally
+  template <typename propagator_state_t>
+  Result<void> finishStepping(propagator_state_t& state,
+                              bool terminatedNormally) const;
+
   /// Implementation of propagation algorithm
   stepper_t m_stepper;
 
@@ -14,6 +14,9 @@
 #include "Acts/Propagator/detail/LoopProtection.hpp"
 
 #include <concepts>
+#include <cstddef>
+#include <span>
+#include <vector>
 
 namespace Acts::detail {
 template <typename Stepper, typename StateType, typename N>
@@ -21,12 +24,16 @@ concept propagator_stepper_compatible_with =
     requires(const Stepper& s, StateType& st, const N& n) {
       { s.step(st, n) } -> std::same_as<Acts::Result<double>>;
     };
+
+template <typename Stepper, typename StateType, typename N>
+concept propagator_stepper_batch_compatible_with =
+    requires(const Stepper& s, std::span<StateType* const> st, const N& n,
+             std::span<Acts::Result<double>> r) { s.stepBatch(st, n, r); };
 }  // namespace Acts::detail
 
 template <typename S, typename N>
 template <typename propagator_state_t>
-auto Acts::Propagator<S, N>::propagate(propagator_state_t& state) const
-    -> Result<void> {
+bool Acts::Propagator<S, N>::startStepping(propagator_state_t& state) const {
   // Pre-stepping call to the navigator and actor list
   ACTS_VERBOSE("Entering propagation.");
 
@@ -34,56 +41,70 @@ auto Acts::Propagator<S, N>::propagate(propagator_state_t& state) const
 
   // Pre-Stepping call to the actor list
   state.options.actorList.act(state, m_stepper, m_navigator, logger());
-  // assume negative outcome, only set to true later if we actually have
-  // a positive outcome.
-
-  // start at true, if we don't begin the stepping loop we're fine.
-  bool terminatedNormally = true;
 
   // Pre-Stepping: abort condition check
-  if (!state.options.actorList.checkAbort(state, m_stepper, m_navigator,
-                                          logger())) {
-    // Stepping loop
-    ACTS_VERBOSE("Starting stepping loop.");
-
-    terminatedNormally = false;  // priming error condition
-
-    // Propagation loop : stepping
-    for (; state.steps < state.options.maxSteps; ++state.steps) {
-      // Pre-Stepping: target setting
-      state.stage = PropagatorStage::preStep;
-      m_navigator.preStep(state, m_stepper);
-      // Perform a propagation step - it takes the propagation state
-      Result<double> res = m_stepper.step(state, m_navigator);
-      if (res.ok()) {
-        // Accumulate the path length
-        double s = *res;
-        state.pathLength += s;
-        ACTS_VERBOSE("Step with size = " << s << " performed");
-      } else {
-        ACTS_ERROR("Step failed with " << res.error() << ": "
-                                       << res.error().message());
-        // pass error to caller
-        return res.error();
-      }
-      // release actor and aborter constrains after step was performed
-      m_stepper.releaseStepSize(state.stepping, ConstrainedStep::actor);
-      m_stepper.releaseStepSize(state.stepping, ConstrainedStep::aborter);
-      // Post-stepping:
-      // navigator post step call - actor list act - actor list check
-      state.stage = PropagatorStage::postStep;
-      m_navigator.postStep(state, m_stepper);
-      state.options.actorList.act(state, m_stepper, m_navigator, logger());
-      if (state.options.actorList.checkAbort(state, m_stepper, m_navigator,
-                                             logger())) {
-        terminatedNormally = true;
-        break;
-      }
-    }
-  } else {
+  if (state.options.actorList.checkAbort(state, m_stepper, m_navigator,
+                                         logger())) {
     ACTS_VERBOSE("Propagation terminated without going into stepping loop.");
+    return true;
+  }
+
+  ACTS_VERBOSE("Starting stepping loop.");
+  return false;
+}
+
+template <typename S, typename N>
+template <typename propagator_state_t>
+void Acts::Propagator<S, N>::prepareStep(propagator_state_t& state) const {
+  // Pre-Stepping: target setting
+  state.stage = PropagatorStage::preStep;
+  m_navigator.preStep(state, m_stepper);
+  // Pre-Stepping call to the actors which observe the step
+  state.options.actorList.preStep(state, m_stepper, m_navigator, logger());
+}
+
+template <typename S, typename N>
+template <typename propagator_state_t>
+auto Acts::Propagator<S, N>::completeStep(propagator_state_t& state,
+                                          const Result<double>& res) const
+    -> Result<bool> {
+  if (res.ok()) {
+    // Accumulate the path length
+    double s = *res;
+    state.pathLength += s;
+    ACTS_VERBOSE("Step with size = " << s << " performed");
+  } else {
+    ACTS_ERROR("Step failed with " << res.error() << ": "
+                                   << res.error().message());
+    // pass error to caller
+    return Result<bool>::failure(res.error());
   }
+  // release actor and aborter constrains after step was performed
+  m_stepper.releaseStepSize(state.stepping, ConstrainedStep::actor);
+  m_stepper.releaseStepSize(state.stepping, ConstrainedStep::aborter);
+  // Post-stepping:
+  // navigator post step call - actor list act - actor list check
+  state.stage = PropagatorStage::postStep;
+  m_navigator.postStep(state, m_stepper);
+  state.options.actorList.act(state, m_stepper, m_navigator, logger());
+  return Result<bool>::success(state.options.actorList.checkAbort(
+      state, m_stepper, m_navigator, logger()));
+}
 
+template <typename S, typename N>
+template <typename propagator_state_t>
+auto Acts::Propagator<S, N>::performStep(propagator_state_t& state) const
+    -> Result<bool> {
+  prepareStep(state);
+  // Perform a propagation step - it takes the propagation state
+  return completeStep(state, m_stepper.step(state, m_navigator));
+}
+
+template <typename S, typename N>
+template <typename propagator_state_t>
+auto Acts::Propagator<S, N>::finishStepping(propagator_state_t& state,
+                                            bool terminatedNormally) const
+    -> Result<void> {
   state.stage = PropagatorStage::postPropagation;
 
   // if we didn't terminate normally (via aborters) set navigation break.
@@ -104,6 +125,143 @@ auto Acts::Propagator<S, N>::propagate(propagator_state_t& state) const
   return Result<void>::success();
 }
 
+template <typename S, typename N>
+template <typename propagator_state_t>
+auto Acts::Propagator<S, N>::propagate(propagator_state_t& state) const
+    -> Result<void> {
+  // start at true, if we don't begin the stepping loop we're fine.
+  bool terminatedNormally = startStepping(state);
+
+  // Propagation loop : stepping
+  for (; !terminatedNormally && state.steps < state.options.maxSteps;
+       ++state.steps) {
+    Result<bool> res = performStep(state);
+    if (!res.ok()) {
+      return res.error();
+    }
+    if (*res) {
+      terminatedNormally = true;
+      break;
+    }
+  }
+
+  return finishStepping(state, terminatedNormally);
+}
+
+template <typename S, typename N>
+template <typename propagator_state_t>
+auto Acts::Propagator<S, N>::propagateBatch(
+    std::vector<propagator_state_t>& states) const
+    -> std::vector<Result<void>> {
+  std::vector<Result<void>> results(states.size(), Result<void>::success());
+
+  // indices of the states which are still being stepped
+  std::vector<std::size_t> active;
+  active.reserve(states.size());
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    if (startStepping(states[i])) {
+      results[i] = finishStepping(states[i], true);
+    } else {
+      active.push_back(i);
+    }
+  }
+
+  // Handle the outcome of a step, returns true if the state drops out
+  auto dropOut = [&](std::size_t i, const Result<bool>& res) {
+    if (!res.ok()) {
+      results[i] = res.error();
+      return true;
+    }
+    if (*res) {
+      results[i] = finishStepping(states[i], true);
+      return true;
+    }
+    ++states[i].steps;
+    return false;
+  };
+
+  std::vector<propagator_state_t*> bundle;
+  std::vector<Result<double>> stepResults;
+
+  // Propagation loop : one step of every active state per iteration, finished
+  // states drop out of the bundle
+  while (!active.empty()) {
+    std::erase_if(active, [&](std::size_t i) {
+      if (states[i].steps < states[i].options.maxSteps) {
+        return false;
+      }
+      results[i] = finishStepping(states[i], false);
+      return true;
+    });
+
+    if constexpr (detail::propagator_stepper_batch_compatible_with<
+                      S, propagator_state_t, N>) {
+      // The steps of all active states are performed by the stepper at once,
+      // in between the navigator and actor calls of every state
+      bundle.clear();
+      stepResults.clear();
+      for (std::size_t i : active) {
+        prepareStep(states[i]);
+        bundle.push_back(&states[i]);
+        stepResults.push_back(Result<double>::success(0.));
+      }
+      m_stepper.stepBatch(std::span<propagator_state_t* const>(bundle),
+                          m_navigator, std::span(stepResults));
+
+      std::size_t nActive = 0;
+      for (std::size_t k = 0; k < active.size(); ++k) {
+        const std::size_t i = active[k];
+        if (!dropOut(i, completeStep(states[i], stepResults[k]))) {
+          active[nActive++] = i;
+        }
+      }
+      active.resize(nActive);
+    } else {
+      std::erase_if(active, [&](std::size_t i) {
+        return dropOut(i, performStep(states[i]));
+      });
+    }
+  }
+
+  return results;
+}
+
+template <typename S, typename N>
+template <typename parameters_t, typename propagator_options_t,
+          typename path_aborter_t>
+auto Acts::Propagator<S, N>::propagateBatch(
+    const std::vector<parameters_t>& starts,
+    const propagator_options_t& options, bool makeCurvilinear) const
+    -> std::vector<Result<actor_list_t_result_t<
+        StepperCurvilinearTrackParameters,
+        typename propagator_options_t::actor_list_type>>> {
+  using StateType =
+      decltype(makeState<parameters_t, propagator_options_t, path_aborter_t>(
+          starts.front(), options));
+  using ResultType = Result<actor_list_t_result_t<
+      StepperCurvilinearTrackParameters,
+      typename propagator_options_t::actor_list_type>>;
+
+  std::vector<StateType> states;
+  states.reserve(starts.size());
+  for (const auto& start : starts) {
+    states.push_back(
+        makeState<parameters_t, propagator_options_t, path_aborter_t>(
+            start, options));
+  }
+
+  // Perform the actual propagation
+  std::vector<Result<void>> propagationResults = propagateBatch(states);
+
+  std::vector<ResultType> results;
+  results.reserve(states.size());
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    results.push_back(makeResult(std::move(states[i]), propagationResults[i],
+                                 options, makeCurvilinear));
+  }
+  return results;
+}
+
 template <typename S, typename N>
 template <typename parameters_t, typename propagator_options_t,
           typename path_aborter_t>
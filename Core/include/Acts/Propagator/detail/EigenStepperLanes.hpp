@@ -0,0 +1,429 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Propagator/EigenStepperError.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+#include <Eigen/Core>
+
+namespace Acts::detail {
+
+/// @brief Runge-Kutta step of several EigenStepper states in SIMD lanes
+///
+/// The positions, directions, field values, Runge-Kutta stages and the
+/// transport matrices of up to @p kLanes states are stored as structure of
+/// arrays with one lane per state, so that the arithmetic of the Runge-Kutta
+/// integration and of the transport matrix is vectorized across the states.
+/// The transport matrix is then applied to the Jacobian of each state
+/// separately, since gathering the Jacobians into lanes costs more than it
+/// saves. The magnetic field of all lanes is retrieved with a single call to
+/// MagneticFieldProvider::getFields, where every lane uses the field cache of
+/// its own state.
+///
+/// Each lane performs the same operations as EigenStepper::step with the
+/// default extension, so the result for a state is identical as long as the
+/// batched field lookup returns the same values as the single one. A lane
+/// keeps its step size after it has been accepted, while the remaining lanes
+/// retry with a smaller step size.
+///
+/// @tparam kLanes the number of states which are stepped together
+template <int kLanes>
+class EigenStepperLanes {
+  static_assert(kLanes > 0, "The number of lanes must be positive");
+
+ public:
+  /// A stepper state together with the options it is stepped with
+  template <typename state_t>
+  struct Lane {
+    state_t* state = nullptr;
+    Direction direction = Direction::Forward;
+    double stepTolerance = 1e-4;
+    double stepSizeCutOff = 0.;
+    std::size_t maxRungeKuttaStepTrials = 10000;
+
+    Lane() = default;
+
+    /// @param state_ is the stepper state
+    /// @param options are the stepping options, see StepperPlainOptions
+    /// @param direction_ is the propagation direction
+    template <typename options_t>
+    Lane(state_t& state_, const options_t& options, Direction direction_)
+        : state(&state_),
+          direction(direction_),
+          stepTolerance(options.stepTolerance),
+          stepSizeCutOff(options.stepSizeCutOff),
+          maxRungeKuttaStepTrials(options.maxRungeKuttaStepTrials) {}
+  };
+
+  /// Perform one Runge-Kutta step of every lane
+  ///
+  /// @tparam state_t the state type of the EigenStepper with the default
+  ///         extension
+  ///
+  /// @param [in] bField is the magnetic field of all states
+  /// @param [in] lanes are the at least one and at most @p kLanes states
+  /// @param [out] results are the step results of the lanes, in the same
+  ///        order
+  template <typename state_t>
+  static void step(const MagneticFieldProvider& bField,
+                   std::span<const Lane<state_t>> lanes,
+                   std::span<std::optional<Result<double>>> results);
+
+ private:
+  /// One scalar per lane
+  using Lanes = Eigen::Array<ActsScalar, kLanes, 1>;
+  /// One three-vector per lane, stored column-wise
+  using LaneVectors = Eigen::Array<ActsScalar, kLanes, 3>;
+  /// One 3x3 matrix per lane, stored as its three columns
+  using LaneMatrices = std::array<LaneVectors, 3>;
+
+  /// Lane-wise cross product
+  static LaneVectors cross(const LaneVectors& a, const LaneVectors& b) {
+    // Same operation order as Eigen::MatrixBase::cross
+    LaneVectors c;
+    c.col(0) = a.col(1) * b.col(2) - a.col(2) * b.col(1);
+    c.col(1) = a.col(2) * b.col(0) - a.col(0) * b.col(2);
+    c.col(2) = a.col(0) * b.col(1) - a.col(1) * b.col(0);
+    return c;
+  }
+
+  /// Lane-wise cross product of the columns of a matrix with a vector
+  static LaneMatrices cross(const LaneMatrices& m, const LaneVectors& v) {
+    return {cross(m[0], v), cross(m[1], v), cross(m[2], v)};
+  }
+};
+
+template <int kLanes>
+template <typename state_t>
+void EigenStepperLanes<kLanes>::step(
+    const MagneticFieldProvider& bField, std::span<const Lane<state_t>> lanes,
+    std::span<std::optional<Result<double>>> results) {
+  assert(!lanes.empty() && lanes.size() <= kLanes);
+  assert(lanes.size() == results.size());
+
+  const int nLanes = static_cast<int>(lanes.size());
+
+  // Unused lanes repeat the last state and are never written back
+  auto lane = [&](int l) -> const Lane<state_t>& {
+    return lanes[std::min(l, nLanes - 1)];
+  };
+
+  // Load the states into the lanes
+  LaneVectors pos;
+  LaneVectors dir;
+  Lanes qop;
+  Lanes h;
+  Lanes stepTolerance;
+  for (int l = 0; l < kLanes; ++l) {
+    const state_t& st = *lane(l).state;
+    pos.row(l) = st.pars.template segment<3>(eFreePos0).transpose();
+    dir.row(l) = st.pars.template segment<3>(eFreeDir0).transpose();
+    qop(l) = st.pars[eFreeQOverP];
+    h(l) = st.stepSize.value() * lane(l).direction;
+    stepTolerance(l) = lane(l).stepTolerance;
+  }
+  const Lanes initialH = h;
+
+  // Lanes are active until their step is accepted or has failed
+  std::array<bool, kLanes> active{};
+  std::array<std::size_t, kLanes> nStepTrials{};
+  std::fill_n(active.begin(), nLanes, true);
+
+  // Every lane uses the field cache of its own state. The active lanes are
+  // looked up in one batch, if it fails the lanes are looked up one by one to
+  // find the failing ones.
+  auto getField = [&](const LaneVectors& positions, LaneVectors& field) {
+    std::array<Vector3, kLanes> lanePositions;
+    std::array<Vector3, kLanes> laneFields;
+    std::array<MagneticFieldProvider::Cache*, kLanes> laneCaches{};
+    std::array<int, kLanes> activeLanes{};
+    std::size_t nActive = 0;
+    for (int l = 0; l < nLanes; ++l) {
+      if (!active[l]) {
+        continue;
+      }
+      lanePositions[nActive] = positions.row(l).transpose();
+      laneCaches[nActive] = &lanes[l].state->fieldCache;
+      activeLanes[nActive] = l;
+      ++nActive;
+    }
+    if (nActive == 0) {
+      return;
+    }
+
+    auto fieldRes = bField.getFields(std::span(lanePositions.data(), nActive),
+                                     std::span(laneFields.data(), nActive),
+                                     std::span(laneCaches.data(), nActive));
+    if (fieldRes.ok()) {
+      for (std::size_t i = 0; i < nActive; ++i) {
+        field.row(activeLanes[i]) = laneFields[i].transpose();
+      }
+      return;
+    }
+
+    for (std::size_t i = 0; i < nActive; ++i) {
+      const int l = activeLanes[i];
+      auto laneRes = bField.getField(lanePositions[i], *laneCaches[i]);
+      if (!laneRes.ok()) {
+        active[l] = false;
+        results[l] = laneRes.error();
+        continue;
+      }
+      field.row(l) = laneRes->transpose();
+    }
+  };
+
+  // First Runge-Kutta point (at current position)
+  LaneVectors bFirst = LaneVectors::Zero();
+  LaneVectors bMiddle = LaneVectors::Zero();
+  LaneVectors bLast = LaneVectors::Zero();
+  getField(pos, bFirst);
+  const LaneVectors k1 = cross(dir, bFirst).colwise() * qop;
+
+  LaneVectors k2;
+  LaneVectors k3;
+  LaneVectors k4;
+  Lanes h2;
+  Lanes halfH;
+  Lanes errorEstimate;
+
+  // Stepper accuracy control as in the EigenStepper, see ATL-SOFT-PUB-2009-001
+  const auto calcStepSizeScaling = [&](int l, const double errorEstimate_) {
+    return std::clamp(std::sqrt(std::sqrt(stepTolerance(l) / errorEstimate_)),
+                      0.25, 4.0);
+  };
+
+  // Select and adjust the appropriate Runge-Kutta step size of each lane. The
+  // accepted lanes are recomputed with the same step size and field values
+  // until all lanes are accepted or failed.
+  while (std::any_of(active.begin(), active.end(), [](bool a) { return a; })) {
+    for (int l = 0; l < nLanes; ++l) {
+      nStepTrials[l] += active[l] ? 1 : 0;
+    }
+
+    h2 = h * h;
+    halfH = h * 0.5;
+
+    // Second and third Runge-Kutta point
+    const LaneVectors pos1 =
+        pos + dir.colwise() * halfH + k1.colwise() * (h2 * 0.125);
+    getField(pos1, bMiddle);
+    k2 = cross(dir + k1.colwise() * halfH, bMiddle).colwise() * qop;
+    k3 = cross(dir + k2.colwise() * halfH, bMiddle).colwise() * qop;
+
+    // Last Runge-Kutta point
+    const LaneVectors pos2 =
+        pos + dir.colwise() * h + k3.colwise() * (h2 * 0.5);
+    getField(pos2, bLast);
+    k4 = cross(dir + k3.colwise() * h, bLast).colwise() * qop;
+
+    // Compute and check the local integration error estimate
+    const LaneVectors kDiff = (k1 - k2 - k3 + k4).abs();
+    errorEstimate =
+        (h2 * (kDiff.col(0) + kDiff.col(1) + kDiff.col(2))).max(1e-20);
+
+    for (int l = 0; l < nLanes; ++l) {
+      if (!active[l]) {
+        continue;
+      }
+      if (errorEstimate(l) <= 4.0 * lanes[l].stepTolerance) {
+        active[l] = false;
+        results[l] = h(l);
+        continue;
+      }
+
+      h(l) *= calcStepSizeScaling(l, errorEstimate(l));
+
+      if (std::abs(h(l)) < std::abs(lanes[l].stepSizeCutOff)) {
+        // Not moving due to too low momentum needs an aborter
+        active[l] = false;
+        results[l] = EigenStepperError::StepSizeStalled;
+      } else if (nStepTrials[l] > lanes[l].maxRungeKuttaStepTrials) {
+        // Too many trials, have to abort
+        active[l] = false;
+        results[l] = EigenStepperError::StepSizeAdjustmentFailed;
+      }
+    }
+  }
+
+  // Time derivative, see EigenStepperDefaultExtension::propagateTime
+  Lanes mass;
+  Lanes dtds;
+  for (int l = 0; l < kLanes; ++l) {
+    const auto& particleHypothesis = lane(l).state->particleHypothesis;
+    // keep the single precision of the mass as in the EigenStepper
+    const auto m = particleHypothesis.mass();
+    const double p = particleHypothesis.extractMomentum(qop(l));
+    mass(l) = m;
+    dtds(l) = std::sqrt(1 + m * m / (p * p));
+  }
+
+  // The transport matrix of each lane, see
+  // EigenStepperDefaultExtension::transportMatrix, and the transport of the
+  // Jacobians
+  const bool covTransport = std::any_of(
+      lanes.begin(), lanes.end(), [](const Lane<state_t>& laneState) {
+        return laneState.state->covTransport;
+      });
+  if (covTransport) {
+    const Lanes hOver6 = h / 6.;
+
+    LaneMatrices dFdT;
+    LaneMatrices dGdT;
+
+    const LaneVectors dk1dL = cross(dir, bFirst);
+    const LaneVectors dk2dL =
+        cross(dir + k1.colwise() * halfH, bMiddle) +
+        cross(dk1dL, bMiddle).colwise() * (qop * halfH);
+    const LaneVectors dk3dL =
+        cross(dir + k2.colwise() * halfH, bMiddle) +
+        cross(dk2dL, bMiddle).colwise() * (qop * halfH);
+    const LaneVectors dk4dL = cross(dir + k3.colwise() * h, bLast) +
+                              cross(dk3dL, bLast).colwise() * (qop * h);
+
+    const Lanes zero = Lanes::Zero();
+    LaneMatrices dk1dT;
+    dk1dT[0] << zero, -bFirst.col(2), bFirst.col(1);
+    dk1dT[1] << bFirst.col(2), zero, -bFirst.col(0);
+    dk1dT[2] << -bFirst.col(1), bFirst.col(0), zero;
+
+    LaneMatrices identity;
+    for (int j = 0; j < 3; ++j) {
+      identity[j] = LaneVectors::Zero();
+      identity[j].col(j).setOnes();
+      dk1dT[j] = dk1dT[j].colwise() * qop;
+    }
+
+    LaneMatrices dk2dT;
+    LaneMatrices dk3dT;
+    LaneMatrices dk4dT;
+    for (int j = 0; j < 3; ++j) {
+      dk2dT[j] = identity[j] + dk1dT[j].colwise() * halfH;
+    }
+    dk2dT = cross(dk2dT, bMiddle);
+    for (int j = 0; j < 3; ++j) {
+      dk2dT[j] = dk2dT[j].colwise() * qop;
+      dk3dT[j] = identity[j] + dk2dT[j].colwise() * halfH;
+    }
+    dk3dT = cross(dk3dT, bMiddle);
+    for (int j = 0; j < 3; ++j) {
+      dk3dT[j] = dk3dT[j].colwise() * qop;
+      dk4dT[j] = identity[j] + dk3dT[j].colwise() * h;
+    }
+    dk4dT = cross(dk4dT, bLast);
+    for (int j = 0; j < 3; ++j) {
+      dk4dT[j] = dk4dT[j].colwise() * qop;
+
+      dFdT[j] = (identity[j] +
+                 (dk1dT[j] + dk2dT[j] + dk3dT[j]).colwise() * hOver6)
+                    .colwise() *
+                h;
+      dGdT[j] = identity[j] +
+                (dk1dT[j] + 2. * (dk2dT[j] + dk3dT[j]) + dk4dT[j]).colwise() *
+                    hOver6;
+    }
+
+    const LaneVectors dFdL =
+        (dk1dL + dk2dL + dk3dL).colwise() * ((h * h) / 6.);
+    const LaneVectors dGdL =
+        (dk1dL + 2. * (dk2dL + dk3dL) + dk4dL).colwise() * hOver6;
+    const Lanes dTdL = h * mass * mass * qop / dtds;
+
+    // Only the right 4x4 blocks of the Jacobian change, see EigenStepper::step
+    // for the blocked multiplication
+    for (int l = 0; l < nLanes; ++l) {
+      state_t& st = *lanes[l].state;
+      if (!results[l]->ok() || !st.covTransport) {
+        continue;
+      }
+
+      ActsSquareMatrix<4> dTop = ActsSquareMatrix<4>::Zero();
+      ActsSquareMatrix<4> dBottom = ActsSquareMatrix<4>::Zero();
+      for (int j = 0; j < 3; ++j) {
+        dTop.block<3, 1>(0, j) = dFdT[j].row(l).transpose();
+        dBottom.block<3, 1>(0, j) = dGdT[j].row(l).transpose();
+      }
+      dTop.block<3, 1>(0, 3) = dFdL.row(l).transpose();
+      dBottom.block<3, 1>(0, 3) = dGdL.row(l).transpose();
+      dTop(3, 3) = dTdL(l);
+      dBottom(3, 3) = 1;
+
+      st.jacTransport.template topRightCorner<4, 4>() +=
+          dTop * st.jacTransport.template bottomRightCorner<4, 4>();
+      st.jacTransport.template bottomRightCorner<4, 4>() =
+          (dBottom * st.jacTransport.template bottomRightCorner<4, 4>())
+              .eval();
+    }
+  }
+
+  // Write the accepted lanes back to their states
+  for (int l = 0; l < nLanes; ++l) {
+    if (!results[l]->ok()) {
+      continue;
+    }
+    state_t& st = *lanes[l].state;
+    auto& sd = st.stepData;
+
+    sd.B_first = bFirst.row(l).transpose();
+    sd.B_middle = bMiddle.row(l).transpose();
+    sd.B_last = bLast.row(l).transpose();
+    sd.k1 = k1.row(l).transpose();
+    sd.k2 = k2.row(l).transpose();
+    sd.k3 = k3.row(l).transpose();
+    sd.k4 = k4.row(l).transpose();
+    sd.kQoP = {0., 0., 0., 0.};
+
+    st.pars[eFreeTime] += h(l) * dtds(l);
+    if (st.covTransport) {
+      st.derivative(3) = dtds(l);
+    }
+
+    // Update the track parameters according to the equations of motion
+    const double hl = h(l);
+    st.pars.template segment<3>(eFreePos0) +=
+        hl * dir.row(l).transpose().matrix() +
+        h2(l) / 6. * (sd.k1 + sd.k2 + sd.k3);
+    st.pars.template segment<3>(eFreeDir0) +=
+        hl / 6. * (sd.k1 + 2. * (sd.k2 + sd.k3) + sd.k4);
+    (st.pars.template segment<3>(eFreeDir0)).normalize();
+
+    if (st.covTransport) {
+      // using the updated direction
+      st.derivative.template head<3>() = st.pars.template segment<3>(eFreeDir0);
+      st.derivative.template segment<3>(4) = sd.k4;
+    }
+
+    st.pathAccumulated += hl;
+    ++st.nSteps;
+    st.nStepTrials += nStepTrials[l];
+
+    const double nextAccuracy =
+        std::abs(hl * calcStepSizeScaling(l, errorEstimate(l)));
+    const double previousAccuracy = std::abs(st.stepSize.accuracy());
+    const double initialStepLength = std::abs(initialH(l));
+    if (nextAccuracy < initialStepLength || nextAccuracy > previousAccuracy) {
+      st.stepSize.setAccuracy(nextAccuracy);
+    }
+  }
+}
+
+}  // namespace Acts::detail
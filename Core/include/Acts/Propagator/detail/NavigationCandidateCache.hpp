@@ -0,0 +1,154 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
+
+namespace Acts::detail {
+
+/// @brief Thread-local cache of the navigation candidates of a volume
+///
+/// Stores the layers and boundary surfaces which were found to be compatible
+/// when searching a volume, keyed by the navigator which did the search, the
+/// volume, the objects the search started from and ends at, and coarse bins of
+/// the position and the direction. Later propagations in the same thread from
+/// a similar position in a similar direction only need to intersect these
+/// candidates instead of searching the volume.
+///
+/// The candidates are stored as found by a search without a path limit, in
+/// the order of the search, so that they can be reused by propagations with a
+/// different path limit.
+class NavigationCandidateCache {
+ public:
+  using Layers = boost::container::small_vector<const Layer*, 10>;
+  using Boundaries = boost::container::small_vector<const BoundarySurface*, 4>;
+
+  /// Identifies a set of candidates
+  struct Key {
+    /// Unique id of the navigator, see @c makeOwnerId
+    std::uint64_t owner = 0;
+    /// The volume which is searched
+    const TrackingVolume* volume = nullptr;
+    /// The layer or surface the search starts from, if any
+    const void* start = nullptr;
+    /// The layer or surface the search ends at, if any
+    const void* end = nullptr;
+    /// Coarse bin of the position
+    std::array<std::int32_t, 3> positionBin = {0, 0, 0};
+    /// Coarse bin of the direction in eta
+    std::int32_t etaBin = 0;
+    /// Coarse bin of the direction in phi
+    std::int32_t phiBin = 0;
+
+    bool operator==(const Key& other) const = default;
+  };
+
+  /// Upper limit for the number of entries per thread, the cache is cleared
+  /// when it is reached
+  static constexpr std::size_t s_maxEntries = 1 << 16;
+
+  /// @return the cache of the calling thread
+  static NavigationCandidateCache& local();
+
+  /// @return a new unique id for a navigator which uses the cache
+  static std::uint64_t makeOwnerId();
+
+  /// @return the cached layers for @p key or nullptr if there are none
+  const Layers* findLayers(const Key& key) const {
+    return find(m_layers, key);
+  }
+
+  /// @return the cached boundaries for @p key or nullptr if there are none
+  const Boundaries* findBoundaries(const Key& key) const {
+    return find(m_boundaries, key);
+  }
+
+  /// Store layers as the entry for @p key
+  ///
+  /// @param key The key of the entry
+  /// @param layers The layer intersections as returned by the volume
+  template <typename layer_intersections_t>
+  void insertLayers(const Key& key, const layer_intersections_t& layers) {
+    insert(m_layers, key, layers);
+  }
+
+  /// Store boundaries as the entry for @p key
+  ///
+  /// @param key The key of the entry
+  /// @param boundaries The boundary intersections as returned by the volume
+  template <typename boundary_intersections_t>
+  void insertBoundaries(const Key& key,
+                        const boundary_intersections_t& boundaries) {
+    insert(m_boundaries, key, boundaries);
+  }
+
+  /// @return the number of cached entries
+  std::size_t size() const { return m_layers.size() + m_boundaries.size(); }
+
+  /// Remove all entries
+  void clear() {
+    m_layers.clear();
+    m_boundaries.clear();
+  }
+
+ private:
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+      std::size_t seed = std::hash<std::uint64_t>{}(key.owner);
+      auto combine = [&seed](std::size_t value) {
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      };
+      combine(std::hash<const void*>{}(key.volume));
+      combine(std::hash<const void*>{}(key.start));
+      combine(std::hash<const void*>{}(key.end));
+      for (std::int32_t bin : key.positionBin) {
+        combine(std::hash<std::int32_t>{}(bin));
+      }
+      combine(std::hash<std::int32_t>{}(key.etaBin));
+      combine(std::hash<std::int32_t>{}(key.phiBin));
+      return seed;
+    }
+  };
+
+  template <typename value_t>
+  using Map = std::unordered_map<Key, value_t, KeyHash>;
+
+  template <typename value_t>
+  static const value_t* find(const Map<value_t>& map, const Key& key) {
+    auto it = map.find(key);
+    return it != map.end() ? &it->second : nullptr;
+  }
+
+  template <typename value_t, typename intersections_t>
+  void insert(Map<value_t>& map, const Key& key,
+              const intersections_t& intersections) {
+    if (size() >= s_maxEntries) {
+      clear();
+    }
+    value_t& entry = map[key];
+    entry.clear();
+    for (const auto& [intersection, object] : intersections) {
+      entry.push_back(object);
+    }
+  }
+
+  Map<Layers> m_layers;
+  Map<Boundaries> m_boundaries;
+};
+
+}  // namespace Acts::detail
@@ -41,6 +41,30 @@ struct actor_caller {
     }
   }
 
+  template <typename actor_t, typename propagator_state_t, typename stepper_t,
+            typename navigator_t, typename... Args>
+  static void preStep(const actor_t& actor, propagator_state_t& state,
+                      const stepper_t& stepper, const navigator_t& navigator,
+                      Args&&... args)
+    requires(
+        Actor<actor_t, propagator_state_t, stepper_t, navigator_t, Args...>)
+  {
+    if constexpr (ActorHasPreStepWithoutResult<actor_t, propagator_state_t,
+                                               stepper_t, navigator_t,
+                                               Args...>) {
+      actor.preStep(state, stepper, navigator, std::forward<Args>(args)...);
+      return;
+    }
+
+    if constexpr (ActorHasPreStepWithResult<actor_t, propagator_state_t,
+                                            stepper_t, navigator_t, Args...>) {
+      actor.preStep(state, stepper, navigator,
+                    state.template get<typename actor_t::result_type>(),
+                    std::forward<Args>(args)...);
+      return;
+    }
+  }
+
   template <typename actor_t, typename propagator_state_t, typename stepper_t,
             typename navigator_t, typename... Args>
   static bool checkAbort(const actor_t& actor, propagator_state_t& state,
@@ -85,6 +109,20 @@ struct actor_list_impl {
         actor_tuple);
   }
 
+  template <typename propagator_state_t, typename stepper_t,
+            typename navigator_t, typename... Args>
+  static void preStep(const std::tuple<actors_t...>& actor_tuple,
+                      propagator_state_t& state, const stepper_t& stepper,
+                      const navigator_t& navigator, Args&&... args) {
+    std::apply(
+        [&](const actors_t&... actor) {
+          (actor_caller::preStep(actor, state, stepper, navigator,
+                                 std::forward<Args>(args)...),
+           ...);
+        },
+        actor_tuple);
+  }
+
   template <typename propagator_state_t, typename stepper_t,
             typename navigator_t, typename... Args>
   static bool checkAbort(const std::tuple<actors_t...>& actor_tuple,
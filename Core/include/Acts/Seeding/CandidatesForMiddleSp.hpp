@@ -99,6 +99,12 @@ class CandidatesForMiddleSp {
   /// @returns Vector of triplet candidates
   std::vector<value_type> storage();
 
+  /// @brief Retrieve the triplet candidates into a vector owned by the caller,
+  /// sorted with higher quality first. This does not allocate if the capacity
+  /// of the vector is sufficient.
+  /// @param output Vector which is overwritten with the triplet candidates
+  void storage(std::vector<value_type>& output);
+
   /// @brief Adding a new triplet candidate to the collection, should it satisfy the
   /// selection criteria
   /// @param SpB Bottom space point
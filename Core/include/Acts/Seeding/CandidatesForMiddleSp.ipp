@@ -209,9 +209,17 @@ void CandidatesForMiddleSp<external_space_point_t>::bubbleup(
 template <SatisfyCandidateConcept external_space_point_t>
 std::vector<typename CandidatesForMiddleSp<external_space_point_t>::value_type>
 CandidatesForMiddleSp<external_space_point_t>::storage() {
+  std::vector<value_type> output;
+  storage(output);
+  return output;
+}
+
+template <SatisfyCandidateConcept external_space_point_t>
+void CandidatesForMiddleSp<external_space_point_t>::storage(
+    std::vector<value_type>& output) {
   // this will retrieve the entire storage
   // the resulting vector is already sorted from high to low quality
-  std::vector<value_type> output(m_nHigh + m_nLow);
+  output.resize(m_nHigh + m_nLow);
   std::size_t outIdx = output.size() - 1;
 
   // rely on the fact that m_indices* are both min heap trees
@@ -251,7 +259,6 @@ CandidatesForMiddleSp<external_space_point_t>::storage() {
   }  // while loop
 
   clear();
-  return output;
 }
 
 template <SatisfyCandidateConcept external_space_point_t>
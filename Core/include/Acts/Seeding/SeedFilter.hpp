@@ -14,6 +14,8 @@
 #include "Acts/Seeding/IExperimentCuts.hpp"
 #include "Acts/Seeding/SeedFilterConfig.hpp"
 
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -32,6 +34,15 @@ struct SeedFilterState {
       std::numeric_limits<float>::max();  // Acts::UnitConstants::mm
 };
 
+/// Memory used by the seed filter, which can be kept between calls to avoid
+/// allocations
+struct SeedFilterScratch {
+  // indices of the top space points sorted by curvature
+  std::vector<std::size_t> topSPIndexVec;
+  // radius of the compatible seeds of the current top space point
+  std::vector<float> compatibleSeedR;
+};
+
 /// Filter seeds at various stages with the currently
 /// available information.
 template <typename external_spacepoint_t>
@@ -65,6 +76,30 @@ class SeedFilter final {
       CandidatesForMiddleSp<const external_spacepoint_t>& candidates_collector)
       const;
 
+  /// Create Seeds for the all seeds with the same bottom and middle
+  /// space point and discard all others, without allocations once the
+  /// scratch memory is large enough.
+  /// @param mutableData Container for mutable variables used in the seeding
+  /// @param bottomSP fixed bottom space point
+  /// @param middleSP fixed middle space point
+  /// @param topSpVec vector containing all space points that may be compatible
+  ///                 with both bottom and middle space point
+  /// @param invHelixDiameterVec vector containing 1/(2*r) values where r is the helix radius
+  /// @param impactParametersVec vector containing the impact parameters
+  /// @param seedFilterState holds quantities used in seed filter
+  /// @param candidates_collector container for the seed candidates
+  /// @param scratch memory which is reused between calls
+  void filterSeeds_2SpFixed(
+      const Acts::SpacePointMutableData& mutableData,
+      const external_spacepoint_t& bottomSP,
+      const external_spacepoint_t& middleSP,
+      const std::vector<const external_spacepoint_t*>& topSpVec,
+      const std::vector<float>& invHelixDiameterVec,
+      const std::vector<float>& impactParametersVec,
+      SeedFilterState& seedFilterState,
+      CandidatesForMiddleSp<const external_spacepoint_t>& candidates_collector,
+      SeedFilterScratch& scratch) const;
+
   /// Filter seeds once all seeds for one middle space point have been created
   /// @param mutableData Container for mutable variables used in the seeding
   /// @param candidates_collector collection of seed candidates
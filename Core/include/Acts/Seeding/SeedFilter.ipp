@@ -38,6 +38,23 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
     SeedFilterState& seedFilterState,
     CandidatesForMiddleSp<const external_spacepoint_t>& candidates_collector)
     const {
+  SeedFilterScratch scratch;
+  filterSeeds_2SpFixed(mutableData, bottomSP, middleSP, topSpVec,
+                       invHelixDiameterVec, impactParametersVec,
+                       seedFilterState, candidates_collector, scratch);
+}
+
+template <typename external_spacepoint_t>
+void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
+    const Acts::SpacePointMutableData& mutableData,
+    const external_spacepoint_t& bottomSP,
+    const external_spacepoint_t& middleSP,
+    const std::vector<const external_spacepoint_t*>& topSpVec,
+    const std::vector<float>& invHelixDiameterVec,
+    const std::vector<float>& impactParametersVec,
+    SeedFilterState& seedFilterState,
+    CandidatesForMiddleSp<const external_spacepoint_t>& candidates_collector,
+    SeedFilterScratch& scratch) const {
   // seed confirmation
   SeedConfirmationRangeConfig seedConfRange;
   if (m_cfg.seedConfirmation) {
@@ -61,7 +78,8 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
   float zOrigin = seedFilterState.zOrigin;
 
   // initialize original index locations
-  std::vector<std::size_t> topSPIndexVec(topSpVec.size());
+  std::vector<std::size_t>& topSPIndexVec = scratch.topSPIndexVec;
+  topSPIndexVec.resize(topSpVec.size());
   for (std::size_t i(0); i < topSPIndexVec.size(); ++i) {
     topSPIndexVec[i] = i;
   }
@@ -75,7 +93,7 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
   }
 
   // vector containing the radius of all compatible seeds
-  std::vector<float> compatibleSeedR;
+  std::vector<float>& compatibleSeedR = scratch.compatibleSeedR;
   compatibleSeedR.reserve(m_cfg.compatSeedLimit);
 
   std::size_t beginCompTopIndex = 0;
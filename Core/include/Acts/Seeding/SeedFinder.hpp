@@ -56,9 +56,19 @@ class SeedFinder {
     std::vector<const external_spacepoint_t*> topSpVec;
     std::vector<float> curvatures;
     std::vector<float> impactParameters;
+    // cotTheta and index of the doublets for sorting
+    std::vector<std::pair<float, std::size_t>> cotThetaSortKeys;
+    // indices of the doublets sorted by cotTheta
+    std::vector<std::size_t> sortedBottoms;
+    std::vector<std::size_t> sortedTops;
+    SeedFilterScratch seedFilterScratch;
 
     // managing seed candidates for SpM
     CandidatesForMiddleSp<const external_spacepoint_t> candidates_collector;
+    // seed candidates of the current SpM sorted by quality
+    std::vector<typename CandidatesForMiddleSp<
+        const external_spacepoint_t>::value_type>
+        sortedCandidates;
 
     // managing doublet candidates
     boost::container::small_vector<Acts::Neighbour<grid_t>,
@@ -67,6 +77,8 @@ class SeedFinder {
     boost::container::small_vector<Acts::Neighbour<grid_t>,
                                    Acts::detail::ipow(3, grid_t::DIM)>
         topNeighbours;
+    // packed coordinates of the doublet candidates in the neighbour bins
+    DoubletCandidates<external_spacepoint_t> doubletCandidates;
 
     // Mutable variables for Space points used in the seeding
     Acts::SpacePointMutableData spacePointMutableData;
@@ -97,6 +109,10 @@ class SeedFinder {
   /// @param rMiddleSPRange range object containing the minimum and maximum r for middle SP for a certain z bin.
   /// @note Ranges must return pointers.
   /// @note Ranges must be separate objects for each parallel call.
+  /// @note All temporary memory is kept in the state. Once the state has
+  /// seen groups of the same size, no more memory is allocated apart from
+  /// the growth of the output collection and allocations in the experiment
+  /// cuts.
   template <typename container_t, typename sp_range_t>
   void createSeedsForGroup(const Acts::SeedFinderOptions& options,
                            SeedingState& state, const grid_t& grid,
@@ -114,6 +130,7 @@ class SeedFinder {
   /// @param mutableData Container for mutable variables used in the seeding
   /// @param otherSPsNeighbours inner or outer space points to be used in the dublet
   /// @param mediumSP space point candidate to be used as middle SP in a seed
+  /// @param candidates Scratch memory for the packed doublet candidates
   /// @param linCircleVec vector containing inner or outer SP parameters after reference frame transformation to the u-v space
   /// @param outVec Output object containing top or bottom SPs that are compatible with a certain middle SPs
   /// @param deltaRMinSP minimum allowed r-distance between dublet components
@@ -130,6 +147,7 @@ class SeedFinder {
                                      Acts::detail::ipow(3, grid_t::DIM)>&
           otherSPsNeighbours,
       const external_spacepoint_t& mediumSP,
+      DoubletCandidates<external_spacepoint_t>& candidates,
       std::vector<LinCircle>& linCircleVec, out_range_t& outVec,
       const float deltaRMinSP, const float deltaRMaxSP, const float uIP,
       const float uIP2, const float cosPhiM, const float sinPhiM) const;
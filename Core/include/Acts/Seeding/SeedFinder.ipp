@@ -8,6 +8,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <numeric>
 #include <type_traits>
 
@@ -149,8 +151,9 @@ void SeedFinder<external_spacepoint_t, grid_t, platform_t>::createSeedsForGroup(
     // Iterate over middle-top dublets
     getCompatibleDoublets<Acts::SpacePointCandidateType::eTop>(
         options, grid, state.spacePointMutableData, state.topNeighbours, *spM,
-        state.linCircleTop, state.compatTopSP, m_config.deltaRMinTopSP,
-        m_config.deltaRMaxTopSP, uIP, uIP2, cosPhiM, sinPhiM);
+        state.doubletCandidates, state.linCircleTop, state.compatTopSP,
+        m_config.deltaRMinTopSP, m_config.deltaRMaxTopSP, uIP, uIP2, cosPhiM,
+        sinPhiM);
 
     // no top SP found -> try next spM
     if (state.compatTopSP.empty()) {
@@ -182,9 +185,9 @@ void SeedFinder<external_spacepoint_t, grid_t, platform_t>::createSeedsForGroup(
     // Iterate over middle-bottom dublets
     getCompatibleDoublets<Acts::SpacePointCandidateType::eBottom>(
         options, grid, state.spacePointMutableData, state.bottomNeighbours,
-        *spM, state.linCircleBottom, state.compatBottomSP,
-        m_config.deltaRMinBottomSP, m_config.deltaRMaxBottomSP, uIP, uIP2,
-        cosPhiM, sinPhiM);
+        *spM, state.doubletCandidates, state.linCircleBottom,
+        state.compatBottomSP, m_config.deltaRMinBottomSP,
+        m_config.deltaRMaxBottomSP, uIP, uIP2, cosPhiM, sinPhiM);
 
     // no bottom SP found -> try next spM
     if (state.compatBottomSP.empty()) {
@@ -200,9 +203,13 @@ void SeedFinder<external_spacepoint_t, grid_t, platform_t>::createSeedsForGroup(
           *spM, options, seedFilterState, state);
     }
 
-    m_config.seedFilter->filterSeeds_1SpFixed(state.spacePointMutableData,
-                                              state.candidates_collector,
-                                              outputCollection);
+    // retrieve all candidates, sorted with higher weights first
+    const std::size_t numQualitySeeds =
+        state.candidates_collector.nHighQualityCandidates();
+    state.candidates_collector.storage(state.sortedCandidates);
+    m_config.seedFilter->filterSeeds_1SpFixed(
+        state.spacePointMutableData, state.sortedCandidates, numQualitySeeds,
+        outputCollection);
 
   }  // loop on mediums
 }
@@ -216,10 +223,11 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
     boost::container::small_vector<Neighbour<grid_t>,
                                    Acts::detail::ipow(3, grid_t::DIM)>&
         otherSPsNeighbours,
-    const external_spacepoint_t& mediumSP, std::vector<LinCircle>& linCircleVec,
-    out_range_t& outVec, const float deltaRMinSP, const float deltaRMaxSP,
-    const float uIP, const float uIP2, const float cosPhiM,
-    const float sinPhiM) const {
+    const external_spacepoint_t& mediumSP,
+    DoubletCandidates<external_spacepoint_t>& candidates,
+    std::vector<LinCircle>& linCircleVec, out_range_t& outVec,
+    const float deltaRMinSP, const float deltaRMaxSP, const float uIP,
+    const float uIP2, const float cosPhiM, const float sinPhiM) const {
   float impactMax = m_config.impactMax;
 
   constexpr bool isBottomCandidate =
@@ -238,8 +246,7 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
     nsp += grid.at(otherSPCol.index).size();
   }
 
-  linCircleVec.reserve(nsp);
-  outVec.reserve(nsp);
+  candidates.reset(nsp);
 
   const float rM = mediumSP.radius();
   const float xM = mediumSP.x();
@@ -254,9 +261,7 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
     vIPAbs = impactMax * uIP2;
   }
 
-  float deltaR = 0.;
-  float deltaZ = 0.;
-
+  // collect the candidates in the radial region of interest
   for (auto& otherSPCol : otherSPsNeighbours) {
     const std::vector<const external_spacepoint_t*>& otherSPs =
         grid.at(otherSPCol.index);
@@ -293,183 +298,173 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::getCompatibleDoublets(
       const external_spacepoint_t* otherSP = *min_itr;
 
       if constexpr (isBottomCandidate) {
-        deltaR = (rM - otherSP->radius());
-
         // if r-distance is too small, try next SP in bin
-        if (deltaR < deltaRMinSP) {
+        if ((rM - otherSP->radius()) < deltaRMinSP) {
           break;
         }
       } else {
-        deltaR = (otherSP->radius() - rM);
-
         // if r-distance is too big, try next SP in bin
-        if (deltaR > deltaRMaxSP) {
+        if ((otherSP->radius() - rM) > deltaRMaxSP) {
           break;
         }
       }
 
-      if constexpr (isBottomCandidate) {
-        deltaZ = (zM - otherSP->z());
-      } else {
-        deltaZ = (otherSP->z() - zM);
-      }
+      candidates.push_back(*otherSP);
+    }
+  }
 
-      // the longitudinal impact parameter zOrigin is defined as (zM - rM *
-      // cotTheta) where cotTheta is the ratio Z/R (forward angle) of space
-      // point duplet but instead we calculate (zOrigin * deltaR) and multiply
-      // collisionRegion by deltaR to avoid divisions
-      const float zOriginTimesDeltaR = (zM * deltaR - rM * deltaZ);
-      // check if duplet origin on z axis within collision region
-      if (zOriginTimesDeltaR < m_config.collisionRegionMin * deltaR ||
-          zOriginTimesDeltaR > m_config.collisionRegionMax * deltaR) {
-        continue;
-      }
+  if (candidates.size() == 0) {
+    return;
+  }
+  candidates.pad();
+
+  // Apply all cuts which do not need the variances to a fixed number of
+  // candidates at a time. There are no branches and no reads through the
+  // space points in this loop, so the compiler can vectorize it. The
+  // configuration is copied first, as the stores to the mask could alias it.
+  const float collisionRegionMin = m_config.collisionRegionMin;
+  const float collisionRegionMax = m_config.collisionRegionMax;
+  const float cotThetaMax = m_config.cotThetaMax;
+  const float deltaZMax = m_config.deltaZMax;
+  const float minHelixDiameter2 = options.minHelixDiameter2;
+  const bool interactionPointCut = m_config.interactionPointCut;
+  const float* xs = candidates.x.data();
+  const float* ys = candidates.y.data();
+  const float* zs = candidates.z.data();
+  const float* rs = candidates.r.data();
+  std::int32_t* compatible = candidates.compatible.data();
+
+  constexpr std::size_t lanes =
+      DoubletCandidates<external_spacepoint_t>::s_lanes;
+  auto checkDoublets = [&]<bool withInteractionPointCut>() {
+    for (std::size_t first = 0; first < candidates.size(); first += lanes) {
+      for (std::size_t lane = 0; lane < lanes; ++lane) {
+        const std::size_t i = first + lane;
+
+        float deltaR = rs[i] - rM;
+        float deltaZ = zs[i] - zM;
+        if constexpr (isBottomCandidate) {
+          deltaR = rM - rs[i];
+          deltaZ = zM - zs[i];
+        }
+
+        // the longitudinal impact parameter zOrigin is defined as (zM - rM *
+        // cotTheta) where cotTheta is the ratio Z/R (forward angle) of space
+        // point duplet but instead we calculate (zOrigin * deltaR) and
+        // multiply collisionRegion by deltaR to avoid divisions
+        const float zOriginTimesDeltaR = (zM * deltaR - rM * deltaZ);
+        // check if duplet origin on z axis within collision region
+        bool pass = !(zOriginTimesDeltaR < collisionRegionMin * deltaR) &
+                    !(zOriginTimesDeltaR > collisionRegionMax * deltaR);
 
-      // if interactionPointCut is false we apply z cuts before coordinate
-      // transformation to avoid unnecessary calculations. If
-      // interactionPointCut is true we apply the curvature cut first because it
-      // is more frequent but requires the coordinate transformation
-      if (!m_config.interactionPointCut) {
         // check if duplet cotTheta is within the region of interest
         // cotTheta is defined as (deltaZ / deltaR) but instead we multiply
         // cotThetaMax by deltaR to avoid division
-        if (deltaZ > m_config.cotThetaMax * deltaR ||
-            deltaZ < -m_config.cotThetaMax * deltaR) {
-          continue;
-        }
-        // if z-distance between SPs is within max and min values
-        if (deltaZ > m_config.deltaZMax || deltaZ < -m_config.deltaZMax) {
-          continue;
+        pass &= !(deltaZ > cotThetaMax * deltaR) &
+                !(deltaZ < -cotThetaMax * deltaR);
+
+        if constexpr (!withInteractionPointCut) {
+          // if z-distance between SPs is within max and min values
+          pass &= !(deltaZ > deltaZMax) & !(deltaZ < -deltaZMax);
+          compatible[i] = pass;
+        } else {
+          // transform SP coordinates to the u-v reference frame
+          const float deltaX = xs[i] - xM;
+          const float deltaY = ys[i] - yM;
+
+          const float xNewFrame = deltaX * cosPhiM + deltaY * sinPhiM;
+          const float yNewFrame = deltaY * cosPhiM - deltaX * sinPhiM;
+
+          const float deltaR2 = (deltaX * deltaX + deltaY * deltaY);
+          // same result as the division in double precision below
+          const float iDeltaR2 = 1.f / deltaR2;
+
+          const float uT = xNewFrame * iDeltaR2;
+          const float vT = yNewFrame * iDeltaR2;
+
+          // candidates with a small impact parameter pass without the
+          // curvature cut
+          const bool smallImpact =
+              std::abs(rM * yNewFrame) <= impactMax * xNewFrame;
+
+          // in the rotated frame the interaction point is positioned at x =
+          // -rM and y ~= impactParam
+          const float vIP = (yNewFrame > 0.f) ? -vIPAbs : vIPAbs;
+
+          // we can obtain aCoef as the slope dv/du of the linear function,
+          // estimated using du and dv between the two SP bCoef is obtained by
+          // inserting aCoef into the linear equation
+          const float aCoef = (vT - vIP) / (uT - uIP);
+          const float bCoef = vIP - aCoef * uIP;
+          // the distance of the straight line from the origin (radius of the
+          // circle) is related to aCoef and bCoef by d^2 = bCoef^2 / (1 +
+          // aCoef^2) = 1 / (radius^2) and we can apply the cut on the
+          // curvature
+          const bool largeRadius =
+              !((bCoef * bCoef) * minHelixDiameter2 > (1 + aCoef * aCoef));
+
+          compatible[i] = pass & (smallImpact | largeRadius);
         }
-
-        // transform SP coordinates to the u-v reference frame
-        const float deltaX = otherSP->x() - xM;
-        const float deltaY = otherSP->y() - yM;
-
-        const float xNewFrame = deltaX * cosPhiM + deltaY * sinPhiM;
-        const float yNewFrame = deltaY * cosPhiM - deltaX * sinPhiM;
-
-        const float deltaR2 = (deltaX * deltaX + deltaY * deltaY);
-        const float iDeltaR2 = 1. / deltaR2;
-
-        const float uT = xNewFrame * iDeltaR2;
-        const float vT = yNewFrame * iDeltaR2;
-
-        const float iDeltaR = std::sqrt(iDeltaR2);
-        const float cotTheta = deltaZ * iDeltaR;
-
-        const float Er =
-            ((varianceZM + otherSP->varianceZ()) +
-             (cotTheta * cotTheta) * (varianceRM + otherSP->varianceR())) *
-            iDeltaR2;
-
-        // fill output vectors
-        linCircleVec.emplace_back(cotTheta, iDeltaR, Er, uT, vT, xNewFrame,
-                                  yNewFrame);
-
-        mutableData.setDeltaR(otherSP->index(),
-                              std::sqrt(deltaR2 + (deltaZ * deltaZ)));
-        outVec.push_back(otherSP);
-        continue;
       }
+    }
+  };
+  if (interactionPointCut) {
+    checkDoublets.template operator()<true>();
+  } else {
+    checkDoublets.template operator()<false>();
+  }
 
-      // transform SP coordinates to the u-v reference frame
-      const float deltaX = otherSP->x() - xM;
-      const float deltaY = otherSP->y() - yM;
+  linCircleVec.reserve(candidates.size());
+  outVec.reserve(candidates.size());
 
-      const float xNewFrame = deltaX * cosPhiM + deltaY * sinPhiM;
-      const float yNewFrame = deltaY * cosPhiM - deltaX * sinPhiM;
+  // transform the compatible candidates to the u-v reference frame
+  for (std::size_t i = 0; i < candidates.size(); ++i) {
+    if (!compatible[i]) {
+      continue;
+    }
+    const external_spacepoint_t* otherSP = candidates.spacePoints[i];
 
-      const float deltaR2 = (deltaX * deltaX + deltaY * deltaY);
-      const float iDeltaR2 = 1. / deltaR2;
+    float deltaZ = zs[i] - zM;
+    if constexpr (isBottomCandidate) {
+      deltaZ = zM - zs[i];
+    }
 
-      const float uT = xNewFrame * iDeltaR2;
-      const float vT = yNewFrame * iDeltaR2;
+    const float deltaX = xs[i] - xM;
+    const float deltaY = ys[i] - yM;
 
-      // interactionPointCut == true we apply this cut first cuts before
-      // coordinate transformation to avoid unnecessary calculations
-      if (std::abs(rM * yNewFrame) <= impactMax * xNewFrame) {
-        // check if duplet cotTheta is within the region of interest
-        // cotTheta is defined as (deltaZ / deltaR) but instead we multiply
-        // cotThetaMax by deltaR to avoid division
-        if (deltaZ > m_config.cotThetaMax * deltaR ||
-            deltaZ < -m_config.cotThetaMax * deltaR) {
-          continue;
-        }
+    const float xNewFrame = deltaX * cosPhiM + deltaY * sinPhiM;
+    const float yNewFrame = deltaY * cosPhiM - deltaX * sinPhiM;
 
-        const float iDeltaR = std::sqrt(iDeltaR2);
-        const float cotTheta = deltaZ * iDeltaR;
+    const float deltaR2 = (deltaX * deltaX + deltaY * deltaY);
+    const float iDeltaR2 = 1. / deltaR2;
 
-        // discard bottom-middle dublets in a certain (r, eta) region according
-        // to detector specific cuts
-        if constexpr (isBottomCandidate) {
-          if (!m_config.experimentCuts(otherSP->radius(), cotTheta)) {
-            continue;
-          }
-        }
+    const float uT = xNewFrame * iDeltaR2;
+    const float vT = yNewFrame * iDeltaR2;
 
-        const float Er =
-            ((varianceZM + otherSP->varianceZ()) +
-             (cotTheta * cotTheta) * (varianceRM + otherSP->varianceR())) *
-            iDeltaR2;
-
-        // fill output vectors
-        linCircleVec.emplace_back(cotTheta, iDeltaR, Er, uT, vT, xNewFrame,
-                                  yNewFrame);
-        mutableData.setDeltaR(otherSP->index(),
-                              std::sqrt(deltaR2 + (deltaZ * deltaZ)));
-        outVec.emplace_back(otherSP);
-        continue;
-      }
+    const float iDeltaR = std::sqrt(iDeltaR2);
+    const float cotTheta = deltaZ * iDeltaR;
 
-      // in the rotated frame the interaction point is positioned at x = -rM
-      // and y ~= impactParam
-      const float vIP = (yNewFrame > 0.) ? -vIPAbs : vIPAbs;
-
-      // we can obtain aCoef as the slope dv/du of the linear function,
-      // estimated using du and dv between the two SP bCoef is obtained by
-      // inserting aCoef into the linear equation
-      const float aCoef = (vT - vIP) / (uT - uIP);
-      const float bCoef = vIP - aCoef * uIP;
-      // the distance of the straight line from the origin (radius of the
-      // circle) is related to aCoef and bCoef by d^2 = bCoef^2 / (1 +
-      // aCoef^2) = 1 / (radius^2) and we can apply the cut on the curvature
-      if ((bCoef * bCoef) * options.minHelixDiameter2 > (1 + aCoef * aCoef)) {
+    // discard bottom-middle dublets in a certain (r, eta) region according
+    // to detector specific cuts
+    if constexpr (isBottomCandidate) {
+      if (interactionPointCut &&
+          !m_config.experimentCuts(otherSP->radius(), cotTheta)) {
         continue;
       }
+    }
 
-      // check if duplet cotTheta is within the region of interest
-      // cotTheta is defined as (deltaZ / deltaR) but instead we multiply
-      // cotThetaMax by deltaR to avoid division
-      if (deltaZ > m_config.cotThetaMax * deltaR ||
-          deltaZ < -m_config.cotThetaMax * deltaR) {
-        continue;
-      }
-
-      const float iDeltaR = std::sqrt(iDeltaR2);
-      const float cotTheta = deltaZ * iDeltaR;
-
-      // discard bottom-middle dublets in a certain (r, eta) region according
-      // to detector specific cuts
-      if constexpr (isBottomCandidate) {
-        if (!m_config.experimentCuts(otherSP->radius(), cotTheta)) {
-          continue;
-        }
-      }
-
-      const float Er =
-          ((varianceZM + otherSP->varianceZ()) +
-           (cotTheta * cotTheta) * (varianceRM + otherSP->varianceR())) *
-          iDeltaR2;
+    const float Er =
+        ((varianceZM + otherSP->varianceZ()) +
+         (cotTheta * cotTheta) * (varianceRM + otherSP->varianceR())) *
+        iDeltaR2;
 
-      // fill output vectors
-      linCircleVec.emplace_back(cotTheta, iDeltaR, Er, uT, vT, xNewFrame,
-                                yNewFrame);
+    // fill output vectors
+    linCircleVec.emplace_back(cotTheta, iDeltaR, Er, uT, vT, xNewFrame,
+                              yNewFrame);
 
-      mutableData.setDeltaR(otherSP->index(),
-                            std::sqrt(deltaR2 + (deltaZ * deltaZ)));
-      outVec.emplace_back(otherSP);
-    }
+    mutableData.setDeltaR(otherSP->index(),
+                          std::sqrt(deltaR2 + (deltaZ * deltaZ)));
+    outVec.emplace_back(otherSP);
   }
 }
 
@@ -488,25 +483,38 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCandidates(
   std::size_t numTopSP = state.compatTopSP.size();
 
   // sort: make index vector
-  std::vector<std::size_t> sorted_bottoms(state.linCircleBottom.size());
+  std::vector<std::size_t>& sorted_bottoms = state.sortedBottoms;
+  sorted_bottoms.resize(state.linCircleBottom.size());
   for (std::size_t i(0); i < sorted_bottoms.size(); ++i) {
     sorted_bottoms[i] = i;
   }
 
-  std::vector<std::size_t> sorted_tops(state.linCircleTop.size());
+  std::vector<std::size_t>& sorted_tops = state.sortedTops;
+  sorted_tops.resize(state.linCircleTop.size());
   for (std::size_t i(0); i < sorted_tops.size(); ++i) {
     sorted_tops[i] = i;
   }
 
   if constexpr (detailedMeasurement ==
                 Acts::DetectorMeasurementInfo::eDefault) {
-    std::ranges::sort(sorted_bottoms, {}, [&state](const std::size_t s) {
-      return state.linCircleBottom[s].cotTheta;
-    });
+    // The cotTheta values are sorted together with the indices, which avoids
+    // the indirection in the comparisons. The comparisons are the same, so
+    // the order is the same as when sorting the indices alone.
+    auto sortByCotTheta = [&state](const std::vector<LinCircle>& linCircles,
+                                   std::vector<std::size_t>& sorted) {
+      auto& keys = state.cotThetaSortKeys;
+      keys.clear();
+      for (std::size_t i = 0; i < linCircles.size(); ++i) {
+        keys.emplace_back(linCircles[i].cotTheta, i);
+      }
+      std::ranges::sort(keys, {}, &std::pair<float, std::size_t>::first);
+      for (std::size_t i = 0; i < keys.size(); ++i) {
+        sorted[i] = keys[i].second;
+      }
+    };
 
-    std::ranges::sort(sorted_tops, {}, [&state](const std::size_t s) {
-      return state.linCircleTop[s].cotTheta;
-    });
+    sortByCotTheta(state.linCircleBottom, sorted_bottoms);
+    sortByCotTheta(state.linCircleTop, sorted_tops);
   }
 
   // Reserve enough space, in case current capacity is too little
@@ -823,7 +831,7 @@ SeedFinder<external_spacepoint_t, grid_t, platform_t>::filterCandidates(
     m_config.seedFilter->filterSeeds_2SpFixed(
         state.spacePointMutableData, *state.compatBottomSP[b], spM,
         state.topSpVec, state.curvatures, state.impactParameters,
-        seedFilterState, state.candidates_collector);
+        seedFilterState, state.candidates_collector, state.seedFilterScratch);
   }  // loop on bottoms
 }
 
@@ -11,6 +11,10 @@
 #include "Acts/EventData/SpacePointMutableData.hpp"
 #include "Acts/Seeding/SeedFinderConfig.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace Acts {
 /// @brief A partial description of a circle in u-v space.
 struct LinCircle {
@@ -27,6 +31,73 @@ struct LinCircle {
   float y{0.};
 };
 
+/// @brief Doublet candidates of a middle space point with their coordinates
+/// packed into contiguous arrays.
+///
+/// The doublet cuts are evaluated on these arrays for a fixed number of
+/// candidates at a time, which lets the compiler vectorize them, instead of
+/// reading the coordinates through each candidate space point.
+///
+/// @tparam external_spacepoint_t The external spacepoint type.
+template <typename external_spacepoint_t>
+struct DoubletCandidates {
+  /// Number of candidates which are checked together
+  static constexpr std::size_t s_lanes = 8;
+
+  std::vector<const external_spacepoint_t*> spacePoints;
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  std::vector<float> r;
+  /// Whether the candidate passes the doublet cuts
+  std::vector<std::int32_t> compatible;
+
+  /// @return the number of candidates, without padding
+  std::size_t size() const { return m_size; }
+
+  /// Remove all candidates and make room for up to @p n new ones
+  void reset(std::size_t n) {
+    m_size = 0;
+    const std::size_t padded = (n + s_lanes - 1) / s_lanes * s_lanes;
+    if (x.size() < padded) {
+      spacePoints.resize(padded);
+      x.resize(padded);
+      y.resize(padded);
+      z.resize(padded);
+      r.resize(padded);
+      compatible.resize(padded);
+    }
+  }
+
+  /// Add a candidate, there must be room for it
+  void push_back(const external_spacepoint_t& sp) {
+    spacePoints[m_size] = &sp;
+    x[m_size] = sp.x();
+    y[m_size] = sp.y();
+    z[m_size] = sp.z();
+    r[m_size] = sp.radius();
+    ++m_size;
+  }
+
+  /// Pad the coordinates to a multiple of @c s_lanes by repeating the last
+  /// candidate, so that the padding does not produce new floating point
+  /// exceptions in the cuts
+  void pad() {
+    if (m_size == 0) {
+      return;
+    }
+    for (std::size_t i = m_size; i % s_lanes != 0; ++i) {
+      x[i] = x[m_size - 1];
+      y[i] = y[m_size - 1];
+      z[i] = z[m_size - 1];
+      r[i] = r[m_size - 1];
+    }
+  }
+
+ private:
+  std::size_t m_size = 0;
+};
+
 template <typename external_spacepoint_t, typename callable_t>
 LinCircle transformCoordinates(Acts::SpacePointMutableData& mutableData,
                                const external_spacepoint_t& sp,
@@ -16,6 +16,7 @@
 #include "Acts/EventData/MultiTrajectoryHelpers.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/TransformationHelpers.hpp"
 #include "Acts/EventData/Types.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
@@ -30,7 +31,9 @@
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/detail/periodic.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -113,6 +116,27 @@ using SourceLinkAccessorDelegate =
 ///       the number is chosen to yield a container size of 64 bytes.
 static constexpr std::size_t s_maxBranchesPerSurface = 10;
 
+/// Propagation statistics of the combinatorial Kalman filter
+struct CombinatorialKalmanFilterStatistics {
+  /// Number of propagation steps
+  std::size_t steps = 0;
+  /// Number of steps which were shared by several branches in breadth-first
+  /// mode, i.e. roughly the number of steps which depth-first processing
+  /// would have repeated to propagate the branches one after the other
+  std::size_t savedSteps = 0;
+  /// Number of branches which were removed by the beam width or the chi2
+  /// pruning in breadth-first mode
+  std::size_t prunedBranches = 0;
+
+  CombinatorialKalmanFilterStatistics& operator+=(
+      const CombinatorialKalmanFilterStatistics& other) {
+    steps += other.steps;
+    savedSteps += other.savedSteps;
+    prunedBranches += other.prunedBranches;
+    return *this;
+  }
+};
+
 namespace CkfTypes {
 
 template <typename T>
@@ -225,6 +249,37 @@ struct CombinatorialKalmanFilterOptions {
   /// Skip the pre propagation call. This effectively skips the first surface
   /// @note This is useful if the first surface should not be considered in a second reverse pass
   bool skipPrePropagationUpdate = false;
+
+  /// Optional track state components to store for the found tracks.
+  ///
+  /// Only @c TrackStatePropMask::Jacobian is optional. The transport
+  /// Jacobians are only needed to smooth the found tracks, e.g. with
+  /// @c Acts::smoothTrack. They can be dropped if the tracks are refitted or
+  /// not smoothed at all, which saves a bound matrix per track state.
+  TrackStatePropMask optionalTrackStateComponents =
+      TrackStatePropMask::Jacobian;
+
+  /// Advance all branches of a track together, surface by surface, instead
+  /// of following one branch to its end before going back to the next one.
+  ///
+  /// Only the best branch is propagated. The other branches are transported
+  /// along with it using its transport Jacobian, which is exact to first
+  /// order in the parameter differences of the branches. This saves the
+  /// propagation of the same geometry for every branch, at the cost of a
+  /// linearisation error for branches which differ a lot from the best one.
+  bool breadthFirst = false;
+
+  /// Maximum number of active branches in breadth-first mode. The branches
+  /// with the most measurements and, among those, the lowest chi2 are kept.
+  std::size_t beamWidth = std::numeric_limits<std::size_t>::max();
+
+  /// Branches with a chi2 larger than the chi2 of the best branch plus this
+  /// value are dropped in breadth-first mode.
+  double maxBranchChi2Difference = std::numeric_limits<double>::infinity();
+
+  /// Optional statistics to which the statistics of every track finding run
+  /// are added
+  CombinatorialKalmanFilterStatistics* statistics = nullptr;
 };
 
 template <typename track_container_t>
@@ -249,6 +304,26 @@ struct CombinatorialKalmanFilterResult {
   /// Track state candidates buffer
   std::vector<TrackStateProxy> trackStateCandidates;
 
+  /// Difference of the bound parameters and covariance of an active branch
+  /// to the propagated branch in breadth-first mode
+  struct BranchOffset {
+    BoundVector parameters = BoundVector::Zero();
+    BoundSquareMatrix covariance = BoundSquareMatrix::Zero();
+  };
+
+  /// Offsets of the active branches in breadth-first mode
+  std::vector<BranchOffset> activeBranchOffsets;
+
+  /// Active branches before the current surface in breadth-first mode
+  std::vector<TrackProxy> parentBranches;
+
+  /// Propagation step at the last surface with branches in breadth-first
+  /// mode
+  std::size_t lastBranchStep = 0;
+
+  /// Propagation statistics
+  CombinatorialKalmanFilterStatistics statistics;
+
   /// Indicator if track finding has been done
   bool finished = false;
 
@@ -314,6 +389,9 @@ class CombinatorialKalmanFilter {
     typename CombinatorialKalmanFilterExtensions<
         track_container_t>::MeasurementSelector measurementSelector;
 
+    /// Optional components to store for the selected track states
+    TrackStatePropMask optionalComponents = TrackStatePropMask::Jacobian;
+
     /// Create track states for selected measurements given by the source links
     ///
     /// @param gctx The current geometry context
@@ -355,8 +433,9 @@ class CombinatorialKalmanFilter {
         // get the source link
         const auto sourceLink = *it;
 
-        // prepare the track state
-        PM mask = PM::Predicted | PM::Jacobian | PM::Calibrated;
+        // prepare the track state, the Jacobian is only stored for the
+        // selected track states
+        PM mask = PM::Predicted | PM::Calibrated;
         if (it != slBegin) {
           // not the first TrackState, only need uncalibrated and calibrated
           mask = PM::Calibrated;
@@ -374,12 +453,10 @@ class CombinatorialKalmanFilter {
           if (boundParams.covariance()) {
             ts.predictedCovariance() = *boundParams.covariance();
           }
-          ts.jacobian() = jacobian;
         } else {
           // subsequent track states can reuse
           auto& first = trackStateCandidates.front();
           ts.shareFrom(first, PM::Predicted);
-          ts.shareFrom(first, PM::Jacobian);
         }
 
         ts.pathLength() = pathLength;
@@ -405,7 +482,7 @@ class CombinatorialKalmanFilter {
         auto selectedTrackStateRange = *selectorResult;
         resultTrackStateList = processSelectedTrackStates(
             selectedTrackStateRange.first, selectedTrackStateRange.second,
-            trajectory, isOutlier, logger);
+            jacobian, trajectory, isOutlier, logger);
       }
 
       return resultTrackStateList;
@@ -415,14 +492,15 @@ class CombinatorialKalmanFilter {
     ///
     /// @param begin begin iterator of the list of candidate track states
     /// @param end end iterator of the list of candidate track states
+    /// @param jacobian the transport Jacobian to the surface of the candidates
     /// @param trackStates the trajectory to which the new track states are added
     /// @param isOutlier true if the candidate(s) is(are) an outlier(s).
     /// @param logger the logger for messages
     Result<CkfTypes::BranchVector<TrackIndexType>> processSelectedTrackStates(
         typename std::vector<TrackStateProxy>::const_iterator begin,
         typename std::vector<TrackStateProxy>::const_iterator end,
-        TrackStateContainerBackend& trackStates, bool isOutlier,
-        const Logger& logger) const {
+        const BoundMatrix& jacobian, TrackStateContainerBackend& trackStates,
+        bool isOutlier, const Logger& logger) const {
       using PM = TrackStatePropMask;
 
       using ResultTrackStateList =
@@ -437,7 +515,9 @@ class CombinatorialKalmanFilter {
       for (auto it = begin; it != end; ++it) {
         auto& candidateTrackState = *it;
 
-        PM mask = PM::Predicted | PM::Filtered | PM::Jacobian | PM::Calibrated;
+        PM mask = PM::Predicted | PM::Filtered | PM::Calibrated |
+                  (optionalComponents & PM::Jacobian);
+        const bool storeJacobian = ACTS_CHECK_BIT(mask, PM::Jacobian);
         if (it != begin) {
           // subsequent track states don't need storage for these as they will
           // be shared
@@ -457,14 +537,20 @@ class CombinatorialKalmanFilter {
         if (it != begin) {
           // assign indices pointing to first track state
           trackState.shareFrom(*firstTrackState, PM::Predicted);
-          trackState.shareFrom(*firstTrackState, PM::Jacobian);
+          if (storeJacobian) {
+            trackState.shareFrom(*firstTrackState, PM::Jacobian);
+          }
         } else {
           firstTrackState = trackState;
+          if (storeJacobian) {
+            trackState.jacobian() = jacobian;
+          }
         }
 
-        // either copy ALL or everything except for predicted and jacobian
+        // either copy ALL or everything except for predicted, the candidates
+        // do not carry a jacobian
         trackState.allocateCalibrated(candidateTrackState.calibratedSize());
-        trackState.copyFrom(candidateTrackState, mask, false);
+        trackState.copyFrom(candidateTrackState, mask & ~PM::Jacobian, false);
 
         auto typeFlags = trackState.typeFlags();
         typeFlags.set(TrackStateFlag::ParameterFlag);
@@ -515,6 +601,19 @@ class CombinatorialKalmanFilter {
     /// Skip the pre propagation call. This effectively skips the first surface
     bool skipPrePropagationUpdate = false;
 
+    /// Optional components to store for the track states
+    TrackStatePropMask optionalComponents = TrackStatePropMask::Jacobian;
+
+    /// Whether to advance all branches together
+    bool breadthFirst = false;
+
+    /// Maximum number of active branches in breadth-first mode
+    std::size_t beamWidth = std::numeric_limits<std::size_t>::max();
+
+    /// Maximum chi2 difference of a branch to the best branch in
+    /// breadth-first mode
+    double maxBranchChi2Difference = std::numeric_limits<double>::infinity();
+
     /// Calibration context for the finding run
     const CalibrationContext* calibrationContextPtr{nullptr};
 
@@ -574,7 +673,10 @@ class CombinatorialKalmanFilter {
         // 3) The surface is neither in the measurement map nor with material
         // -> Do nothing
         ACTS_VERBOSE("Perform filter step");
-        auto res = filter(surface, state, stepper, navigator, result);
+        auto res =
+            breadthFirst
+                ? filterBreadthFirst(surface, state, stepper, navigator, result)
+                : filter(surface, state, stepper, navigator, result);
         if (!res.ok()) {
           ACTS_ERROR("Error in filter: " << res.error());
           result.lastError = res.error();
@@ -607,6 +709,22 @@ class CombinatorialKalmanFilter {
             ACTS_ERROR("Error while acquiring bound state for target surface: "
                        << res.error() << " " << res.error().message());
             result.lastError = res.error();
+          } else if (breadthFirst) {
+            // All branches end on the target surface
+            const auto& [boundParams, jacobian, pathLength] = *res;
+            for (std::size_t i = 0; i < result.activeBranches.size(); ++i) {
+              auto branch = result.activeBranches[i];
+              const auto& offset = result.activeBranchOffsets[i];
+              branch.parameters() =
+                  boundParams.parameters() + jacobian * offset.parameters;
+              branch.parameters()[eBoundPhi] =
+                  detail::radian_sym(branch.parameters()[eBoundPhi]);
+              branch.covariance() =
+                  *boundParams.covariance() +
+                  jacobian * offset.covariance * jacobian.transpose();
+              branch.setReferenceSurface(
+                  boundParams.referenceSurface().getSharedPtr());
+            }
           } else {
             const auto& [boundParams, jacobian, pathLength] = *res;
             auto currentBranch = result.activeBranches.back();
@@ -620,7 +738,14 @@ class CombinatorialKalmanFilter {
           stepper.releaseStepSize(state.stepping, ConstrainedStep::actor);
         }
 
-        if (!allBranchesStopped) {
+        if (!allBranchesStopped && breadthFirst) {
+          // Record all branches, which are already sorted by quality
+          countSharedSteps(state, result);
+          for (const auto& branch : result.activeBranches) {
+            storeBranch(result, branch);
+          }
+          result.activeBranches.clear();
+        } else if (!allBranchesStopped) {
           // Record the active branch and remove it from the list
           storeLastActiveBranch(result);
           result.activeBranches.pop_back();
@@ -766,7 +891,8 @@ class CombinatorialKalmanFilter {
           // still counts as a branch
           nBranchesOnSurface = 1;
 
-          auto stateMask = PM::Predicted | PM::Jacobian;
+          auto stateMask =
+              PM::Predicted | (optionalComponents & PM::Jacobian);
 
           // Add a hole track state to the multitrajectory
           TrackIndexType currentTip = addNonSourcelinkState(
@@ -855,7 +981,7 @@ class CombinatorialKalmanFilter {
         // No source links on surface, add either hole or passive material
         // TrackState. No storage allocation for uncalibrated/calibrated
         // measurement and filtered parameter
-        auto stateMask = PM::Predicted | PM::Jacobian;
+        auto stateMask = PM::Predicted | (optionalComponents & PM::Jacobian);
 
         // Transport the covariance to a curvilinear surface
         stepper.transportCovarianceToCurvilinear(state.stepping);
@@ -927,6 +1053,219 @@ class CombinatorialKalmanFilter {
       return Result<void>::success();
     }
 
+    /// @brief CombinatorialKalmanFilter actor operation: breadth-first
+    /// filtering of all active branches on a surface
+    ///
+    /// The stepper follows the first active branch. The other branches are
+    /// described by their offsets to it, which are transported with the
+    /// Jacobian of the propagated branch. All branches are updated on every
+    /// surface, ranked by their number of measurements and chi2, and pruned.
+    /// The stepper is then updated with the filtered state of the best branch.
+    ///
+    /// @tparam propagator_state_t Type of the Propagator state
+    /// @tparam stepper_t Type of the stepper
+    /// @tparam navigator_t Type of the navigator
+    ///
+    /// @param surface The surface where the update happens
+    /// @param state The mutable propagator state object
+    /// @param stepper The stepper in use
+    /// @param navigator The navigator in use
+    /// @param result The mutable result state object
+    template <typename propagator_state_t, typename stepper_t,
+              typename navigator_t>
+    Result<void> filterBreadthFirst(const Surface* surface,
+                                    propagator_state_t& state,
+                                    const stepper_t& stepper,
+                                    const navigator_t& navigator,
+                                    result_type& result) const {
+      using PM = TrackStatePropMask;
+
+      const bool isSensitive = surface->associatedDetectorElement() != nullptr;
+      const bool isMaterial = surface->surfaceMaterial() != nullptr;
+
+      auto [slBegin, slEnd] = m_sourceLinkAccessor(*surface);
+      const bool hasMeasurements = slBegin != slEnd;
+      if (!hasMeasurements && !isSensitive && !isMaterial) {
+        return Result<void>::success();
+      }
+
+      ACTS_VERBOSE("Breadth-first filter step with "
+                   << result.activeBranches.size() << " branches on surface "
+                   << surface->geometryId());
+
+      countSharedSteps(state, result);
+
+      // Transport the covariance of the propagated branch to the surface. The
+      // Jacobian of this transport also moves the offsets of the other
+      // branches.
+      stepper.transportCovarianceToBound(state.stepping, *surface);
+
+      // Update state and stepper with pre material effects
+      materialInteractor(surface, state, stepper, navigator,
+                         MaterialUpdateStage::PreUpdate);
+
+      auto boundStateRes = stepper.boundState(state.stepping, *surface, false);
+      if (!boundStateRes.ok()) {
+        return boundStateRes.error();
+      }
+      const auto& [boundParams, jacobian, pathLength] = *boundStateRes;
+      const BoundSquareMatrix leadCovariance = state.stepping.cov;
+
+      // Process the branches in their order of quality
+      std::swap(result.parentBranches, result.activeBranches);
+      result.activeBranches.clear();
+      for (std::size_t i = 0; i < result.parentBranches.size(); ++i) {
+        auto& offset = result.activeBranchOffsets[i];
+        offset.parameters = jacobian * offset.parameters;
+        offset.covariance = jacobian * offset.covariance * jacobian.transpose();
+
+        BoundVector parameters = boundParams.parameters() + offset.parameters;
+        parameters[eBoundPhi] = detail::radian_sym(parameters[eBoundPhi]);
+        BoundState boundState(
+            BoundTrackParameters(surface->getSharedPtr(), parameters,
+                                 leadCovariance + offset.covariance,
+                                 boundParams.particleHypothesis()),
+            jacobian, pathLength);
+
+        auto currentBranch = result.parentBranches[i];
+        TrackIndexType prevTip = currentBranch.tipIndex();
+
+        CkfTypes::BranchVector<TrackIndexType> newTrackStateList;
+        if (hasMeasurements) {
+          auto tsRes = trackStateCandidateCreator(
+              state.geoContext, *calibrationContextPtr, *surface, boundState,
+              slBegin, slEnd, prevTip, *result.trackStates,
+              result.trackStateCandidates, *result.trackStates, logger());
+          if (!tsRes.ok()) {
+            ACTS_ERROR("Processing of selected track states failed: "
+                       << tsRes.error());
+            return tsRes.error();
+          }
+          newTrackStateList = std::move(*tsRes);
+        }
+
+        result.activeBranches.push_back(currentBranch);
+        if (!newTrackStateList.empty()) {
+          Result<unsigned int> procRes = processNewTrackStates(
+              state.geoContext, newTrackStateList, result);
+          if (!procRes.ok()) {
+            ACTS_ERROR("Processing of selected track states failed: "
+                       << procRes.error());
+            return procRes.error();
+          }
+          continue;
+        }
+
+        // Add a hole or material track state to the multitrajectory
+        const bool isHole = hasMeasurements || isSensitive;
+        auto stateMask = PM::Predicted | (optionalComponents & PM::Jacobian);
+        TrackIndexType currentTip = addNonSourcelinkState(
+            stateMask, boundState, result, isHole, prevTip);
+        auto nonSourcelinkState = result.trackStates->getTrackState(currentTip);
+        currentBranch.tipIndex() = currentTip;
+        if (isHole) {
+          currentBranch.nHoles()++;
+        }
+
+        BranchStopperResult branchStopperResult =
+            m_extensions.branchStopper(currentBranch, nonSourcelinkState);
+        if (branchStopperResult != BranchStopperResult::Continue) {
+          if (branchStopperResult == BranchStopperResult::StopAndKeep) {
+            storeLastActiveBranch(result);
+          }
+          result.activeBranches.pop_back();
+        }
+      }
+      result.parentBranches.clear();
+
+      pruneBranches(result);
+
+      if (result.activeBranches.empty()) {
+        ACTS_VERBOSE("All branches on surface " << surface->geometryId()
+                                                << " have been stopped");
+        ACTS_VERBOSE("Stop Kalman filtering with "
+                     << result.collectedTracks.size() << " found tracks");
+        result.activeBranchOffsets.clear();
+        result.finished = true;
+        return Result<void>::success();
+      }
+
+      // Continue with the best branch and describe the others relative to it.
+      // Hole and material states have no filtered component, `parameters()`
+      // and `covariance()` fall back to the predicted one for them.
+      auto leadState = result.activeBranches.front().outermostTrackState();
+      result.activeBranchOffsets.resize(result.activeBranches.size());
+      for (std::size_t i = 0; i < result.activeBranches.size(); ++i) {
+        auto branchState = result.activeBranches[i].outermostTrackState();
+        auto& offset = result.activeBranchOffsets[i];
+        offset.parameters = branchState.parameters() - leadState.parameters();
+        offset.parameters[eBoundPhi] =
+            detail::radian_sym(offset.parameters[eBoundPhi]);
+        offset.covariance =
+            branchState.covariance() - leadState.covariance();
+      }
+
+      stepper.update(state.stepping,
+                     transformBoundToFreeParameters(
+                         *surface, state.options.geoContext,
+                         leadState.parameters()),
+                     leadState.parameters(), leadState.covariance(),
+                     *surface);
+
+      // Update state and stepper with post material effects
+      materialInteractor(surface, state, stepper, navigator,
+                         MaterialUpdateStage::PostUpdate);
+
+      return Result<void>::success();
+    }
+
+    /// Rank the active branches by their number of measurements and chi2 and
+    /// remove the ones outside of the beam
+    ///
+    /// @param result The mutable result state object
+    void pruneBranches(result_type& result) const {
+      auto& branches = result.activeBranches;
+      std::ranges::stable_sort(branches, [](const auto& a, const auto& b) {
+        if (a.nMeasurements() != b.nMeasurements()) {
+          return a.nMeasurements() > b.nMeasurements();
+        }
+        return a.chi2() < b.chi2();
+      });
+
+      std::size_t nKeep = std::min(branches.size(), beamWidth);
+      if (nKeep > 0) {
+        const double maxChi2 =
+            branches.front().chi2() + maxBranchChi2Difference;
+        nKeep = std::distance(
+            branches.begin(),
+            std::stable_partition(
+                branches.begin(), branches.begin() + nKeep,
+                [&](const auto& branch) { return branch.chi2() <= maxChi2; }));
+      }
+
+      if (nKeep < branches.size()) {
+        ACTS_VERBOSE("Prune " << branches.size() - nKeep << " of "
+                              << branches.size() << " branches");
+        result.statistics.prunedBranches += branches.size() - nKeep;
+        branches.erase(branches.begin() + nKeep, branches.end());
+      }
+    }
+
+    /// Account the steps since the last surface with branches as shared by
+    /// all active branches
+    ///
+    /// @param state The propagator state object
+    /// @param result The mutable result state object
+    template <typename propagator_state_t>
+    void countSharedSteps(const propagator_state_t& state,
+                          result_type& result) const {
+      if (!result.activeBranches.empty()) {
+        result.statistics.savedSteps += (state.steps - result.lastBranchStep) *
+                                        (result.activeBranches.size() - 1);
+      }
+      result.lastBranchStep = state.steps;
+    }
+
     /// Process new, incompomplete track states and set the filtered state
     ///
     /// @note will process the given list of new states, run the updater
@@ -1045,7 +1384,9 @@ class CombinatorialKalmanFilter {
       // Fill the track state
       trackStateProxy.predicted() = boundParams.parameters();
       trackStateProxy.predictedCovariance() = boundParams.covariance().value();
-      trackStateProxy.jacobian() = jacobian;
+      if (ACTS_CHECK_BIT(stateMask, PM::Jacobian)) {
+        trackStateProxy.jacobian() = jacobian;
+      }
       trackStateProxy.pathLength() = pathLength;
       // Set the surface
       trackStateProxy.setReferenceSurface(
@@ -1130,7 +1471,11 @@ class CombinatorialKalmanFilter {
     }
 
     void storeLastActiveBranch(result_type& result) const {
-      auto currentBranch = result.activeBranches.back();
+      storeBranch(result, result.activeBranches.back());
+    }
+
+    void storeBranch(result_type& result,
+                     const TrackProxy& currentBranch) const {
       TrackIndexType currentTip = currentBranch.tipIndex();
 
       ACTS_VERBOSE("Storing track "
@@ -1241,6 +1586,10 @@ class CombinatorialKalmanFilter {
     combKalmanActor.energyLoss = tfOptions.energyLoss;
     combKalmanActor.skipPrePropagationUpdate =
         tfOptions.skipPrePropagationUpdate;
+    combKalmanActor.optionalComponents = tfOptions.optionalTrackStateComponents;
+    combKalmanActor.breadthFirst = tfOptions.breadthFirst;
+    combKalmanActor.beamWidth = tfOptions.beamWidth;
+    combKalmanActor.maxBranchChi2Difference = tfOptions.maxBranchChi2Difference;
     combKalmanActor.actorLogger = m_actorLogger.get();
     combKalmanActor.updaterLogger = m_updaterLogger.get();
     combKalmanActor.calibrationContextPtr = &tfOptions.calibrationContext.get();
@@ -1257,6 +1606,8 @@ class CombinatorialKalmanFilter {
       defaultTrackStateCreator.calibrator = tfOptions.extensions.calibrator;
       defaultTrackStateCreator.measurementSelector =
           tfOptions.extensions.measurementSelector;
+      defaultTrackStateCreator.optionalComponents =
+          tfOptions.optionalTrackStateComponents;
       combKalmanActor.trackStateCandidateCreator.template connect<
           &DefaultTrackStateCreator::template createSourceLinkTrackStates<
               source_link_iterator_t>>(&defaultTrackStateCreator);
@@ -1274,6 +1625,7 @@ class CombinatorialKalmanFilter {
     r.trackStates = &trackContainer.trackStateContainer();
 
     r.activeBranches.push_back(rootBranch);
+    r.activeBranchOffsets.emplace_back();
 
     auto propagationResult = m_propagator.propagate(propState);
 
@@ -1295,6 +1647,11 @@ class CombinatorialKalmanFilter {
         std::move(propRes.template get<
                   CombinatorialKalmanFilterResult<track_container_t>>());
 
+    combKalmanResult.statistics.steps = propRes.steps;
+    if (tfOptions.statistics != nullptr) {
+      *tfOptions.statistics += combKalmanResult.statistics;
+    }
+
     Result<void> error = combKalmanResult.lastError;
     if (error.ok() && !combKalmanResult.finished) {
       error = Result<void>(
@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <iterator>
 #include <limits>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -94,6 +95,26 @@ class MeasurementSelector {
   select(std::vector<typename traj_t::TrackStateProxy>& candidates,
          bool& isOutlier, const Logger& logger) const;
 
+  /// @brief Function that selects the compatible measurements on a surface
+  /// given their precomputed chi2
+  ///
+  /// This applies the same selection as @c select, but works on the chi2 of
+  /// measurements which were not turned into track states yet.
+  ///
+  /// @param geoID The surface of the measurements
+  /// @param theta The predicted theta on the surface
+  /// @param chi2 The chi2 of the measurement candidates
+  /// @param selected Output of the indices of the selected candidates ordered
+  ///        by increasing chi2. Must have the same size as @a chi2
+  /// @param isOutlier The indicator for outlier or not
+  /// @param logger The logger wrapper
+  ///
+  /// @return The number of selected candidates
+  Result<std::size_t> selectByChi2(const GeometryIdentifier& geoID,
+                                   double theta, std::span<const double> chi2,
+                                   std::span<std::size_t> selected,
+                                   bool& isOutlier, const Logger& logger) const;
+
  private:
   struct InternalCutBin {
     double maxTheta{};
@@ -0,0 +1,162 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Measurements of an event packed per surface into contiguous
+/// structure-of-arrays buffers
+///
+/// This is the input of the fast measurement selection path of the
+/// combinatorial Kalman filter, see @c PackedTrackStateCreator. The chi2 of
+/// all measurements on a surface is computed in one pass over these buffers,
+/// without calibrating the measurements into track states first.
+///
+/// One and two dimensional measurements, which are the vast majority, are
+/// stored in separate lanes with one array per component. Measurements of
+/// other dimensions are stored in a generic lane.
+///
+/// The measurements are added surface by surface, ordered by geometry
+/// identifier. The measurements of a surface have to be added in the order in
+/// which the source link accessor of the track finding returns them, the
+/// position of a measurement on its surface identifies its source link.
+class PackedMeasurements {
+ public:
+  /// Measurements of a single surface
+  struct SurfaceRange {
+    GeometryIdentifier geometryId;
+    /// Number of measurements on the surface
+    std::uint32_t size = 0;
+    /// Ranges in the one dimensional, two dimensional and generic lanes
+    std::uint32_t begin1 = 0;
+    std::uint32_t end1 = 0;
+    std::uint32_t begin2 = 0;
+    std::uint32_t end2 = 0;
+    std::uint32_t beginN = 0;
+    std::uint32_t endN = 0;
+    /// Whether the measurements were added in the order of the lanes, i.e.
+    /// their positions on the surface follow the lanes
+    bool laneOrdered = true;
+    /// Whether all one, respectively two, dimensional measurements measure
+    /// the same parameters
+    bool uniform1 = true;
+    bool uniform2 = true;
+  };
+
+  /// Add a measurement
+  ///
+  /// @param geometryId The surface of the measurement, which must not be
+  ///        smaller than the surface of the previous measurement
+  /// @param subspaceIndices The bound parameter indices which are measured
+  /// @param parameters The measured parameters
+  /// @param covariance The covariance of the measured parameters
+  ///
+  /// @throws std::invalid_argument if the surfaces are not ordered
+  template <typename subspace_t, typename parameters_t, typename covariance_t>
+  void add(GeometryIdentifier geometryId, const subspace_t& subspaceIndices,
+           const Eigen::MatrixBase<parameters_t>& parameters,
+           const Eigen::MatrixBase<covariance_t>& covariance) {
+    const std::size_t size = parameters.size();
+    assert(size >= 1 && size <= eBoundSize && "Invalid measurement size");
+
+    std::array<std::uint8_t, eBoundSize> indices{};
+    std::array<double, eBoundSize> values{};
+    std::array<double, eBoundSize * eBoundSize> variances{};
+    for (std::size_t i = 0; i < size; ++i) {
+      indices[i] = static_cast<std::uint8_t>(subspaceIndices[i]);
+      values[i] = parameters(i);
+      for (std::size_t j = 0; j < size; ++j) {
+        variances[i * size + j] = covariance(i, j);
+      }
+    }
+    add(geometryId, size, indices.data(), values.data(), variances.data());
+  }
+
+  /// Add a measurement from flat arrays
+  ///
+  /// @param geometryId The surface of the measurement
+  /// @param size The dimension of the measurement
+  /// @param subspaceIndices The @p size measured bound parameter indices
+  /// @param parameters The @p size measured parameters
+  /// @param covariance The row-major @p size x @p size covariance
+  void add(GeometryIdentifier geometryId, std::size_t size,
+           const std::uint8_t* subspaceIndices, const double* parameters,
+           const double* covariance);
+
+  /// Remove all measurements, but keep the allocated memory
+  void clear();
+
+  /// @return the number of measurements
+  std::size_t size() const;
+
+  /// @return the number of surfaces with measurements
+  std::size_t surfaces() const { return m_surfaces.size(); }
+
+  /// Find the measurements of a surface
+  ///
+  /// @param geometryId The surface identifier
+  /// @return the measurements of the surface, or nullptr if it has none
+  const SurfaceRange* find(GeometryIdentifier geometryId) const;
+
+  /// Compute the chi2 of all measurements of a surface
+  ///
+  /// @param range The measurements of the surface
+  /// @param predicted The predicted parameters on the surface
+  /// @param predictedCovariance The covariance of the predicted parameters
+  /// @param chi2 Output of the chi2 of every measurement, indexed by its
+  ///        position on the surface. Must have size @c range.size
+  void chi2(const SurfaceRange& range, const BoundVector& predicted,
+            const BoundSquareMatrix& predictedCovariance,
+            std::span<double> chi2) const;
+
+ private:
+  std::vector<SurfaceRange> m_surfaces;
+
+  // one dimensional lane
+  struct Lane1 {
+    std::vector<double> value;
+    std::vector<double> variance;
+    std::vector<std::uint8_t> index;
+    std::vector<std::uint32_t> position;
+  } m_lane1;
+
+  // two dimensional lane, with the symmetric covariance
+  struct Lane2 {
+    std::vector<double> value0;
+    std::vector<double> value1;
+    std::vector<double> variance00;
+    std::vector<double> variance01;
+    std::vector<double> variance11;
+    std::vector<std::uint8_t> index0;
+    std::vector<std::uint8_t> index1;
+    std::vector<std::uint32_t> position;
+  } m_lane2;
+
+  // generic lane, parameters and covariance are stored in a flat buffer
+  struct LaneN {
+    std::vector<std::uint8_t> size;
+    std::vector<std::array<std::uint8_t, eBoundSize>> indices;
+    std::vector<std::uint32_t> offset;
+    std::vector<std::uint32_t> position;
+    std::vector<double> data;
+  } m_laneN;
+};
+
+}  // namespace Acts
@@ -0,0 +1,202 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/Types.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
+#include "Acts/TrackFinding/CombinatorialKalmanFilterError.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/PackedMeasurements.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+namespace Acts {
+
+/// @brief Track state candidate creator for the combinatorial Kalman filter
+/// which selects measurements on their packed representation
+///
+/// The default candidate creator of the combinatorial Kalman filter
+/// calibrates every measurement on a surface into a temporary track state to
+/// compute its chi2. This creator computes the chi2 of all measurements of a
+/// surface in one pass over the @c PackedMeasurements of the event, and only
+/// the selected measurements are calibrated into track states of the
+/// trajectory.
+///
+/// The packed measurements have to contain the measurements of every surface
+/// in the order of the source link accessor, and the calibrator has to
+/// produce the packed measurement, i.e. the calibration must not depend on
+/// the predicted track parameters.
+///
+/// @tparam source_link_iterator_t The source link iterator type
+/// @tparam track_container_t The track container type
+template <typename source_link_iterator_t, typename track_container_t>
+struct PackedTrackStateCreator {
+  using TrackStateContainerBackend =
+      typename track_container_t::TrackStateContainerBackend;
+  using TrackStateProxy = typename track_container_t::TrackStateProxy;
+  using BoundState = std::tuple<BoundTrackParameters, BoundMatrix, double>;
+
+  /// The calibrator of the selected measurements
+  typename CombinatorialKalmanFilterExtensions<track_container_t>::Calibrator
+      calibrator;
+
+  /// The measurement selection cuts
+  const MeasurementSelector* measurementSelector = nullptr;
+
+  /// The packed measurements of the event
+  const PackedMeasurements* measurements = nullptr;
+
+  /// Optional components to store for the selected track states
+  TrackStatePropMask optionalComponents = TrackStatePropMask::Jacobian;
+
+  /// Create track states for selected measurements given by the source links
+  ///
+  /// @param gctx The current geometry context
+  /// @param calibrationContext pointer to the current calibration context
+  /// @param surface the surface the sourceLinks are associated to
+  /// @param boundState Bound state from the propagation on this surface
+  /// @param slBegin Begin iterator for sourceLinks
+  /// @param slEnd End iterator for sourceLinks
+  /// @param prevTip Index pointing at previous trajectory state (i.e. tip)
+  /// @param trajectory the trajectory to which new track states for selected measurements will be added
+  /// @param logger the logger for messages.
+  Result<CkfTypes::BranchVector<TrackIndexType>> createSourceLinkTrackStates(
+      const GeometryContext& gctx, const CalibrationContext& calibrationContext,
+      const Surface& surface, const BoundState& boundState,
+      source_link_iterator_t slBegin, source_link_iterator_t slEnd,
+      TrackIndexType prevTip,
+      TrackStateContainerBackend& /*bufferTrajectory*/,
+      std::vector<TrackStateProxy>& /*trackStateCandidates*/,
+      TrackStateContainerBackend& trajectory, const Logger& logger) const {
+    using PM = TrackStatePropMask;
+
+    assert(measurementSelector != nullptr && measurements != nullptr &&
+           "Packed track state creator is not configured");
+
+    const auto& [boundParams, jacobian, pathLength] = boundState;
+
+    const PackedMeasurements::SurfaceRange* range =
+        measurements->find(surface.geometryId());
+    if (range == nullptr ||
+        range->size !=
+            static_cast<std::size_t>(std::distance(slBegin, slEnd))) {
+      ACTS_ERROR("Packed measurements do not match the source links on "
+                 << surface.geometryId());
+      return CombinatorialKalmanFilterError::MeasurementSelectionFailed;
+    }
+    if (!boundParams.covariance().has_value()) {
+      ACTS_ERROR("Measurement selection requires a predicted covariance");
+      return CombinatorialKalmanFilterError::MeasurementSelectionFailed;
+    }
+
+    boost::container::small_vector<double, 16> chi2(range->size);
+    boost::container::small_vector<std::size_t, 16> selected(range->size);
+    measurements->chi2(*range, boundParams.parameters(),
+                       *boundParams.covariance(),
+                       std::span<double>(chi2.data(), chi2.size()));
+
+    bool isOutlier = false;
+    Result<std::size_t> selectorResult = measurementSelector->selectByChi2(
+        surface.geometryId(), boundParams.parameters()[eBoundTheta],
+        std::span<const double>(chi2.data(), chi2.size()),
+        std::span<std::size_t>(selected.data(), selected.size()), isOutlier,
+        logger);
+    if (!selectorResult.ok()) {
+      ACTS_ERROR("Selection of packed measurements failed: "
+                 << selectorResult.error());
+      return selectorResult.error();
+    }
+    const std::size_t nSelected = *selectorResult;
+
+    Result<CkfTypes::BranchVector<TrackIndexType>> resultTrackStateList{
+        CkfTypes::BranchVector<TrackIndexType>()};
+    CkfTypes::BranchVector<TrackIndexType>& trackStateList =
+        *resultTrackStateList;
+    trackStateList.reserve(nSelected);
+
+    // materialize only the selected measurements, with the same content as
+    // the track states of the default candidate creator
+    std::optional<TrackStateProxy> firstTrackState;
+    for (std::size_t i = 0; i < nSelected; ++i) {
+      const std::size_t candidate = selected[i];
+
+      PM mask = PM::Predicted | PM::Filtered | PM::Calibrated |
+                (optionalComponents & PM::Jacobian);
+      const bool storeJacobian = ACTS_CHECK_BIT(mask, PM::Jacobian);
+      if (i != 0) {
+        // subsequent track states share the prediction of the first one
+        mask &= ~PM::Predicted & ~PM::Jacobian;
+      }
+      if (isOutlier) {
+        // outlier won't have separate filtered parameters
+        mask &= ~PM::Filtered;
+      }
+
+      auto trackState = trajectory.makeTrackState(mask, prevTip);
+      ACTS_VERBOSE("Create SourceLink output track state #"
+                   << trackState.index() << " with mask: " << mask);
+
+      if (i != 0) {
+        trackState.shareFrom(*firstTrackState, PM::Predicted);
+        if (storeJacobian) {
+          trackState.shareFrom(*firstTrackState, PM::Jacobian);
+        }
+      } else {
+        firstTrackState = trackState;
+        trackState.predicted() = boundParams.parameters();
+        trackState.predictedCovariance() = *boundParams.covariance();
+        if (storeJacobian) {
+          trackState.jacobian() = jacobian;
+        }
+      }
+
+      trackState.pathLength() = pathLength;
+      trackState.setReferenceSurface(
+          boundParams.referenceSurface().getSharedPtr());
+      // source link iterators are only required to be forward iterators
+      auto sourceLink = slBegin;
+      for (std::size_t k = 0; k < candidate; ++k) {
+        ++sourceLink;
+      }
+      calibrator(gctx, calibrationContext, *sourceLink, trackState);
+      trackState.chi2() = chi2[candidate];
+
+      auto typeFlags = trackState.typeFlags();
+      typeFlags.set(TrackStateFlag::ParameterFlag);
+      typeFlags.set(TrackStateFlag::MeasurementFlag);
+      if (trackState.referenceSurface().surfaceMaterial() != nullptr) {
+        typeFlags.set(TrackStateFlag::MaterialFlag);
+      }
+      if (isOutlier) {
+        ACTS_VERBOSE(
+            "Creating outlier track state with tip = " << trackState.index());
+        typeFlags.set(TrackStateFlag::OutlierFlag);
+      }
+
+      trackStateList.push_back(trackState.index());
+    }
+
+    return resultTrackStateList;
+  }
+};
+
+}  // namespace Acts
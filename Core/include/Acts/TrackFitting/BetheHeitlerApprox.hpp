@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <boost/container/static_vector.hpp>
 
@@ -98,6 +99,11 @@ struct BetheHeitlerApproxSingleCmp {
 /// mixture. To enable an approximation for continuous input variables, the
 /// weights, means and variances are internally parametrized as a Nth order
 /// polynomial.
+///
+/// Optionally, the mixture can be precomputed in a table, which is then
+/// interpolated instead of evaluating the polynomials for every call, see
+/// @ref tabulate.
+///
 /// @todo This class is rather inflexible: It forces two data representations,
 /// making it a bit awkward to add a single parameterization. It would be good
 /// to generalize this at some point.
@@ -115,12 +121,28 @@ class AtlasBetheHeitlerApprox {
 
   using Data = std::array<PolyData, NComponents>;
 
+  /// Interpolation between the points of a tabulated mixture
+  enum class Interpolation { Linear, Cubic };
+
  private:
+  using Mixture = std::array<detail::GaussianComponent, NComponents>;
+
+  /// The mixture at equidistant points of x/x0 in one of the ranges
+  struct Table {
+    double xMin = 0;
+    double invStep = 0;
+    std::vector<Mixture> points;
+  };
+
   Data m_lowData;
   Data m_highData;
   bool m_lowTransform;
   bool m_highTransform;
 
+  Table m_lowTable;
+  Table m_highTable;
+  Interpolation m_interpolation = Interpolation::Linear;
+
   constexpr static double m_noChangeLimit = 0.0001;
   constexpr static double m_singleGaussianLimit = 0.002;
   double m_lowLimit = 0.10;
@@ -157,6 +179,48 @@ class AtlasBetheHeitlerApprox {
   /// @param x pathlength in terms of the radiation length
   constexpr bool validXOverX0(ActsScalar x) const { return x < m_highLimit; }
 
+  /// Precompute the mixture and interpolate it in later calls
+  ///
+  /// The mixture is evaluated at @p nPoints equidistant values of x/x0 in
+  /// each of the two ranges of the parameterization, from the single gaussian
+  /// limit to the low limit and from the low limit to the high limit. The
+  /// weights of the interpolated mixture still sum up to 1. Below the single
+  /// gaussian limit, the mixture is not affected.
+  ///
+  /// @param nPoints the number of points per range
+  /// @param interpolation the interpolation between the points
+  void tabulate(std::size_t nPoints,
+                Interpolation interpolation = Interpolation::Linear) {
+    const std::size_t minPoints = interpolation == Interpolation::Cubic ? 4 : 2;
+    if (nPoints < minPoints) {
+      throw std::invalid_argument(
+          "Too few points to tabulate the Bethe-Heitler approximation");
+    }
+
+    auto makeTable = [&](const Data &data, bool transform, double xMin,
+                         double xMax) {
+      Table table;
+      const double step = (xMax - xMin) / (nPoints - 1);
+      table.xMin = xMin;
+      // the high range is empty if both limits are equal
+      table.invStep = step > 0 ? 1 / step : 0;
+      table.points.reserve(nPoints);
+      for (std::size_t i = 0; i < nPoints; ++i) {
+        table.points.push_back(polyMixture(data, xMin + i * step, transform));
+      }
+      return table;
+    };
+
+    m_lowTable =
+        makeTable(m_lowData, m_lowTransform, m_singleGaussianLimit, m_lowLimit);
+    m_highTable =
+        makeTable(m_highData, m_highTransform, m_lowLimit, m_highLimit);
+    m_interpolation = interpolation;
+  }
+
+  /// Checks if the mixture is tabulated
+  bool isTabulated() const { return !m_lowTable.points.empty(); }
+
   /// Generates the mixture from the polynomials and reweights them, so
   /// that the sum of all weights is 1
   ///
@@ -164,43 +228,14 @@ class AtlasBetheHeitlerApprox {
   auto mixture(ActsScalar x) const {
     using Array =
         boost::container::static_vector<detail::GaussianComponent, NComponents>;
-    // Build a polynom
-    auto poly = [](ActsScalar xx,
-                   const std::array<ActsScalar, PolyDegree + 1> &coeffs) {
-      ActsScalar sum{0.};
-      for (const auto c : coeffs) {
-        sum = xx * sum + c;
-      }
-      assert((std::isfinite(sum) && "polynom result not finite"));
-      return sum;
-    };
 
     // Lambda which builds the components
-    auto make_mixture = [&](const Data &data, double xx, bool transform) {
-      // Value initialization should garanuee that all is initialized to zero
-      Array ret(NComponents);
-      ActsScalar weight_sum = 0;
-      for (int i = 0; i < NComponents; ++i) {
-        // These transformations must be applied to the data according to ATHENA
-        // (TrkGaussianSumFilter/src/GsfCombinedMaterialEffects.cxx:79)
-        if (transform) {
-          ret[i] = detail::inverseTransformComponent(
-              poly(xx, data[i].weightCoeffs), poly(xx, data[i].meanCoeffs),
-              poly(xx, data[i].varCoeffs));
-        } else {
-          ret[i].weight = poly(xx, data[i].weightCoeffs);
-          ret[i].mean = poly(xx, data[i].meanCoeffs);
-          ret[i].var = poly(xx, data[i].varCoeffs);
-        }
-
-        weight_sum += ret[i].weight;
-      }
-
-      for (int i = 0; i < NComponents; ++i) {
-        ret[i].weight /= weight_sum;
-      }
-
-      return ret;
+    auto make_mixture = [&](const Data &data, const Table &table, double xx,
+                            bool transform) {
+      const Mixture mixture = table.points.empty()
+                                  ? polyMixture(data, xx, transform)
+                                  : interpolate(table, xx);
+      return Array(mixture.begin(), mixture.end());
     };
 
     // Return no change
@@ -221,12 +256,12 @@ class AtlasBetheHeitlerApprox {
     }
     // Return a component representation for lower x0
     if (x < m_lowLimit) {
-      return make_mixture(m_lowData, x, m_lowTransform);
+      return make_mixture(m_lowData, m_lowTable, x, m_lowTransform);
     }
     // Return a component representation for higher x0
     // Cap the x because beyond the parameterization goes wild
     const auto high_x = std::min(m_highLimit, x);
-    return make_mixture(m_highData, high_x, m_highTransform);
+    return make_mixture(m_highData, m_highTable, high_x, m_highTransform);
   }
 
   /// Loads a parameterization from a file according to the Atlas file
@@ -286,6 +321,116 @@ class AtlasBetheHeitlerApprox {
     return AtlasBetheHeitlerApprox(lowData, highData, lowTransform,
                                    highTransform, lowLimit, highLimit);
   }
+
+ private:
+  /// Evaluates the polynomials and reweights the components, so that the sum
+  /// of all weights is 1
+  static Mixture polyMixture(const Data &data, double x, bool transform) {
+    // Build a polynom
+    auto poly = [](ActsScalar xx,
+                   const std::array<ActsScalar, PolyDegree + 1> &coeffs) {
+      ActsScalar sum{0.};
+      for (const auto c : coeffs) {
+        sum = xx * sum + c;
+      }
+      assert((std::isfinite(sum) && "polynom result not finite"));
+      return sum;
+    };
+
+    Mixture ret{};
+    ActsScalar weight_sum = 0;
+    for (int i = 0; i < NComponents; ++i) {
+      // These transformations must be applied to the data according to ATHENA
+      // (TrkGaussianSumFilter/src/GsfCombinedMaterialEffects.cxx:79)
+      if (transform) {
+        ret[i] = detail::inverseTransformComponent(
+            poly(x, data[i].weightCoeffs), poly(x, data[i].meanCoeffs),
+            poly(x, data[i].varCoeffs));
+      } else {
+        ret[i].weight = poly(x, data[i].weightCoeffs);
+        ret[i].mean = poly(x, data[i].meanCoeffs);
+        ret[i].var = poly(x, data[i].varCoeffs);
+      }
+
+      weight_sum += ret[i].weight;
+    }
+
+    for (int i = 0; i < NComponents; ++i) {
+      ret[i].weight /= weight_sum;
+    }
+
+    return ret;
+  }
+
+  /// Interpolates the tabulated mixture. The interpolation weights sum up to
+  /// 1 for both methods, so that the weights of the mixture stay normalized.
+  ///
+  /// The cubic spline can overshoot the tabulated points, e.g. below zero
+  /// for small weights and variances. Its values are therefore clamped to the
+  /// range of the two enclosing points, and the weights are normalized
+  /// again.
+  Mixture interpolate(const Table &table, double x) const {
+    const std::size_t nPoints = table.points.size();
+    const double position = (x - table.xMin) * table.invStep;
+    const std::size_t i = std::min(
+        static_cast<std::size_t>(std::max(position, 0.)), nPoints - 2);
+    const double t = position - i;
+
+    std::array<double, 4> coeffs{};
+    std::array<std::size_t, 4> indices{};
+    if (m_interpolation == Interpolation::Linear) {
+      coeffs = {0., 1. - t, t, 0.};
+      indices = {i, i, i + 1, i + 1};
+    } else {
+      // Catmull-Rom spline, the missing points at the boundaries are
+      // extrapolated linearly
+      const double t2 = t * t;
+      const double t3 = t2 * t;
+      coeffs = {0.5 * (-t3 + 2 * t2 - t), 0.5 * (3 * t3 - 5 * t2 + 2),
+                0.5 * (-3 * t3 + 4 * t2 + t), 0.5 * (t3 - t2)};
+      if (i == 0) {
+        coeffs = {0., coeffs[1] + 2 * coeffs[0], coeffs[2] - coeffs[0],
+                  coeffs[3]};
+      }
+      if (i + 2 == nPoints) {
+        coeffs = {coeffs[0], coeffs[1] - coeffs[3], coeffs[2] + 2 * coeffs[3],
+                  0.};
+      }
+      indices = {i == 0 ? 0 : i - 1, i, i + 1, std::min(i + 2, nPoints - 1)};
+    }
+
+    Mixture ret{};
+    for (std::size_t k = 0; k < 4; ++k) {
+      const Mixture &point = table.points[indices[k]];
+      for (int c = 0; c < NComponents; ++c) {
+        ret[c].weight += coeffs[k] * point[c].weight;
+        ret[c].mean += coeffs[k] * point[c].mean;
+        ret[c].var += coeffs[k] * point[c].var;
+      }
+    }
+
+    if (m_interpolation == Interpolation::Cubic) {
+      auto clamp = [](double value, double a, double b) {
+        return std::clamp(value, std::min(a, b), std::max(a, b));
+      };
+
+      const Mixture &lower = table.points[i];
+      const Mixture &upper = table.points[i + 1];
+      ActsScalar weight_sum = 0;
+      for (int c = 0; c < NComponents; ++c) {
+        ret[c].weight = clamp(ret[c].weight, lower[c].weight, upper[c].weight);
+        ret[c].mean = clamp(ret[c].mean, lower[c].mean, upper[c].mean);
+        ret[c].var = clamp(ret[c].var, lower[c].var, upper[c].var);
+        weight_sum += ret[c].weight;
+      }
+
+      for (int c = 0; c < NComponents; ++c) {
+        ret[c].weight /= weight_sum;
+      }
+    }
+
+    return ret;
+  }
 };
 
 /// Creates a @ref AtlasBetheHeitlerApprox object based on an ATLAS
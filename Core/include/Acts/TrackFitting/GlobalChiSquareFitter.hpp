@@ -47,6 +47,7 @@
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace Acts::Experimental {
 
@@ -282,25 +283,104 @@ struct ScatteringProperties {
   bool m_materialIsValid;
 };
 
-/// @brief Process measurements and fill the aMatrix and bVector
+/// @brief The linear system of the GX2F, stored surface by surface
+///
+/// The unknowns of the system are the corrections of the bound track
+/// parameters at the start and of the two scattering angles of every material
+/// surface. A measurement depends on the start parameters and on all
+/// scattering angles before it, so the dense matrix of the system has no band
+/// structure and solving it is cubic in the number of material surfaces.
+///
+/// However, the dependence is only through the chain of Jacobians between
+/// the surfaces. The system is therefore stored per surface, with the
+/// measurement information in bound parameter space. It is solved by
+/// eliminating the scattering angles surface by surface, starting from the
+/// last one like a backward information filter, and by recovering them in a
+/// forward pass. This is the same solution as for the dense system, in linear
+/// time.
+class Gx2fSystem {
+ public:
+  /// The solution of the system
+  struct Solution {
+    /// Correction of the start parameters
+    BoundVector deltaParams = BoundVector::Zero();
+    /// Corrections of the (phi, theta) scattering angles, in the order of the
+    /// material surfaces
+    std::vector<Vector2> deltaScatteringAngles;
+    /// Information matrix of the start parameters, with the scattering angles
+    /// marginalised, i.e. the inverse of their covariance
+    BoundMatrix information = BoundMatrix::Zero();
+  };
+
+  /// Add the next surface
+  ///
+  /// @param jacobian The Jacobian from the previous surface, or from the
+  ///        start parameters for the first surface
+  void addSurface(const BoundMatrix& jacobian);
+
+  /// Add a measurement on the last surface
+  ///
+  /// @param information The measurement information projected to the bound
+  ///        parameters, i.e. H^T V^-1 H
+  /// @param weightedResidual The weighted residual projected to the bound
+  ///        parameters, i.e. H^T V^-1 r
+  void addMeasurement(const BoundMatrix& information,
+                      const BoundVector& weightedResidual);
+
+  /// Add scattering angles on the last surface, which act on the track
+  /// parameters after the measurement on the surface
+  ///
+  /// @param information The diagonal of the system for the (phi, theta)
+  ///        scattering angles
+  /// @param bVector The right hand side of the system for the (phi, theta)
+  ///        scattering angles
+  void addScattering(const Vector2& information, const Vector2& bVector);
+
+  /// @return the number of material surfaces with scattering angles
+  std::size_t nScatterers() const { return m_nScatterers; }
+
+  /// The part of the system for the start parameters, which corresponds to
+  /// the top left corner of the dense system
+  const BoundMatrix& aMatrix() const { return m_aMatrix; }
+  /// The part of the right hand side for the start parameters
+  const BoundVector& bVector() const { return m_bVector; }
+
+  /// Solve the system
+  Solution solve() const;
+
+ private:
+  struct Surface {
+    BoundMatrix jacobian;
+    BoundMatrix information = BoundMatrix::Zero();
+    BoundVector weightedResidual = BoundVector::Zero();
+    bool hasScattering = false;
+    Vector2 scatteringInformation = Vector2::Zero();
+    Vector2 scatteringBVector = Vector2::Zero();
+  };
+
+  std::vector<Surface> m_surfaces;
+  std::size_t m_nScatterers = 0;
+  BoundMatrix m_jacobianFromStart = BoundMatrix::Identity();
+  BoundMatrix m_aMatrix = BoundMatrix::Zero();
+  BoundVector m_bVector = BoundVector::Zero();
+};
+
+/// @brief Process measurements and fill the system
 ///
 /// The function processes each measurement for the GX2F Actor fitting process.
-/// It extracts the information from the track state and adds it to aMatrix,
-/// bVector, and chi2sum.
+/// It extracts the information from the track state and adds it to the
+/// system and chi2sum.
 ///
 /// @tparam kMeasDim Number of dimensions of the measurement
 /// @tparam track_state_t The type of the track state
 ///
-/// @param aMatrixExtended The aMatrix sums over the second derivatives
-/// @param bVectorExtended The bVector sums over the first derivatives
+/// @param system The linear system, whose last surface is the one of the
+///        track state
 /// @param chi2sum The total chi2 of the system
-/// @param jacobianFromStart The Jacobian matrix from start to the current state
 /// @param trackState The track state to analyse
 /// @param logger A logger instance
 template <std::size_t kMeasDim, typename track_state_t>
-void addMeasurementToGx2fSums(Eigen::MatrixXd& aMatrixExtended,
-                              Eigen::VectorXd& bVectorExtended, double& chi2sum,
-                              const std::vector<BoundMatrix>& jacobianFromStart,
+void addMeasurementToGx2fSums(Gx2fSystem& system, double& chi2sum,
                               const track_state_t& trackState,
                               const Logger& logger) {
   // First we get back the covariance and try to invert it. If the inversion
@@ -315,35 +395,6 @@ void addMeasurementToGx2fSums(Eigen::MatrixXd& aMatrixExtended,
     return;
   }
 
-  // Create an extended Jacobian. This one contains only eBoundSize rows,
-  // because the rest is irrelevant
-  // TODO make dimsExtendedParams template with unrolling
-  const std::size_t dimsExtendedParams = aMatrixExtended.rows();
-
-  // We create an empty Jacobian and fill it in the next steps
-  Eigen::MatrixXd extendedJacobian =
-      Eigen::MatrixXd::Zero(eBoundSize, dimsExtendedParams);
-
-  // This part of the Jacobian comes from the material-less propagation
-  extendedJacobian.topLeftCorner<eBoundSize, eBoundSize>() =
-      jacobianFromStart[0];
-
-  // If we have material, loop here over all Jacobians. We add extra columns for
-  // their phi-theta projections. These parts account for the propagation of the
-  // scattering angles.
-  for (std::size_t matSurface = 1; matSurface < jacobianFromStart.size();
-       matSurface++) {
-    const BoundMatrix jac = jacobianFromStart[matSurface];
-
-    const ActsMatrix<eBoundSize, 2> jacPhiTheta =
-        jac * Gx2fConstants::phiThetaProjector;
-
-    // The position, where we need to insert the values in the extended Jacobian
-    const std::size_t deltaPosition = eBoundSize + 2 * (matSurface - 1);
-
-    extendedJacobian.block<eBoundSize, 2>(0, deltaPosition) = jacPhiTheta;
-  }
-
   const BoundVector predicted = trackState.smoothed();
 
   const ActsVector<kMeasDim> measurement =
@@ -352,23 +403,21 @@ void addMeasurementToGx2fSums(Eigen::MatrixXd& aMatrixExtended,
   const ActsMatrix<kMeasDim, eBoundSize> projector =
       trackState.projector().template topLeftCorner<kMeasDim, eBoundSize>();
 
-  const Eigen::MatrixXd projJacobian = projector * extendedJacobian;
-
   const ActsMatrix<kMeasDim, 1> projPredicted = projector * predicted;
 
   const ActsVector<kMeasDim> residual = measurement - projPredicted;
 
-  // Finally contribute to chi2sum, aMatrix, and bVector
-  chi2sum += (residual.transpose() * (*safeInvCovMeasurement) * residual)(0, 0);
+  // The contributions in bound parameter space. The Jacobians to the
+  // parameters of the system are applied when solving it.
+  const BoundMatrix information =
+      projector.transpose() * (*safeInvCovMeasurement) * projector;
+  const BoundVector weightedResidual =
+      projector.transpose() * (*safeInvCovMeasurement) * residual;
 
-  aMatrixExtended +=
-      (projJacobian.transpose() * (*safeInvCovMeasurement) * projJacobian)
-          .eval();
+  // Finally contribute to chi2sum and the system
+  chi2sum += (residual.transpose() * (*safeInvCovMeasurement) * residual)(0, 0);
 
-  bVectorExtended +=
-      (residual.transpose() * (*safeInvCovMeasurement) * projJacobian)
-          .eval()
-          .transpose();
+  system.addMeasurement(information, weightedResidual);
 
   ACTS_VERBOSE(
       "Contributions in addMeasurementToGx2fSums:\n"
@@ -379,19 +428,11 @@ void addMeasurementToGx2fSums(Eigen::MatrixXd& aMatrixExtended,
       << covarianceMeasurement << "\n"
       << "projector:\n"
       << projector.eval() << "\n"
-      << "projJacobian:\n"
-      << projJacobian.eval() << "\n"
       << "projPredicted: " << (projPredicted.transpose()).eval() << "\n"
       << "residual: " << (residual.transpose()).eval() << "\n"
-      << "extendedJacobian:\n"
-      << extendedJacobian << "\n"
-      << "aMatrixMeas:\n"
-      << (projJacobian.transpose() * (*safeInvCovMeasurement) * projJacobian)
-             .eval()
-      << "\n"
-      << "bVectorMeas: "
-      << (residual.transpose() * (*safeInvCovMeasurement) * projJacobian).eval()
-      << "\n"
+      << "information:\n"
+      << information << "\n"
+      << "weightedResidual: " << weightedResidual.transpose() << "\n"
       << "chi2sumMeas: "
       << (residual.transpose() * (*safeInvCovMeasurement) * residual)(0, 0)
       << "\n"
@@ -401,25 +442,23 @@ void addMeasurementToGx2fSums(Eigen::MatrixXd& aMatrixExtended,
   return;
 }
 
-/// @brief Process material and fill the aMatrix and bVector
+/// @brief Process material and fill the system
 ///
 /// The function processes each material for the GX2F Actor fitting process.
-/// It extracts the information from the track state and adds it to aMatrix,
-/// bVector, and chi2sum.
+/// It extracts the information from the track state and adds it to the
+/// system and chi2sum.
 ///
 /// @tparam track_state_t The type of the track state
 ///
-/// @param aMatrixExtended The aMatrix sums over the second derivatives
-/// @param bVectorExtended The bVector sums over the first derivatives
+/// @param system The linear system, whose last surface is the one of the
+///        track state
 /// @param chi2sum The total chi2 of the system
-/// @param nMaterialsHandled How many materials we already handled. Used for the offset.
 /// @param scatteringMap The scattering map, containing all scattering angles and covariances
 /// @param trackState The track state to analyse
 /// @param logger A logger instance
 template <typename track_state_t>
 void addMaterialToGx2fSums(
-    Eigen::MatrixXd& aMatrixExtended, Eigen::VectorXd& bVectorExtended,
-    double& chi2sum, const std::size_t nMaterialsHandled,
+    Gx2fSystem& system, double& chi2sum,
     const std::unordered_map<GeometryIdentifier, ScatteringProperties>&
         scatteringMap,
     const track_state_t& trackState, const Logger& logger) {
@@ -434,26 +473,19 @@ void addMaterialToGx2fSums(
 
   const ActsScalar sinThetaLoc = std::sin(trackState.smoothed()[eBoundTheta]);
 
-  // The position, where we need to insert the values in aMatrix and bVector
-  const std::size_t deltaPosition = eBoundSize + 2 * nMaterialsHandled;
-
   const BoundVector& scatteringAngles =
       scatteringMapId->second.scatteringAngles();
 
   const ActsScalar invCov = scatteringMapId->second.invCovarianceMaterial();
 
-  // Phi contribution
-  aMatrixExtended(deltaPosition, deltaPosition) +=
-      invCov * sinThetaLoc * sinThetaLoc;
-  bVectorExtended(deltaPosition, 0) -=
-      invCov * scatteringAngles[eBoundPhi] * sinThetaLoc;
+  // Phi and theta contributions
+  const Vector2 information(invCov * sinThetaLoc * sinThetaLoc, invCov);
+  const Vector2 bVector(-invCov * scatteringAngles[eBoundPhi] * sinThetaLoc,
+                        -invCov * scatteringAngles[eBoundTheta]);
+  system.addScattering(information, bVector);
+
   chi2sum += invCov * scatteringAngles[eBoundPhi] * sinThetaLoc *
              scatteringAngles[eBoundPhi] * sinThetaLoc;
-
-  // Theta Contribution
-  aMatrixExtended(deltaPosition + 1, deltaPosition + 1) += invCov;
-  bVectorExtended(deltaPosition + 1, 0) -=
-      invCov * scatteringAngles[eBoundTheta];
   chi2sum +=
       invCov * scatteringAngles[eBoundTheta] * scatteringAngles[eBoundTheta];
 
@@ -461,13 +493,10 @@ void addMaterialToGx2fSums(
       "Contributions in addMaterialToGx2fSums:\n"
       << "    invCov: " << invCov << "\n"
       << "    sinThetaLoc: " << sinThetaLoc << "\n"
-      << "    deltaPosition: " << deltaPosition << "\n"
       << "    Phi:\n"
       << "        scattering angle:     " << scatteringAngles[eBoundPhi] << "\n"
-      << "        aMatrix contribution: " << invCov * sinThetaLoc * sinThetaLoc
-      << "\n"
-      << "        bVector contribution: "
-      << invCov * scatteringAngles[eBoundPhi] * sinThetaLoc << "\n"
+      << "        aMatrix contribution: " << information[0] << "\n"
+      << "        bVector contribution: " << bVector[0] << "\n"
       << "        chi2sum contribution: "
       << invCov * scatteringAngles[eBoundPhi] * sinThetaLoc *
              scatteringAngles[eBoundPhi] * sinThetaLoc
@@ -475,9 +504,8 @@ void addMaterialToGx2fSums(
       << "    Theta:\n"
       << "        scattering angle:     " << scatteringAngles[eBoundTheta]
       << "\n"
-      << "        aMatrix contribution: " << invCov << "\n"
-      << "        bVector contribution: "
-      << invCov * scatteringAngles[eBoundTheta] << "\n"
+      << "        aMatrix contribution: " << information[1] << "\n"
+      << "        bVector contribution: " << bVector[1] << "\n"
       << "        chi2sum contribution: "
       << invCov * scatteringAngles[eBoundTheta] * scatteringAngles[eBoundTheta]
       << "\n");
@@ -487,19 +515,18 @@ void addMaterialToGx2fSums(
 
 /// @brief Calculate and update the covariance of the fitted parameters
 ///
-/// This function calculates the covariance of the fitted parameters using
-/// cov = inv([a])
-/// It then updates the first square block of size ndfSystem. This ensures,
-/// that we only update the covariance for fitted parameters. (In case of
-/// no qop/time fit)
+/// This function calculates the covariance of the fitted parameters as the
+/// inverse of their information matrix, in which the scattering angles are
+/// marginalised. This is the top left corner of the inverse of the full
+/// system. It then updates the first square block of size ndfSystem. This
+/// ensures, that we only update the covariance for fitted parameters. (In
+/// case of no qop/time fit)
 ///
 /// @param fullCovariancePredicted The covariance matrix to update
-/// @param aMatrixExtended The matrix containing the coefficients of the linear system.
+/// @param information The information matrix of the fitted parameters
 /// @param ndfSystem The number of degrees of freedom, determining the size of meaning full block
-///
-/// @return deltaParams The calculated delta parameters.
 void updateGx2fCovarianceParams(BoundMatrix& fullCovariancePredicted,
-                                Eigen::MatrixXd& aMatrixExtended,
+                                BoundMatrix& information,
                                 const std::size_t ndfSystem);
 
 /// Global Chi Square fitter (GX2F) implementation.
@@ -1145,48 +1172,9 @@ class Gx2Fitter {
       // This goes up for each measurement (for each dimension)
       std::size_t countNdf = 0;
 
-      // Count the material surfaces, to set up the system. In the multiple
-      // scattering case, we need to extend our system.
-      std::size_t nMaterialSurfaces = 0;
-      if (multipleScattering) {
-        ACTS_DEBUG("Count the valid material surfaces.");
-        for (const auto& trackState : track.trackStates()) {
-          const auto typeFlags = trackState.typeFlags();
-          const bool stateHasMaterial =
-              typeFlags.test(TrackStateFlag::MaterialFlag);
-
-          if (!stateHasMaterial) {
-            continue;
-          }
-
-          // Get and store geoId for the current material surface
-          const GeometryIdentifier geoId =
-              trackState.referenceSurface().geometryId();
-
-          const auto scatteringMapId = scatteringMap.find(geoId);
-          assert(scatteringMapId != scatteringMap.end() &&
-                 "No scattering angles found for material surface.");
-          if (!scatteringMapId->second.materialIsValid()) {
-            continue;
-          }
-
-          nMaterialSurfaces++;
-        }
-      }
-
-      // We need 6 dimensions for the bound parameters and 2 * nMaterialSurfaces
-      // dimensions for the scattering angles.
-      const std::size_t dimsExtendedParams = eBoundSize + 2 * nMaterialSurfaces;
-
       // Set to zero before filling
       chi2sum = 0;
-      Eigen::MatrixXd aMatrixExtended =
-          Eigen::MatrixXd::Zero(dimsExtendedParams, dimsExtendedParams);
-      Eigen::VectorXd bVectorExtended =
-          Eigen::VectorXd::Zero(dimsExtendedParams);
-
-      std::vector<BoundMatrix> jacobianFromStart;
-      jacobianFromStart.emplace_back(BoundMatrix::Identity());
+      Gx2fSystem system;
 
       // This vector stores the IDs for each visited material in order. We use
       // it later for updating the scattering angles. We cannot use
@@ -1222,10 +1210,8 @@ class Gx2Fitter {
           continue;
         }
 
-        // update all Jacobians from start
-        for (auto& jac : jacobianFromStart) {
-          jac = trackState.jacobian() * jac;
-        }
+        // add the surface with the Jacobian from the previous one
+        system.addSurface(trackState.jacobian());
 
         // Handle measurement
         if (stateHasMeasurement) {
@@ -1244,8 +1230,7 @@ class Gx2Fitter {
           countNdf += measDim;
 
           visit_measurement(measDim, [&](auto N) {
-            addMeasurementToGx2fSums<N>(aMatrixExtended, bVectorExtended,
-                                        chi2sum, jacobianFromStart, trackState,
+            addMeasurementToGx2fSums<N>(system, chi2sum, trackState,
                                         *m_addToSumLogger);
           });
         }
@@ -1253,12 +1238,8 @@ class Gx2Fitter {
         // Handle material
         if (doMaterial) {
           ACTS_DEBUG("    Handle material");
-          // Add for this material a new Jacobian, starting from this surface.
-          jacobianFromStart.emplace_back(BoundMatrix::Identity());
-
           // Add the material contribution to the system
-          addMaterialToGx2fSums(aMatrixExtended, bVectorExtended, chi2sum,
-                                geoIdVector.size(), scatteringMap, trackState,
+          addMaterialToGx2fSums(system, chi2sum, scatteringMap, trackState,
                                 *m_addToSumLogger);
 
           geoIdVector.emplace_back(geoId);
@@ -1270,9 +1251,9 @@ class Gx2Fitter {
       // 4: no magnetic field -> q/p is empty
       // 5: no time measurement -> time not fittable
       // 6: full fit
-      if (aMatrixExtended(4, 4) == 0) {
+      if (system.aMatrix()(4, 4) == 0) {
         ndfSystem = 4;
-      } else if (aMatrixExtended(5, 5) == 0) {
+      } else if (system.aMatrix()(5, 5) == 0) {
         ndfSystem = 5;
       } else {
         ndfSystem = 6;
@@ -1296,14 +1277,13 @@ class Gx2Fitter {
       }
 
       // get back the Bound vector components
-      aMatrix = aMatrixExtended.topLeftCorner<eBoundSize, eBoundSize>().eval();
-      bVector = bVectorExtended.topLeftCorner<eBoundSize, 1>().eval();
+      aMatrix = system.aMatrix();
+      bVector = system.bVector();
 
       // calculate delta params [a] * delta = b
-      Eigen::VectorXd deltaParamsExtended =
-          aMatrixExtended.colPivHouseholderQr().solve(bVectorExtended);
+      Gx2fSystem::Solution solution = system.solve();
 
-      deltaParams = deltaParamsExtended.topLeftCorner<eBoundSize, 1>().eval();
+      deltaParams = solution.deltaParams;
 
       ACTS_VERBOSE("aMatrix:\n"
                    << aMatrix << "\n"
@@ -1311,8 +1291,8 @@ class Gx2Fitter {
                    << bVector << "\n"
                    << "deltaParams:\n"
                    << deltaParams << "\n"
-                   << "deltaParamsExtended:\n"
-                   << deltaParamsExtended << "\n"
+                   << "information:\n"
+                   << solution.information << "\n"
                    << "oldChi2sum = " << oldChi2sum << "\n"
                    << "chi2sum = " << chi2sum);
 
@@ -1322,16 +1302,16 @@ class Gx2Fitter {
         ACTS_INFO("Abort with relChi2changeCutOff after "
                   << nUpdate + 1 << "/" << gx2fOptions.nUpdateMax
                   << " iterations.");
-        updateGx2fCovarianceParams(fullCovariancePredicted, aMatrixExtended,
-                                   ndfSystem);
+        updateGx2fCovarianceParams(fullCovariancePredicted,
+                                   solution.information, ndfSystem);
         break;
       }
 
       if (chi2sum > oldChi2sum + 1e-5) {
         ACTS_DEBUG("chi2 not converging monotonically");
 
-        updateGx2fCovarianceParams(fullCovariancePredicted, aMatrixExtended,
-                                   ndfSystem);
+        updateGx2fCovarianceParams(fullCovariancePredicted,
+                                   solution.information, ndfSystem);
         break;
       }
 
@@ -1349,22 +1329,21 @@ class Gx2Fitter {
           return Experimental::GlobalChiSquareFitterError::DidNotConverge;
         }
 
-        updateGx2fCovarianceParams(fullCovariancePredicted, aMatrixExtended,
-                                   ndfSystem);
+        updateGx2fCovarianceParams(fullCovariancePredicted,
+                                   solution.information, ndfSystem);
         break;
       }
 
       if (multipleScattering) {
         // update the scattering angles
-        for (std::size_t matSurface = 0; matSurface < nMaterialSurfaces;
+        for (std::size_t matSurface = 0; matSurface < geoIdVector.size();
              matSurface++) {
-          const std::size_t deltaPosition = eBoundSize + 2 * matSurface;
           const GeometryIdentifier geoId = geoIdVector[matSurface];
           const auto scatteringMapId = scatteringMap.find(geoId);
           assert(scatteringMapId != scatteringMap.end() &&
                  "No scattering angles found for material surface.");
           scatteringMapId->second.scatteringAngles().block<2, 1>(2, 0) +=
-              deltaParamsExtended.block<2, 1>(deltaPosition, 0).eval();
+              solution.deltaScatteringAngles[matSurface];
         }
       }
 
@@ -339,6 +339,13 @@ class KalmanFitter {
     /// Calibration context for the fit
     const CalibrationContext* calibrationContext{nullptr};
 
+    /// Optional components of the filtered track states. The Jacobians are
+    /// only needed by the smoother, the reversed filtering does not use them.
+    TrackStatePropMask optionalComponents() const {
+      return reversedFiltering ? TrackStatePropMask::None
+                               : TrackStatePropMask::Jacobian;
+    }
+
     /// @brief Kalman actor operation
     ///
     /// @tparam propagator_state_t is the type of Propagator state
@@ -612,7 +619,10 @@ class KalmanFitter {
         auto trackStateProxyRes = detail::kalmanHandleMeasurement(
             *calibrationContext, state, stepper, extensions, *surface,
             sourceLinkIt->second, *result.fittedStates, result.lastTrackIndex,
-            false, logger());
+            false, logger(), FreeToBoundCorrection(false),
+            TrackStatePropMask::Predicted | TrackStatePropMask::Filtered |
+                TrackStatePropMask::Smoothed | TrackStatePropMask::Calibrated |
+                optionalComponents());
 
         if (!trackStateProxyRes.ok()) {
           return trackStateProxyRes.error();
@@ -657,7 +667,9 @@ class KalmanFitter {
         auto trackStateProxyRes = detail::kalmanHandleNoMeasurement(
             state, stepper, *surface, *result.fittedStates,
             result.lastTrackIndex, true, logger(), precedingMeasurementExists,
-            freeToBoundCorrection);
+            freeToBoundCorrection,
+            TrackStatePropMask::Predicted | TrackStatePropMask::Smoothed |
+                optionalComponents());
 
         if (!trackStateProxyRes.ok()) {
           return trackStateProxyRes.error();
@@ -726,11 +738,12 @@ class KalmanFitter {
         auto fittedStates = *result.fittedStates;
 
         // Add a <mask> TrackState entry multi trajectory. This allocates
-        // storage for all components, which we will set later.
-        TrackStatePropMask mask =
-            TrackStatePropMask::Predicted | TrackStatePropMask::Filtered |
-            TrackStatePropMask::Smoothed | TrackStatePropMask::Jacobian |
-            TrackStatePropMask::Calibrated;
+        // storage for all components, which we will set later. This state is
+        // only used to compute the smoothed parameters of the existing state,
+        // so it needs neither smoothed parameters nor a Jacobian.
+        TrackStatePropMask mask = TrackStatePropMask::Predicted |
+                                  TrackStatePropMask::Filtered |
+                                  TrackStatePropMask::Calibrated;
         const std::size_t currentTrackIndex = fittedStates.addTrackState(
             mask, Acts::MultiTrajectoryTraits::kInvalid);
 
@@ -753,8 +766,6 @@ class KalmanFitter {
           // Fill the track state
           trackStateProxy.predicted() = boundParams.parameters();
           trackStateProxy.predictedCovariance() = state.stepping.cov;
-
-          trackStateProxy.jacobian() = jacobian;
           trackStateProxy.pathLength() = pathLength;
         }
 
@@ -295,6 +295,8 @@ struct GsfActor {
       // Reuse memory over all calls to the Actor in a single propagation
       std::vector<ComponentCache>& componentCache = result.componentCache;
       componentCache.clear();
+      componentCache.reserve(tmpStates.tips.size() *
+                             m_cfg.bethe_heitler_approx->numComponents());
 
       convoluteComponents(state, stepper, navigator, tmpStates, componentCache,
                           result);
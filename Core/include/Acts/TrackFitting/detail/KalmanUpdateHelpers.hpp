@@ -14,6 +14,7 @@
 #include "Acts/EventData/detail/CorrectedTransformationFreeToBound.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Result.hpp"
 
 namespace Acts::detail {
@@ -33,6 +34,8 @@ namespace Acts::detail {
 /// @param doCovTransport Whether to perform a covariance transport when
 /// computing the bound state or not
 /// @param freeToBoundCorrection Correction for non-linearity effect during transform from free to bound (only corrected when performing CovTransport)
+/// @param mask The components to allocate for the new state, the Jacobian
+/// can be left out if the track is not going to be smoothed
 template <typename propagator_state_t, typename stepper_t,
           typename extensions_t, typename traj_t>
 auto kalmanHandleMeasurement(
@@ -41,13 +44,14 @@ auto kalmanHandleMeasurement(
     const Surface &surface, const SourceLink &sourceLink, traj_t &fittedStates,
     const std::size_t lastTrackIndex, bool doCovTransport, const Logger &logger,
     const FreeToBoundCorrection &freeToBoundCorrection = FreeToBoundCorrection(
-        false)) -> Result<typename traj_t::TrackStateProxy> {
+        false),
+    const TrackStatePropMask mask =
+        TrackStatePropMask::Predicted | TrackStatePropMask::Filtered |
+        TrackStatePropMask::Smoothed | TrackStatePropMask::Jacobian |
+        TrackStatePropMask::Calibrated)
+    -> Result<typename traj_t::TrackStateProxy> {
   // Add a <mask> TrackState entry multi trajectory. This allocates storage for
   // all components, which we will set later.
-  TrackStatePropMask mask =
-      TrackStatePropMask::Predicted | TrackStatePropMask::Filtered |
-      TrackStatePropMask::Smoothed | TrackStatePropMask::Jacobian |
-      TrackStatePropMask::Calibrated;
   typename traj_t::TrackStateProxy trackStateProxy =
       fittedStates.makeTrackState(mask, lastTrackIndex);
 
@@ -69,7 +73,9 @@ auto kalmanHandleMeasurement(
     trackStateProxy.predicted() = boundParams.parameters();
     trackStateProxy.predictedCovariance() = state.stepping.cov;
 
-    trackStateProxy.jacobian() = jacobian;
+    if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Jacobian)) {
+      trackStateProxy.jacobian() = jacobian;
+    }
     trackStateProxy.pathLength() = pathLength;
   }
 
@@ -131,18 +137,21 @@ auto kalmanHandleMeasurement(
 /// @param doCovTransport Whether to perform a covariance transport when
 /// computing the bound state or not
 /// @param freeToBoundCorrection Correction for non-linearity effect during transform from free to bound (only corrected when performing CovTransport)
+/// @param mask The components to allocate for the new state, the Jacobian
+/// can be left out if the track is not going to be smoothed
 template <typename propagator_state_t, typename stepper_t, typename traj_t>
 auto kalmanHandleNoMeasurement(
     propagator_state_t &state, const stepper_t &stepper, const Surface &surface,
     traj_t &fittedStates, const std::size_t lastTrackIndex, bool doCovTransport,
     const Logger &logger, const bool precedingMeasurementExists,
     const FreeToBoundCorrection &freeToBoundCorrection = FreeToBoundCorrection(
-        false)) -> Result<typename traj_t::TrackStateProxy> {
+        false),
+    const TrackStatePropMask mask = TrackStatePropMask::Predicted |
+                                    TrackStatePropMask::Smoothed |
+                                    TrackStatePropMask::Jacobian)
+    -> Result<typename traj_t::TrackStateProxy> {
   // Add a <mask> TrackState entry multi trajectory. This allocates storage for
   // all components, which we will set later.
-  TrackStatePropMask mask = TrackStatePropMask::Predicted |
-                            TrackStatePropMask::Smoothed |
-                            TrackStatePropMask::Jacobian;
   typename traj_t::TrackStateProxy trackStateProxy =
       fittedStates.makeTrackState(mask, lastTrackIndex);
 
@@ -162,7 +171,9 @@ auto kalmanHandleNoMeasurement(
     trackStateProxy.predicted() = boundParams.parameters();
     trackStateProxy.predictedCovariance() = state.stepping.cov;
 
-    trackStateProxy.jacobian() = jacobian;
+    if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Jacobian)) {
+      trackStateProxy.jacobian() = jacobian;
+    }
     trackStateProxy.pathLength() = pathLength;
 
     // Set the filtered parameter index to be the same with predicted
@@ -14,6 +14,14 @@
 #include "Acts/TrackFitting/detail/GsfComponentMerging.hpp"
 #include "Acts/TrackFitting/detail/GsfUtils.hpp"
 
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <utility>
+#include <vector>
+
 namespace Acts::detail {
 
 /// Computes the Kullback-Leibler distance between two components as shown in
@@ -65,50 +73,126 @@ auto mergeComponents(const component_t &a, const component_t &b,
 }
 
 /// @brief Class representing a symmetric distance matrix
+///
+/// Only the lower triangle is stored. The distances of masked components are
+/// set to infinity, and the minimum of every row is cached. After a merge,
+/// only the rows which contain the merged components need to be searched
+/// again, so finding the closest pair is linear instead of quadratic in the
+/// number of components.
+///
+/// The q/p values and variances of the components are kept in contiguous
+/// arrays, so that the distances of a row are computed in one vectorized
+/// expression. The storage can be reused for several mixtures with @c reset,
+/// and then no allocation is needed once the largest mixture has been seen.
 class SymmetricKLDistanceMatrix {
   using Array = Eigen::Array<Acts::ActsScalar, Eigen::Dynamic, 1>;
-  using Mask = Eigen::Array<bool, Eigen::Dynamic, 1>;
 
-  Array m_distances;
-  Mask m_mask;
-  std::vector<std::pair<std::size_t, std::size_t>> m_mapToPair;
-  std::size_t m_numberComponents;
+  static constexpr Acts::ActsScalar s_masked =
+      std::numeric_limits<Acts::ActsScalar>::infinity();
+
+  std::vector<Acts::ActsScalar> m_distances;
+  std::vector<Acts::ActsScalar> m_qop;
+  std::vector<Acts::ActsScalar> m_var;
+  std::vector<Acts::ActsScalar> m_invVar;
+  std::vector<Acts::ActsScalar> m_rowMin;
+  std::vector<std::size_t> m_rowArgMin;
+  std::size_t m_numberComponents = 0;
+
+  static std::size_t rowOffset(std::size_t i) { return i * (i - 1) / 2; }
+
+  Eigen::Map<Array> row(std::size_t i) {
+    return {m_distances.data() + rowOffset(i), static_cast<Eigen::Index>(i)};
+  }
+
+  template <typename component_t, typename projector_t>
+  void setComponent(std::size_t n, const component_t &cmp,
+                    const projector_t &proj) {
+    m_qop[n] = proj(cmp).boundPars[eBoundQOverP];
+    m_var[n] = proj(cmp).boundCov(eBoundQOverP, eBoundQOverP);
+
+    assert(m_var[n] != 0.0);
+    assert(std::isfinite(m_var[n]));
+
+    m_invVar[n] = 1 / m_var[n];
+  }
+
+  /// The distances of row @p i to all previous components, this is the same
+  /// expression as in @c computeSymmetricKlDivergence
+  auto rowDistances(std::size_t i) const {
+    const auto size = static_cast<Eigen::Index>(i);
+    const Eigen::Map<const Array> qop(m_qop.data(), size);
+    const Eigen::Map<const Array> var(m_var.data(), size);
+    const Eigen::Map<const Array> invVar(m_invVar.data(), size);
 
-  template <typename array_t, typename setter_t>
-  void setAssociated(std::size_t n, array_t &array, setter_t &&setter) {
-    const auto indexConst = (n - 1) * n / 2;
+    return m_var[i] * invVar + var * m_invVar[i] +
+           (m_qop[i] - qop) * (m_invVar[i] + invVar) * (m_qop[i] - qop);
+  }
+
+  Acts::ActsScalar distance(std::size_t i, std::size_t j) const {
+    return m_var[i] * m_invVar[j] + m_var[j] * m_invVar[i] +
+           (m_qop[i] - m_qop[j]) * (m_invVar[i] + m_invVar[j]) *
+               (m_qop[i] - m_qop[j]);
+  }
 
-    // Rows
-    for (auto i = 0ul; i < n; ++i) {
-      array[indexConst + i] = setter(n, i);
+  /// Search the minimum of row @p i, the first one is taken for equal
+  /// distances
+  void updateRowMin(std::size_t i) {
+    const Acts::ActsScalar *distances = m_distances.data() + rowOffset(i);
+    Acts::ActsScalar min = s_masked;
+    std::size_t argMin = 0;
+    for (std::size_t j = 0; j < i; ++j) {
+      if (distances[j] < min) {
+        min = distances[j];
+        argMin = j;
+      }
     }
+    m_rowMin[i] = min;
+    m_rowArgMin[i] = argMin;
+  }
 
-    // Columns
-    for (auto i = n + 1; i < m_numberComponents; ++i) {
-      array[(i - 1) * i / 2 + n] = setter(n, i);
+  /// Update the minimum of row @p i after its entry in column @p j changed
+  void updateRowMin(std::size_t i, std::size_t j) {
+    const Acts::ActsScalar distance = m_distances[rowOffset(i) + j];
+    if (m_rowArgMin[i] == j) {
+      updateRowMin(i);
+    } else if (distance < m_rowMin[i] ||
+               (distance == m_rowMin[i] && j < m_rowArgMin[i])) {
+      m_rowMin[i] = distance;
+      m_rowArgMin[i] = j;
     }
   }
 
  public:
+  SymmetricKLDistanceMatrix() = default;
+
   template <typename component_t, typename projector_t>
   SymmetricKLDistanceMatrix(const std::vector<component_t> &cmps,
-                            const projector_t &proj)
-      : m_distances(Array::Zero(cmps.size() * (cmps.size() - 1) / 2)),
-        m_mask(Mask::Ones(cmps.size() * (cmps.size() - 1) / 2)),
-        m_mapToPair(m_distances.size()),
-        m_numberComponents(cmps.size()) {
+                            const projector_t &proj) {
+    reset(cmps, proj);
+  }
+
+  /// Compute the distances for a new set of components, reusing the storage
+  template <typename component_t, typename projector_t>
+  void reset(const std::vector<component_t> &cmps, const projector_t &proj) {
+    m_numberComponents = cmps.size();
+    m_distances.resize(rowOffset(m_numberComponents));
+    m_qop.resize(m_numberComponents);
+    m_var.resize(m_numberComponents);
+    m_invVar.resize(m_numberComponents);
+    m_rowMin.assign(m_numberComponents, s_masked);
+    m_rowArgMin.assign(m_numberComponents, 0);
+
+    for (auto i = 0ul; i < m_numberComponents; ++i) {
+      setComponent(i, cmps[i], proj);
+    }
     for (auto i = 1ul; i < m_numberComponents; ++i) {
-      const auto indexConst = (i - 1) * i / 2;
-      for (auto j = 0ul; j < i; ++j) {
-        m_mapToPair.at(indexConst + j) = {i, j};
-        m_distances[indexConst + j] =
-            computeSymmetricKlDivergence(cmps[i], cmps[j], proj);
-      }
+      row(i) = rowDistances(i);
+      updateRowMin(i);
     }
   }
 
   auto at(std::size_t i, std::size_t j) const {
-    return m_distances[i * (i - 1) / 2 + j];
+    return m_distances[rowOffset(i) + j];
   }
 
   template <typename component_t, typename projector_t>
@@ -117,28 +201,45 @@ class SymmetricKLDistanceMatrix {
                                     const projector_t &proj) {
     assert(cmps.size() == m_numberComponents && "size mismatch");
 
-    setAssociated(n, m_distances, [&](std::size_t i, std::size_t j) {
-      return computeSymmetricKlDivergence(cmps[i], cmps[j], proj);
-    });
+    setComponent(n, cmps[n], proj);
+
+    // Masked distances stay masked
+    auto rowN = row(n);
+    rowN = (rowN == s_masked).select(rowN, rowDistances(n));
+    updateRowMin(n);
+
+    for (auto i = n + 1; i < m_numberComponents; ++i) {
+      Acts::ActsScalar &d = m_distances[rowOffset(i) + n];
+      if (d != s_masked) {
+        d = distance(i, n);
+        updateRowMin(i, n);
+      }
+    }
   }
 
   void maskAssociatedDistances(std::size_t n) {
-    setAssociated(n, m_mask, [&](std::size_t, std::size_t) { return false; });
+    row(n).setConstant(s_masked);
+    m_rowMin[n] = s_masked;
+    m_rowArgMin[n] = 0;
+
+    for (auto i = n + 1; i < m_numberComponents; ++i) {
+      m_distances[rowOffset(i) + n] = s_masked;
+      updateRowMin(i, n);
+    }
   }
 
-  auto minDistancePair() const {
-    auto min = std::numeric_limits<Acts::ActsScalar>::max();
-    std::size_t idx = 0;
+  std::pair<std::size_t, std::size_t> minDistancePair() const {
+    auto min = s_masked;
+    std::pair<std::size_t, std::size_t> pair = {1, 0};
 
-    for (auto i = 0l; i < m_distances.size(); ++i) {
-      if (auto new_min = std::min(min, m_distances[i]);
-          m_mask[i] && new_min < min) {
-        min = new_min;
-        idx = i;
+    for (auto i = 1ul; i < m_numberComponents; ++i) {
+      if (m_rowMin[i] < min) {
+        min = m_rowMin[i];
+        pair = {i, m_rowArgMin[i]};
       }
     }
 
-    return m_mapToPair.at(idx);
+    return pair;
   }
 
   friend std::ostream &operator<<(std::ostream &os,
@@ -13,11 +13,18 @@
 #include "Acts/Vertexing/TrackAtVertex.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 
-#include <map>
+#include <cstddef>
+#include <optional>
+#include <vector>
 
 namespace Acts {
 
 /// @brief Helper struct for storing vertex related information
+///
+/// The tracks of the vertex are stored in parallel arrays, i.e. the i-th
+/// entries of trackLinks, trackIndices, tracksAtVertex and impactParams3D
+/// belong to the same track. They are filled by
+/// AdaptiveMultiVertexFitter::State::addTrack.
 struct VertexInfo {
   VertexInfo() = default;
 
@@ -47,7 +54,14 @@ struct VertexInfo {
   // Vector of all tracks that are currently assigned to vertex
   std::vector<InputTrack> trackLinks;
 
-  std::map<InputTrack, const BoundTrackParameters> impactParams3D;
+  // Indices of the tracks in the fitter state
+  std::vector<std::size_t> trackIndices;
+
+  // The tracks at the vertex, one for each track link
+  std::vector<TrackAtVertex> tracksAtVertex;
+
+  // The 3D impact parameters of the tracks, which are only set once
+  std::vector<std::optional<BoundTrackParameters>> impactParams3D;
 };
 
 }  // namespace Acts
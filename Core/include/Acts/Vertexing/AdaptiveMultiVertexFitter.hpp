@@ -23,7 +23,12 @@
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
 
 namespace Acts {
 
@@ -37,14 +42,28 @@ namespace Acts {
 class AdaptiveMultiVertexFitter {
  public:
   /// @brief The fitter state
+  ///
+  /// Vertices and tracks are identified by dense indices which are assigned
+  /// when they are first added to the state. All per-vertex data lives in
+  /// VertexInfo objects indexed by the vertex index, and for each track the
+  /// state stores the vertices it is linked to, so that the fit does not need
+  /// any lookups keyed by pointers.
   struct State {
     State(const MagneticFieldProvider& field,
           const Acts::MagneticFieldContext& magContext)
         : ipState{field.makeCache(magContext)},
           fieldCache(field.makeCache(magContext)) {}
 
-    // Vertex collection to be fitted
-    std::vector<Vertex*> vertexCollection;
+    /// Link of a track to one of its vertices
+    struct TrackLink {
+      /// Index of the vertex
+      std::size_t vertex = 0;
+      /// Position of the track in the tracks of the vertex
+      std::size_t link = 0;
+    };
+
+    // Indices of the vertices to be fitted
+    std::vector<std::size_t> vertexCollection;
 
     // Annealing state
     AnnealingUtility::State annealingState;
@@ -53,45 +72,71 @@ class AdaptiveMultiVertexFitter {
 
     MagneticFieldProvider::Cache fieldCache;
 
-    // Map to store vertices information
+    // All vertices known to the state, indexed by the vertex index
     // @TODO Does this have to be a mutable pointer?
-    std::map<Vertex*, VertexInfo> vtxInfoMap;
+    std::vector<Vertex*> vertices;
+
+    // Information of all vertices, indexed by the vertex index
+    std::vector<VertexInfo> vertexInfos;
+
+    // Vertices each track is linked to, indexed by the track index
+    std::vector<boost::container::small_vector<TrackLink, 4>> trackToVertices;
 
-    std::multimap<InputTrack, Vertex*> trackToVerticesMultiMap;
+    // Index of each vertex
+    std::unordered_map<const Vertex*, std::size_t> vertexIndices;
 
-    std::map<std::pair<InputTrack, Vertex*>, TrackAtVertex> tracksAtVerticesMap;
+    // Index of each track
+    std::unordered_map<InputTrack, std::size_t> trackIndices;
 
-    // Adds a vertex to trackToVerticesMultiMap
-    void addVertexToMultiMap(Vertex& vtx) {
-      for (auto trk : vtxInfoMap[&vtx].trackLinks) {
-        trackToVerticesMultiMap.emplace(trk, &vtx);
-      }
+    // Buffer for the compatibilities of a track with its vertices
+    std::vector<double> compatibilities;
+
+    /// Adds a vertex to the state or resets the information of a vertex
+    /// which is already known. In the latter case, the vertex is unlinked
+    /// from its tracks and loses them.
+    ///
+    /// @param vtx The vertex
+    /// @param vtxInfo The vertex information without any tracks
+    ///
+    /// @return The index of the vertex
+    std::size_t addVertex(Vertex& vtx, VertexInfo vtxInfo);
+
+    /// Returns the index of a vertex which was added to the state
+    std::size_t vertexIndex(const Vertex& vtx) const {
+      return vertexIndices.at(&vtx);
     }
 
-    // Removes a vertex from trackToVerticesMultiMap
-    void removeVertexFromMultiMap(Vertex& vtx) {
-      for (auto iter = trackToVerticesMultiMap.begin();
-           iter != trackToVerticesMultiMap.end();) {
-        if (iter->second == &vtx) {
-          iter = trackToVerticesMultiMap.erase(iter);
-        } else {
-          ++iter;
-        }
-      }
+    /// Returns the information of a vertex which was added to the state
+    VertexInfo& vertexInfo(const Vertex& vtx) {
+      return vertexInfos[vertexIndex(vtx)];
     }
 
-    Result<void> removeVertexFromCollection(Vertex& vtxToRemove,
-                                            const Logger& logger) {
-      auto it = std::ranges::find(vertexCollection, &vtxToRemove);
-      // Check if the value was found before erasing
-      if (it == vertexCollection.end()) {
-        ACTS_ERROR("vtxToRemove is not part of vertexCollection.");
-        return VertexingError::ElementNotFound;
-      }
-      // Erase the element if found
-      vertexCollection.erase(it);
-      return {};
+    /// @copydoc vertexInfo
+    const VertexInfo& vertexInfo(const Vertex& vtx) const {
+      return vertexInfos[vertexIndex(vtx)];
     }
+
+    /// Assigns a track to a vertex which was added to the state
+    ///
+    /// @param vtx The vertex
+    /// @param trk The track
+    /// @param trkAtVtx The track at the vertex
+    void addTrack(Vertex& vtx, const InputTrack& trk, TrackAtVertex trkAtVtx);
+
+    /// Returns the track at a vertex
+    ///
+    /// @param vtx The vertex
+    /// @param trk A track which was assigned to the vertex
+    TrackAtVertex& trackAtVertex(const Vertex& vtx, const InputTrack& trk);
+
+    // Links all tracks of a vertex to the vertex
+    void linkVertexTracks(const Vertex& vtx);
+
+    // Removes the links of all tracks of a vertex to the vertex
+    void unlinkVertexTracks(const Vertex& vtx);
+
+    Result<void> removeVertexFromCollection(const Vertex& vtxToRemove,
+                                            const Logger& logger);
   };
 
   struct Config {
@@ -199,35 +244,26 @@ class AdaptiveMultiVertexFitter {
   /// Private access to logging instance
   const Logger& logger() const { return *m_logger; }
 
-  /// @brief Tests if vertex is already in list of vertices or not
-  ///
-  /// @param vtx Vertex to test
-  /// @param verticesVec Vector of vertices to search
-  ///
-  /// @return True if vtx is already in verticesVec
-  bool isAlreadyInList(Vertex* vtx,
-                       const std::vector<Vertex*>& verticesVec) const;
-
   /// @brief 1) Calls ImpactPointEstimator::estimate3DImpactParameters
   /// for all tracks that are associated with vtx (i.e., all elements
   /// of the trackLinks vector in the VertexInfo of vtx).
   /// 2) Saves the 3D impact parameters in the VertexInfo of vtx.
   ///
   /// @param state Vertex fitter state
-  /// @param vtx Vertex object
+  /// @param vtx Index of the vertex
   /// @param vertexingOptions Vertexing options
   Result<void> prepareVertexForFit(
-      State& state, Vertex* vtx,
+      State& state, std::size_t vtx,
       const VertexingOptions& vertexingOptions) const;
 
   /// @brief Sets the vertexCompatibility for all TrackAtVertex objects
   /// at the current vertex
   ///
   /// @param state Fitter state
-  /// @param currentVtx Current vertex
+  /// @param currentVtx Index of the current vertex
   /// @param vertexingOptions Vertexing options
   Result<void> setAllVertexCompatibilities(
-      State& state, Vertex* currentVtx,
+      State& state, std::size_t currentVtx,
       const VertexingOptions& vertexingOptions) const;
 
   /// @brief Sets weights to the track according to Eq.(5.46) in Ref.(1)
@@ -238,15 +274,13 @@ class AdaptiveMultiVertexFitter {
   Result<void> setWeightsAndUpdate(
       State& state, const VertexingOptions& vertexingOptions) const;
 
-  /// @brief Collects the compatibility values of the track `trk`
-  /// wrt to all of its associated vertices
+  /// @brief Collects the compatibility values of a track wrt to all of its
+  /// associated vertices into state.compatibilities
   ///
   /// @param state Fitter state
-  /// @param trk Track
-  ///
-  /// @return Vector of compatibility values
-  std::vector<double> collectTrackToVertexCompatibilities(
-      State& state, const InputTrack& trk) const;
+  /// @param trk Index of the track
+  void collectTrackToVertexCompatibilities(State& state,
+                                           std::size_t trk) const;
 
   /// @brief Determines if any vertex position has shifted more than
   /// m_cfg.maxRelativeShift in the last iteration
@@ -17,6 +17,7 @@
 #include <iomanip>
 #include <ostream>
 #include <type_traits>
+#include <vector>
 
 #include <boost/histogram.hpp>
 #include <boost/histogram/axis/category.hpp>
@@ -295,6 +296,109 @@ void VectorMultiTrajectory::reserve(std::size_t n) {
   }
 }
 
+auto VectorMultiTrajectory::compact(const std::vector<bool>& keep)
+    -> std::vector<IndexType> {
+  throw_assert(keep.size() == m_index.size(),
+               "Compaction mask does not match the number of track states");
+
+  // number the flagged entries consecutively
+  auto renumber = [](const std::vector<bool>& used) {
+    std::vector<IndexType> newIndex(used.size(), kInvalid);
+    IndexType n = 0;
+    for (std::size_t i = 0; i < used.size(); ++i) {
+      if (used[i]) {
+        newIndex[i] = n++;
+      }
+    }
+    return newIndex;
+  };
+  auto remap = [](const std::vector<IndexType>& newIndex, IndexType i) {
+    return i == kInvalid ? kInvalid : newIndex[i];
+  };
+
+  // find the component storage which is referenced by the kept track states
+  std::vector<bool> usedParams(m_params.size(), false);
+  std::vector<bool> usedJacobians(m_jac.size(), false);
+  std::vector<bool> usedProjectors(m_projectors.size(), false);
+  std::vector<bool> usedSourceLinks(m_sourceLinks.size(), false);
+  auto markUsed = [](std::vector<bool>& used, IndexType i) {
+    if (i != kInvalid) {
+      used[i] = true;
+    }
+  };
+  for (std::size_t istate = 0; istate < m_index.size(); ++istate) {
+    if (!keep[istate]) {
+      continue;
+    }
+    const IndexData& p = m_index[istate];
+    markUsed(usedParams, p.ipredicted);
+    markUsed(usedParams, p.ifiltered);
+    markUsed(usedParams, p.ismoothed);
+    markUsed(usedJacobians, p.ijacobian);
+    markUsed(usedProjectors, p.iprojector);
+    markUsed(usedSourceLinks, p.iUncalibrated);
+    markUsed(usedSourceLinks, p.iCalibratedSourceLink);
+  }
+
+  const std::vector<IndexType> newStates = renumber(keep);
+  const std::vector<IndexType> newParams = renumber(usedParams);
+  const std::vector<IndexType> newJacobians = renumber(usedJacobians);
+  const std::vector<IndexType> newProjectors = renumber(usedProjectors);
+  const std::vector<IndexType> newSourceLinks = renumber(usedSourceLinks);
+
+  // the calibrated measurements are not shared, but their storage is not
+  // necessarily ordered like the track states
+  std::vector<double> meas;
+  std::vector<double> measCov;
+  for (std::size_t istate = 0; istate < m_index.size(); ++istate) {
+    if (!keep[istate]) {
+      continue;
+    }
+    IndexData& p = m_index[istate];
+    p.ipredicted = remap(newParams, p.ipredicted);
+    p.ifiltered = remap(newParams, p.ifiltered);
+    p.ismoothed = remap(newParams, p.ismoothed);
+    p.ijacobian = remap(newJacobians, p.ijacobian);
+    p.iprojector = remap(newProjectors, p.iprojector);
+    p.iUncalibrated = remap(newSourceLinks, p.iUncalibrated);
+    p.iCalibratedSourceLink = remap(newSourceLinks, p.iCalibratedSourceLink);
+
+    m_previous[istate] = remap(newStates, m_previous[istate]);
+    m_next[istate] = remap(newStates, m_next[istate]);
+
+    if (IndexType& offset = m_measOffset[istate]; offset != kInvalid) {
+      auto begin = m_meas.begin() + offset;
+      offset = static_cast<IndexType>(meas.size());
+      meas.insert(meas.end(), begin, begin + p.measdim);
+    }
+    if (IndexType& offset = m_measCovOffset[istate]; offset != kInvalid) {
+      auto begin = m_measCov.begin() + offset;
+      offset = static_cast<IndexType>(measCov.size());
+      measCov.insert(measCov.end(), begin, begin + p.measdim * p.measdim);
+    }
+  }
+  m_meas.assign(meas.begin(), meas.end());
+  m_measCov.assign(measCov.begin(), measCov.end());
+
+  detail::compactVector(m_index, keep);
+  detail::compactVector(m_previous, keep);
+  detail::compactVector(m_next, keep);
+  detail::compactVector(m_measOffset, keep);
+  detail::compactVector(m_measCovOffset, keep);
+  detail::compactVector(m_referenceSurfaces, keep);
+  for (auto& [key, vec] : m_dynamic) {
+    vec->compact(keep);
+  }
+
+  detail::compactVector(m_params, usedParams);
+  detail::compactVector(m_cov, usedParams);
+  detail::compactVector(m_jac, usedJacobians);
+  detail::compactVector(m_projectors, usedProjectors);
+  detail::compactVector(m_sourceLinks, usedSourceLinks);
+
+  return newStates;
+}
+
 void VectorMultiTrajectory::copyDynamicFrom_impl(IndexType dstIdx,
                                                  HashedString key,
                                                  const std::any& srcPtr) {
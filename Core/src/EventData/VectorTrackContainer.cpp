@@ -10,8 +10,10 @@
 
 #include "Acts/EventData/ParticleHypothesis.hpp"
 #include "Acts/Utilities/HashedString.hpp"
+#include "Acts/Utilities/ThrowAssert.hpp"
 
 #include <iterator>
+#include <vector>
 
 namespace Acts {
 
@@ -100,6 +102,43 @@ void VectorTrackContainer::removeTrack_impl(IndexType itrack) {
   }
 }
 
+void VectorTrackContainer::compact(
+    const std::vector<bool>& keep,
+    const std::vector<IndexType>& newTrackStateIndices) {
+  throw_assert(keep.size() == m_tipIndex.size(),
+               "Compaction mask does not match the number of tracks");
+
+  auto remap = [&](IndexType istate) {
+    return istate == kInvalid ? kInvalid : newTrackStateIndices.at(istate);
+  };
+  for (IndexType itrack = 0; itrack < m_tipIndex.size(); ++itrack) {
+    m_tipIndex[itrack] = remap(m_tipIndex[itrack]);
+    m_stemIndex[itrack] = remap(m_stemIndex[itrack]);
+  }
+
+  detail::compactVector(m_tipIndex, keep);
+  detail::compactVector(m_stemIndex, keep);
+
+  detail::compactVector(m_particleHypothesis, keep);
+
+  detail::compactVector(m_params, keep);
+  detail::compactVector(m_cov, keep);
+  detail::compactVector(m_referenceSurfaces, keep);
+
+  detail::compactVector(m_nMeasurements, keep);
+  detail::compactVector(m_nHoles, keep);
+
+  detail::compactVector(m_chi2, keep);
+  detail::compactVector(m_ndf, keep);
+
+  detail::compactVector(m_nOutliers, keep);
+  detail::compactVector(m_nSharedHits, keep);
+
+  for (auto& [key, vec] : m_dynamic) {
+    vec->compact(keep);
+  }
+}
+
 void VectorTrackContainer::copyDynamicFrom_impl(IndexType dstIdx,
                                                 HashedString key,
                                                 const std::any& srcPtr) {
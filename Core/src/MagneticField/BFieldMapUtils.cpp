@@ -129,7 +129,8 @@ Acts::fieldMapRZ(
   // [5] Create the mapper & BField Service
   // create field mapping
   return Acts::InterpolatedBFieldMap<Grid_t>(
-      {transformPos, transformBField, std::move(grid)});
+      {transformPos, transformBField, std::move(grid), 1.,
+       transformPosJacobianRZ, transformBFieldJacobianRZ});
 }
 
 Acts::InterpolatedBFieldMap<
@@ -236,6 +237,15 @@ Acts::fieldMapXYZ(
   // map (x,y,z) -> (r,z)
   auto transformPos = [](const Acts::Vector3& pos) { return pos; };
 
+  // the jacobians of the identity mappings are trivial
+  auto transformPosJacobian = [](const Acts::Vector3& /*pos*/) {
+    return Acts::ActsMatrix<3, 3>::Identity().eval();
+  };
+  auto transformBFieldJacobian = [](const Acts::Vector3& /*field*/,
+                                    const Acts::Vector3& /*pos*/) {
+    return Acts::ActsMatrix<3, 3>::Zero().eval();
+  };
+
   // [4] Create the transformation for the bfield
   // map (Bx,By,Bz) -> (Bx,By,Bz)
   auto transformBField = [](const Acts::Vector3& field,
@@ -244,7 +254,8 @@ Acts::fieldMapXYZ(
   // [5] Create the mapper & BField Service
   // create field mapping
   return Acts::InterpolatedBFieldMap<Grid_t>(
-      {transformPos, transformBField, std::move(grid)});
+      {transformPos, transformBField, std::move(grid), 1.,
+       transformPosJacobian, transformBFieldJacobian});
 }
 
 Acts::InterpolatedBFieldMap<
@@ -320,6 +331,37 @@ Acts::solenoidFieldMap(std::pair<double, double> rlim,
   // Create the mapper & BField Service
   // create field mapping
   Acts::InterpolatedBFieldMap<Grid_t> map(
-      {transformPos, transformBField, std::move(grid)});
+      {transformPos, transformBField, std::move(grid), 1.,
+       transformPosJacobianRZ, transformBFieldJacobianRZ});
   return map;
 }
+
+Acts::ActsMatrix<2, 3> Acts::transformPosJacobianRZ(const Acts::Vector3& pos) {
+  Acts::ActsMatrix<2, 3> jacobian = Acts::ActsMatrix<2, 3>::Zero();
+  double r = perp(pos);
+  if (r > std::numeric_limits<double>::min()) {
+    jacobian(0, 0) = pos.x() / r;
+    jacobian(0, 1) = pos.y() / r;
+  } else {
+    // consistent with the choice of phi = 0 for the field transformation
+    jacobian(0, 0) = 1.;
+  }
+  jacobian(1, 2) = 1.;
+  return jacobian;
+}
+
+Acts::ActsMatrix<3, 3> Acts::transformBFieldJacobianRZ(
+    const Acts::Vector2& field, const Acts::Vector3& pos) {
+  // (Bx,By) = Br * (x,y) / r, the field along z does not depend on phi
+  Acts::ActsMatrix<3, 3> jacobian = Acts::ActsMatrix<3, 3>::Zero();
+  double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+  if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+    double inv_r_sin_theta_3 = 1. / (r_sin_theta_2 * std::sqrt(r_sin_theta_2));
+    jacobian(0, 0) = pos.y() * pos.y() * inv_r_sin_theta_3;
+    jacobian(0, 1) = -pos.x() * pos.y() * inv_r_sin_theta_3;
+    jacobian(1, 0) = -pos.x() * pos.y() * inv_r_sin_theta_3;
+    jacobian(1, 1) = pos.x() * pos.x() * inv_r_sin_theta_3;
+    jacobian *= field.x();
+  }
+  return jacobian;
+}
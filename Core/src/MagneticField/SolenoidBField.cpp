@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 #define BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
 
@@ -63,6 +64,32 @@ Acts::Result<Acts::Vector3> Acts::SolenoidBField::getFieldGradient(
   return Result<Vector3>::success(getField(position));
 }
 
+Acts::Result<void> Acts::SolenoidBField::getFields(
+    std::span<const Vector3> positions, std::span<Vector3> fields,
+    MagneticFieldProvider::Cache& /*cache*/) const {
+  if (positions.size() != fields.size()) {
+    throw std::invalid_argument(
+        "Number of positions and field values do not match");
+  }
+  // non-virtual lookups, the solenoid field is defined everywhere
+  std::ranges::transform(positions, fields.begin(),
+                         [this](const Vector3& pos) { return getField(pos); });
+  return Result<void>::success();
+}
+
+Acts::Result<void> Acts::SolenoidBField::getFields(
+    std::span<const Vector3> positions, std::span<Vector3> fields,
+    std::span<MagneticFieldProvider::Cache* const> caches) const {
+  if (positions.size() != fields.size() || positions.size() != caches.size()) {
+    throw std::invalid_argument(
+        "Number of positions, field values and caches do not match");
+  }
+  // the caches do not hold any state
+  std::ranges::transform(positions, fields.begin(),
+                         [this](const Vector3& pos) { return getField(pos); });
+  return Result<void>::success();
+}
+
 Acts::Vector2 Acts::SolenoidBField::multiCoilField(const Vector2& pos,
                                                    double scale) const {
   // iterate over all coils
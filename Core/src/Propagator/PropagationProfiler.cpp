@@ -0,0 +1,135 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/PropagationProfiler.hpp"
+
+#include "Acts/Definitions/Units.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+namespace Acts {
+
+std::string_view PropagationProfile::name(StepLimit limit) {
+  switch (limit) {
+    case StepLimit::actor:
+      return "actor";
+    case StepLimit::aborter:
+      return "aborter";
+    case StepLimit::user:
+      return "user";
+    case StepLimit::accuracy:
+      return "accuracy";
+    case StepLimit::errorControl:
+      return "error control";
+  }
+  return "unknown";
+}
+
+PropagationProfile::VolumeCost& PropagationProfile::VolumeCost::operator+=(
+    const VolumeCost& other) {
+  steps += other.steps;
+  retargets += other.retargets;
+  pathLength += other.pathLength;
+  time += other.time;
+  for (std::size_t i = 0; i < s_nStepLimits; ++i) {
+    limits[i] += other.limits[i];
+  }
+  return *this;
+}
+
+void PropagationProfile::merge(const VolumeCosts& costs) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ++m_propagations;
+  for (const auto& [volume, cost] : costs) {
+    m_volumes[volume] += cost;
+  }
+}
+
+std::size_t PropagationProfile::propagations() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_propagations;
+}
+
+std::vector<std::pair<GeometryIdentifier, PropagationProfile::VolumeCost>>
+PropagationProfile::volumes() const {
+  std::vector<std::pair<GeometryIdentifier, VolumeCost>> volumes;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    volumes.assign(m_volumes.begin(), m_volumes.end());
+  }
+  std::ranges::sort(volumes, [](const auto& a, const auto& b) {
+    return a.second.time > b.second.time;
+  });
+  return volumes;
+}
+
+PropagationProfile::VolumeCost PropagationProfile::total() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  VolumeCost total;
+  for (const auto& [volume, cost] : m_volumes) {
+    total += cost;
+  }
+  return total;
+}
+
+void PropagationProfile::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_propagations = 0;
+  m_volumes.clear();
+}
+
+std::ostream& PropagationProfile::toStream(std::ostream& os) const {
+  const auto volumes = this->volumes();
+  const VolumeCost all = total();
+  const std::size_t nPropagations = propagations();
+
+  auto percent = [](double part, double whole) {
+    return whole > 0 ? 100 * part / whole : 0.;
+  };
+
+  os << "Propagation profile of " << nPropagations << " propagations\n";
+  os << std::left << std::setw(24) << "volume" << std::right << std::setw(10)
+     << "time[%]" << std::setw(12) << "steps" << std::setw(12)
+     << "path[mm]" << std::setw(10) << "retarget";
+  for (std::size_t i = 0; i < s_nStepLimits; ++i) {
+    std::string header{name(static_cast<StepLimit>(i))};
+    os << std::setw(18) << header + "[%]";
+  }
+  os << "\n";
+
+  auto printRow = [&](const std::string& label, const VolumeCost& cost) {
+    os << std::left << std::setw(24) << label << std::right << std::fixed
+       << std::setprecision(1) << std::setw(10)
+       << percent(cost.time.count(), all.time.count()) << std::setw(12)
+       << cost.steps << std::setw(12) << cost.pathLength / UnitConstants::mm
+       << std::setw(10) << cost.retargets;
+    for (std::size_t i = 0; i < s_nStepLimits; ++i) {
+      os << std::setw(18) << percent(cost.limits[i], cost.steps);
+    }
+    os << "\n";
+  };
+
+  for (const auto& [volume, cost] : volumes) {
+    std::stringstream label;
+    label << volume;
+    printRow(label.str(), cost);
+  }
+  printRow("total", all);
+
+  return os;
+}
+
+std::ostream& operator<<(std::ostream& os, const PropagationProfile& profile) {
+  return profile.toStream(os);
+}
+
+}  // namespace Acts
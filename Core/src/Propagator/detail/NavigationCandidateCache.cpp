@@ -0,0 +1,27 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/detail/NavigationCandidateCache.hpp"
+
+#include <atomic>
+
+namespace Acts::detail {
+
+NavigationCandidateCache& NavigationCandidateCache::local() {
+  thread_local NavigationCandidateCache cache;
+  return cache;
+}
+
+std::uint64_t NavigationCandidateCache::makeOwnerId() {
+  // ids are never reused, so entries of a destroyed navigator can not be
+  // picked up by a new one with a different geometry
+  static std::atomic<std::uint64_t> nextId{1};
+  return nextId.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace Acts::detail
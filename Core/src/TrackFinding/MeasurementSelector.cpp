@@ -139,4 +139,76 @@ Result<MeasurementSelector::Cuts> MeasurementSelector::getCuts(
   return getCutsByTheta(*cuts, theta);
 }
 
+Result<std::size_t> MeasurementSelector::selectByChi2(
+    const GeometryIdentifier& geoID, double theta,
+    std::span<const double> chi2, std::span<std::size_t> selected,
+    bool& isOutlier, const Logger& logger) const {
+  ACTS_VERBOSE("Invoked MeasurementSelector on precomputed chi2");
+
+  assert(selected.size() == chi2.size() && "Invalid selection output size");
+
+  // Return error if no measurement
+  if (chi2.empty()) {
+    return CombinatorialKalmanFilterError::MeasurementSelectionFailed;
+  }
+
+  const auto cutsResult = getCuts(geoID, theta);
+  if (!cutsResult.ok()) {
+    return cutsResult.error();
+  }
+  const Cuts& cuts = *cutsResult;
+
+  if (cuts.numMeasurements == 0ul) {
+    return CombinatorialKalmanFilterError::MeasurementSelectionFailed;
+  }
+
+  double minChi2 = std::numeric_limits<double>::max();
+  std::size_t minIndex = std::numeric_limits<std::size_t>::max();
+
+  isOutlier = false;
+
+  // Collect the candidates which pass the chi2 cut in their original order,
+  // which matches the order after the partitioning in `select`
+  std::size_t passedCandidates = 0ul;
+  for (std::size_t i = 0ul; i < chi2.size(); ++i) {
+    if (chi2[i] < minChi2) {
+      minChi2 = chi2[i];
+      minIndex = i;
+    }
+    if (chi2[i] < cuts.chi2Measurement) {
+      selected[passedCandidates++] = i;
+    }
+  }
+
+  // Handle if there are no measurements below the chi2 cut off
+  if (passedCandidates == 0ul) {
+    if (minChi2 < cuts.chi2Outlier) {
+      ACTS_VERBOSE(
+          "No measurement candidate. Return an outlier measurement chi2="
+          << minChi2);
+      isOutlier = true;
+      selected[0] = minIndex;
+      return 1ul;
+    }
+    ACTS_VERBOSE("No measurement candidate. Return empty chi2=" << minChi2);
+    return 0ul;
+  }
+
+  if (passedCandidates <= 1ul) {
+    ACTS_VERBOSE("Returning only 1 element chi2=" << minChi2);
+    selected[0] = minIndex;
+    return 1ul;
+  }
+
+  std::sort(selected.begin(), selected.begin() + passedCandidates,
+            [&chi2](std::size_t a, std::size_t b) {
+              return chi2[a] < chi2[b];
+            });
+
+  ACTS_VERBOSE("Number of selected measurements: "
+               << passedCandidates << ", max: " << cuts.numMeasurements);
+
+  return std::min(cuts.numMeasurements, passedCandidates);
+}
+
 }  // namespace Acts
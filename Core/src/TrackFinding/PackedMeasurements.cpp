@@ -0,0 +1,258 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/TrackFinding/PackedMeasurements.hpp"
+
+#include "Acts/EventData/MeasurementHelpers.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+#include <boost/container/small_vector.hpp>
+
+namespace Acts {
+
+void PackedMeasurements::add(GeometryIdentifier geometryId, std::size_t size,
+                             const std::uint8_t* subspaceIndices,
+                             const double* parameters,
+                             const double* covariance) {
+  if (size == 0 || size > eBoundSize) {
+    throw std::invalid_argument("Invalid measurement size");
+  }
+
+  if (m_surfaces.empty() || m_surfaces.back().geometryId != geometryId) {
+    if (!m_surfaces.empty() && geometryId < m_surfaces.back().geometryId) {
+      throw std::invalid_argument(
+          "Packed measurements must be ordered by geometry identifier");
+    }
+    SurfaceRange& range = m_surfaces.emplace_back();
+    range.geometryId = geometryId;
+    range.begin1 = range.end1 = m_lane1.value.size();
+    range.begin2 = range.end2 = m_lane2.value0.size();
+    range.beginN = range.endN = m_laneN.size.size();
+  }
+
+  SurfaceRange& range = m_surfaces.back();
+  const std::uint32_t position = range.size++;
+
+  // the measurements are in lane order as long as no measurement of a later
+  // lane precedes them
+  if (size == 1) {
+    range.laneOrdered &=
+        range.end2 == range.begin2 && range.endN == range.beginN;
+    range.uniform1 &= range.end1 == range.begin1 ||
+                      m_lane1.index[range.begin1] == subspaceIndices[0];
+  } else if (size == 2) {
+    range.laneOrdered &= range.endN == range.beginN;
+    range.uniform2 &= range.end2 == range.begin2 ||
+                      (m_lane2.index0[range.begin2] == subspaceIndices[0] &&
+                       m_lane2.index1[range.begin2] == subspaceIndices[1]);
+  }
+
+  if (size == 1) {
+    m_lane1.value.push_back(parameters[0]);
+    m_lane1.variance.push_back(covariance[0]);
+    m_lane1.index.push_back(subspaceIndices[0]);
+    m_lane1.position.push_back(position);
+    ++range.end1;
+  } else if (size == 2) {
+    m_lane2.value0.push_back(parameters[0]);
+    m_lane2.value1.push_back(parameters[1]);
+    m_lane2.variance00.push_back(covariance[0]);
+    m_lane2.variance01.push_back(covariance[1]);
+    m_lane2.variance11.push_back(covariance[3]);
+    m_lane2.index0.push_back(subspaceIndices[0]);
+    m_lane2.index1.push_back(subspaceIndices[1]);
+    m_lane2.position.push_back(position);
+    ++range.end2;
+  } else {
+    std::array<std::uint8_t, eBoundSize> indices{};
+    std::copy_n(subspaceIndices, size, indices.begin());
+    m_laneN.size.push_back(size);
+    m_laneN.indices.push_back(indices);
+    m_laneN.offset.push_back(m_laneN.data.size());
+    m_laneN.position.push_back(position);
+    m_laneN.data.insert(m_laneN.data.end(), parameters, parameters + size);
+    m_laneN.data.insert(m_laneN.data.end(), covariance,
+                        covariance + size * size);
+    ++range.endN;
+  }
+}
+
+void PackedMeasurements::clear() {
+  m_surfaces.clear();
+
+  m_lane1.value.clear();
+  m_lane1.variance.clear();
+  m_lane1.index.clear();
+  m_lane1.position.clear();
+
+  m_lane2.value0.clear();
+  m_lane2.value1.clear();
+  m_lane2.variance00.clear();
+  m_lane2.variance01.clear();
+  m_lane2.variance11.clear();
+  m_lane2.index0.clear();
+  m_lane2.index1.clear();
+  m_lane2.position.clear();
+
+  m_laneN.size.clear();
+  m_laneN.indices.clear();
+  m_laneN.offset.clear();
+  m_laneN.position.clear();
+  m_laneN.data.clear();
+}
+
+std::size_t PackedMeasurements::size() const {
+  return m_lane1.value.size() + m_lane2.value0.size() + m_laneN.size.size();
+}
+
+const PackedMeasurements::SurfaceRange* PackedMeasurements::find(
+    GeometryIdentifier geometryId) const {
+  auto it = std::ranges::lower_bound(m_surfaces, geometryId, std::less<>{},
+                                     &SurfaceRange::geometryId);
+  if (it == m_surfaces.end() || it->geometryId != geometryId) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+void PackedMeasurements::chi2(const SurfaceRange& range,
+                              const BoundVector& predicted,
+                              const BoundSquareMatrix& predictedCovariance,
+                              std::span<double> chi2) const {
+  assert(chi2.size() == range.size && "Invalid chi2 output size");
+
+  // The measured parameters of the one and two dimensional lanes are
+  // compared with the predicted parameters in branch free loops over the
+  // contiguous component arrays. The chi2 of the lanes are written one after
+  // the other and only scattered to the positions of the measurements
+  // afterwards. If all measurements of a lane measure the same parameters,
+  // which is the common case, the projected prediction is the same for all of
+  // them and the compiler can vectorize the loop. Otherwise the projection is
+  // a gather of the measured indices.
+  const double* pred = predicted.data();
+  const double* predCov = predictedCovariance.data();
+
+  const std::uint32_t n1 = range.end1 - range.begin1;
+  const std::uint32_t n2 = range.end2 - range.begin2;
+  const std::uint32_t nN = range.endN - range.beginN;
+  double* chi2Lane1 = chi2.data();
+  double* chi2Lane2 = chi2Lane1 + n1;
+  double* chi2LaneN = chi2Lane2 + n2;
+
+  {
+    const double* value = m_lane1.value.data() + range.begin1;
+    const double* variance = m_lane1.variance.data() + range.begin1;
+    const std::uint8_t* index = m_lane1.index.data() + range.begin1;
+    if (range.uniform1 && n1 > 0) {
+      const std::uint8_t k = index[0];
+      const double p = pred[k];
+      const double pVar = predCov[k * eBoundSize + k];
+      for (std::uint32_t i = 0; i < n1; ++i) {
+        const double residual = value[i] - p;
+        const double var = variance[i] + pVar;
+        chi2Lane1[i] = residual * residual / var;
+      }
+    } else {
+      for (std::uint32_t i = 0; i < n1; ++i) {
+        const std::uint8_t k = index[i];
+        const double residual = value[i] - pred[k];
+        const double var = variance[i] + predCov[k * eBoundSize + k];
+        chi2Lane1[i] = residual * residual / var;
+      }
+    }
+  }
+
+  {
+    const double* value0 = m_lane2.value0.data() + range.begin2;
+    const double* value1 = m_lane2.value1.data() + range.begin2;
+    const double* variance00 = m_lane2.variance00.data() + range.begin2;
+    const double* variance01 = m_lane2.variance01.data() + range.begin2;
+    const double* variance11 = m_lane2.variance11.data() + range.begin2;
+    const std::uint8_t* index0 = m_lane2.index0.data() + range.begin2;
+    const std::uint8_t* index1 = m_lane2.index1.data() + range.begin2;
+    // the predicted covariance is symmetric, the storage order does not
+    // matter
+    if (range.uniform2 && n2 > 0) {
+      const std::uint8_t k0 = index0[0];
+      const std::uint8_t k1 = index1[0];
+      const double p0 = pred[k0];
+      const double p1 = pred[k1];
+      const double pVar00 = predCov[k0 * eBoundSize + k0];
+      const double pVar01 = predCov[k0 * eBoundSize + k1];
+      const double pVar11 = predCov[k1 * eBoundSize + k1];
+      for (std::uint32_t i = 0; i < n2; ++i) {
+        const double r0 = value0[i] - p0;
+        const double r1 = value1[i] - p1;
+        const double s00 = variance00[i] + pVar00;
+        const double s01 = variance01[i] + pVar01;
+        const double s11 = variance11[i] + pVar11;
+        const double det = s00 * s11 - s01 * s01;
+        chi2Lane2[i] =
+            (r0 * r0 * s11 - 2 * r0 * r1 * s01 + r1 * r1 * s00) / det;
+      }
+    } else {
+      for (std::uint32_t i = 0; i < n2; ++i) {
+        const std::uint8_t k0 = index0[i];
+        const std::uint8_t k1 = index1[i];
+        const double r0 = value0[i] - pred[k0];
+        const double r1 = value1[i] - pred[k1];
+        const double s00 = variance00[i] + predCov[k0 * eBoundSize + k0];
+        const double s01 = variance01[i] + predCov[k0 * eBoundSize + k1];
+        const double s11 = variance11[i] + predCov[k1 * eBoundSize + k1];
+        const double det = s00 * s11 - s01 * s01;
+        chi2Lane2[i] =
+            (r0 * r0 * s11 - 2 * r0 * r1 * s01 + r1 * r1 * s00) / det;
+      }
+    }
+  }
+
+  for (std::uint32_t i = 0; i < nN; ++i) {
+    const std::size_t size = m_laneN.size[range.beginN + i];
+    const std::array<std::uint8_t, eBoundSize>& indices =
+        m_laneN.indices[range.beginN + i];
+    const double* data = m_laneN.data.data() + m_laneN.offset[range.beginN + i];
+    chi2LaneN[i] = visit_measurement(size, [&](auto N) -> double {
+      constexpr std::size_t kSize = decltype(N)::value;
+      using Vector = ActsVector<kSize>;
+      using Matrix = ActsSquareMatrix<kSize>;
+
+      const Eigen::Map<const Vector> value(data);
+      Matrix covariance = Eigen::Map<const Matrix>(data + kSize);
+      Vector residual = value;
+      for (std::size_t r = 0; r < kSize; ++r) {
+        residual(r) -= predicted(indices[r]);
+        for (std::size_t c = 0; c < kSize; ++c) {
+          covariance(r, c) += predictedCovariance(indices[r], indices[c]);
+        }
+      }
+      return (residual.transpose() * covariance.inverse() * residual)
+          .eval()(0, 0);
+    });
+  }
+
+  if (range.laneOrdered) {
+    return;
+  }
+
+  const boost::container::small_vector<double, 16> laneChi2(chi2.begin(),
+                                                            chi2.end());
+  for (std::uint32_t i = 0; i < n1; ++i) {
+    chi2[m_lane1.position[range.begin1 + i]] = laneChi2[i];
+  }
+  for (std::uint32_t i = 0; i < n2; ++i) {
+    chi2[m_lane2.position[range.begin2 + i]] = laneChi2[n1 + i];
+  }
+  for (std::uint32_t i = 0; i < nN; ++i) {
+    chi2[m_laneN.position[range.beginN + i]] = laneChi2[n1 + n2 + i];
+  }
+}
+
+}  // namespace Acts
@@ -10,19 +10,123 @@
 
 #include "Acts/Definitions/TrackParametrization.hpp"
 
+#include <cassert>
+
+void Acts::Experimental::Gx2fSystem::addSurface(const BoundMatrix& jacobian) {
+  Surface& surface = m_surfaces.emplace_back();
+  surface.jacobian = jacobian;
+  m_jacobianFromStart = jacobian * m_jacobianFromStart;
+}
+
+void Acts::Experimental::Gx2fSystem::addMeasurement(
+    const BoundMatrix& information, const BoundVector& weightedResidual) {
+  assert(!m_surfaces.empty() && "No surface for the measurement");
+  Surface& surface = m_surfaces.back();
+  surface.information += information;
+  surface.weightedResidual += weightedResidual;
+
+  // the start parameters part of the dense system
+  m_aMatrix += m_jacobianFromStart.transpose() * information *
+               m_jacobianFromStart;
+  m_bVector += m_jacobianFromStart.transpose() * weightedResidual;
+}
+
+void Acts::Experimental::Gx2fSystem::addScattering(const Vector2& information,
+                                                   const Vector2& bVector) {
+  assert(!m_surfaces.empty() && "No surface for the scattering angles");
+  Surface& surface = m_surfaces.back();
+  assert(!surface.hasScattering && "Surface has already scattering angles");
+  surface.hasScattering = true;
+  surface.scatteringInformation = information;
+  surface.scatteringBVector = bVector;
+  ++m_nScatterers;
+}
+
+Acts::Experimental::Gx2fSystem::Solution
+Acts::Experimental::Gx2fSystem::solve() const {
+  const ActsMatrix<eBoundSize, 2>& projector =
+      Gx2fConstants::phiThetaProjector;
+
+  // What is needed per material surface to recover its scattering angles
+  // from the track parameters before the scattering
+  struct Elimination {
+    Eigen::LDLT<SquareMatrix2> system;
+    Vector2 bVector;
+    ActsMatrix<eBoundSize, 2> coupling;
+  };
+  std::vector<Elimination> eliminations(m_nScatterers);
+
+  // The chi2 of everything after a surface as a quadratic function of the
+  // track parameters on the surface, x^T A x - 2 b^T x. Going backwards, the
+  // scattering angles are eliminated one by one.
+  BoundMatrix aMatrix = BoundMatrix::Zero();
+  BoundVector bVector = BoundVector::Zero();
+  std::size_t iScatterer = m_nScatterers;
+  for (auto surface = m_surfaces.rbegin(); surface != m_surfaces.rend();
+       ++surface) {
+    if (surface->hasScattering) {
+      // minimise over the scattering angles s, which act on the parameters x
+      // before the scattering through x + P s
+      Elimination& elimination = eliminations[--iScatterer];
+      elimination.coupling = aMatrix * projector;
+      SquareMatrix2 system = projector.transpose() * elimination.coupling;
+      system.diagonal() += surface->scatteringInformation;
+      elimination.system.compute(system);
+      elimination.bVector =
+          projector.transpose() * bVector + surface->scatteringBVector;
+
+      aMatrix -= elimination.coupling *
+                 elimination.system.solve(elimination.coupling.transpose());
+      bVector -= elimination.coupling *
+                 elimination.system.solve(elimination.bVector);
+    }
+
+    aMatrix += surface->information;
+    bVector += surface->weightedResidual;
+
+    // transport to the previous surface
+    aMatrix = (surface->jacobian.transpose() * aMatrix * surface->jacobian)
+                  .eval();
+    bVector = (surface->jacobian.transpose() * bVector).eval();
+  }
+
+  Solution solution;
+  solution.information = aMatrix;
+  // The system might be singular if q/p or time are not measured, which is
+  // handled by the rank revealing decomposition
+  solution.deltaParams = aMatrix.colPivHouseholderQr().solve(bVector);
+
+  // Recover the scattering angles going forwards
+  solution.deltaScatteringAngles.reserve(m_nScatterers);
+  BoundVector delta = solution.deltaParams;
+  for (const Surface& surface : m_surfaces) {
+    delta = (surface.jacobian * delta).eval();
+    if (surface.hasScattering) {
+      const Elimination& elimination =
+          eliminations[solution.deltaScatteringAngles.size()];
+      const Vector2 deltaAngles = elimination.system.solve(
+          elimination.bVector - elimination.coupling.transpose() * delta);
+      solution.deltaScatteringAngles.push_back(deltaAngles);
+      delta += projector * deltaAngles;
+    }
+  }
+
+  return solution;
+}
+
 void Acts::Experimental::updateGx2fCovarianceParams(
-    BoundMatrix& fullCovariancePredicted, Eigen::MatrixXd& aMatrixExtended,
+    BoundMatrix& fullCovariancePredicted, BoundMatrix& information,
     const std::size_t ndfSystem) {
   // make invertible
-  for (int i = 0; i < aMatrixExtended.rows(); ++i) {
-    if (aMatrixExtended(i, i) == 0.) {
-      aMatrixExtended(i, i) = 1.;
+  for (int i = 0; i < information.rows(); ++i) {
+    if (information(i, i) == 0.) {
+      information(i, i) = 1.;
     }
   }
 
   visit_measurement(ndfSystem, [&](auto N) {
     fullCovariancePredicted.topLeftCorner<N, N>() =
-        aMatrixExtended.inverse().topLeftCorner<N, N>();
+        information.inverse().topLeftCorner<N, N>();
   });
 
   return;
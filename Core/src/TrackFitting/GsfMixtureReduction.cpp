@@ -16,7 +16,10 @@ template <typename proj_t, typename angle_desc_t>
 void reduceWithKLDistanceImpl(std::vector<Acts::GsfComponent> &cmpCache,
                               std::size_t maxCmpsAfterMerge, const proj_t &proj,
                               const angle_desc_t &desc) {
-  Acts::detail::SymmetricKLDistanceMatrix distances(cmpCache, proj);
+  // The distance matrix of a thread is reused for all reductions, so that
+  // its storage is only allocated for the largest mixture
+  thread_local Acts::detail::SymmetricKLDistanceMatrix distances;
+  distances.reset(cmpCache, proj);
 
   auto remainingComponents = cmpCache.size();
 
@@ -95,7 +95,7 @@ Result<std::vector<Vertex>> AdaptiveMultiVertexFinder::find(
       }
     }
     // Update fitter state with all vertices
-    fitterState.addVertexToMultiMap(vtxCandidate);
+    fitterState.linkVertexTracks(vtxCandidate);
 
     // Perform the fit
     auto fitResult = m_cfg.vertexFitter.addVtxToFit(fitterState, vtxCandidate,
@@ -260,11 +260,8 @@ Result<void> AdaptiveMultiVertexFinder::addCompatibleTracksToVertex(
     double ipSig = *sigRes;
     if (ipSig < m_cfg.tracksMaxSignificance) {
       // Create TrackAtVertex objects, unique for each (track, vertex) pair
-      fitterState.tracksAtVerticesMap.emplace(std::make_pair(trk, &vtx),
-                                              TrackAtVertex(params, trk));
-
-      // Add the original track parameters to the list for vtx
-      fitterState.vtxInfoMap[&vtx].trackLinks.push_back(trk);
+      // and add the original track parameters to the list for vtx
+      fitterState.addTrack(vtx, trk, TrackAtVertex(params, trk));
     }
   }
   return {};
@@ -279,7 +276,7 @@ Result<bool> AdaptiveMultiVertexFinder::canRecoverFromNoCompatibleTracks(
   // candidate were found
   // TODO: This is for now how it's done in athena... this look a bit
   // nasty to me
-  if (fitterState.vtxInfoMap[&vtx].trackLinks.empty()) {
+  if (fitterState.vertexInfo(vtx).trackLinks.empty()) {
     // Find nearest track to vertex candidate
     double smallestDeltaZ = std::numeric_limits<double>::max();
     double newZ = 0;
@@ -298,8 +295,8 @@ Result<bool> AdaptiveMultiVertexFinder::canRecoverFromNoCompatibleTracks(
       vtx.setFullPosition(Vector4(0., 0., newZ, 0.));
 
       // Update vertex info for current vertex
-      fitterState.vtxInfoMap[&vtx] =
-          VertexInfo(currentConstraint, vtx.fullPosition());
+      fitterState.addVertex(vtx,
+                            VertexInfo(currentConstraint, vtx.fullPosition()));
 
       // Try to add compatible track with adapted vertex position
       auto res = addCompatibleTracksToVertex(allTracks, vtx, fitterState,
@@ -308,7 +305,7 @@ Result<bool> AdaptiveMultiVertexFinder::canRecoverFromNoCompatibleTracks(
         return Result<bool>::failure(res.error());
       }
 
-      if (fitterState.vtxInfoMap[&vtx].trackLinks.empty()) {
+      if (fitterState.vertexInfo(vtx).trackLinks.empty()) {
         ACTS_DEBUG(
             "No tracks near seed were found, while at least one was "
             "expected. Break.");
@@ -330,8 +327,7 @@ Result<bool> AdaptiveMultiVertexFinder::canPrepareVertexForFit(
     const Vertex& currentConstraint, VertexFitterState& fitterState,
     const VertexingOptions& vertexingOptions) const {
   // Add vertex info to fitter state
-  fitterState.vtxInfoMap[&vtx] =
-      VertexInfo(currentConstraint, vtx.fullPosition());
+  fitterState.addVertex(vtx, VertexInfo(currentConstraint, vtx.fullPosition()));
 
   // Add all compatible tracks to vertex
   auto resComp = addCompatibleTracksToVertex(allTracks, vtx, fitterState,
@@ -356,9 +352,10 @@ std::pair<int, bool> AdaptiveMultiVertexFinder::checkVertexAndCompatibleTracks(
     VertexFitterState& fitterState, bool useVertexConstraintInFit) const {
   bool isGoodVertex = false;
   int nCompatibleTracks = 0;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  const VertexInfo& vtxInfo = fitterState.vertexInfo(vtx);
+  for (std::size_t i = 0; i < vtxInfo.trackLinks.size(); ++i) {
+    const auto& trk = vtxInfo.trackLinks[i];
+    const auto& trkAtVtx = vtxInfo.tracksAtVertex[i];
     if ((trkAtVtx.vertexCompatibility < m_cfg.maxVertexChi2 &&
          m_cfg.useFastCompatibility) ||
         (trkAtVtx.trackWeight > m_cfg.minWeight &&
@@ -389,9 +386,10 @@ auto AdaptiveMultiVertexFinder::removeCompatibleTracksFromSeedTracks(
     Vertex& vtx, std::vector<InputTrack>& seedTracks,
     VertexFitterState& fitterState,
     std::vector<InputTrack>& removedSeedTracks) const -> void {
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  const VertexInfo& vtxInfo = fitterState.vertexInfo(vtx);
+  for (std::size_t i = 0; i < vtxInfo.trackLinks.size(); ++i) {
+    const auto& trk = vtxInfo.trackLinks[i];
+    const auto& trkAtVtx = vtxInfo.tracksAtVertex[i];
     if ((trkAtVtx.vertexCompatibility < m_cfg.maxVertexChi2 &&
          m_cfg.useFastCompatibility) ||
         (trkAtVtx.trackWeight > m_cfg.minWeight &&
@@ -416,9 +414,10 @@ bool AdaptiveMultiVertexFinder::removeTrackIfIncompatible(
 
   auto maxCompSeedIt = seedTracks.end();
   std::optional<InputTrack> removedTrack = std::nullopt;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  const VertexInfo& vtxInfo = fitterState.vertexInfo(vtx);
+  for (std::size_t i = 0; i < vtxInfo.trackLinks.size(); ++i) {
+    const auto& trk = vtxInfo.trackLinks[i];
+    const auto& trkAtVtx = vtxInfo.tracksAtVertex[i];
     double compatibility = trkAtVtx.vertexCompatibility;
     if (compatibility > maxCompatibility) {
       // Try to find track in seed tracks
@@ -466,9 +465,7 @@ Result<bool> AdaptiveMultiVertexFinder::keepNewVertex(
   double contamination = 0.;
   double contaminationNum = 0;
   double contaminationDeNom = 0;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (const auto& trkAtVtx : fitterState.vertexInfo(vtx).tracksAtVertex) {
     double trackWeight = trkAtVtx.trackWeight;
     contaminationNum += trackWeight * (1. - trackWeight);
     // MARK: fpeMaskBegin(FLTUND, 1, #2590)
@@ -579,7 +576,7 @@ Result<void> AdaptiveMultiVertexFinder::deleteLastVertex(
   allVerticesPtr.pop_back();
 
   // Update fitter state with removed vertex candidate
-  fitterState.removeVertexFromMultiMap(vtx);
+  fitterState.unlinkVertexTracks(vtx);
   // fitterState.vertexCollection contains all vertices that will be fit. When
   // we called addVtxToFit, vtx and all vertices that share tracks with vtx were
   // added to vertexCollection. Now, we want to refit the same set of vertices
@@ -589,11 +586,9 @@ Result<void> AdaptiveMultiVertexFinder::deleteLastVertex(
     return removeResult.error();
   }
 
-  for (auto& entry : fitterState.tracksAtVerticesMap) {
-    // Delete all linearized tracks for current (bad) vertex
-    if (entry.first.second == &vtx) {
-      entry.second.isLinearized = false;
-    }
+  // Delete all linearized tracks for current (bad) vertex
+  for (auto& trkAtVtx : fitterState.vertexInfo(vtx).tracksAtVertex) {
+    trkAtVtx.isLinearized = false;
   }
 
   // If no vertices share tracks with vtx we don't need to refit
@@ -616,12 +611,7 @@ Result<std::vector<Vertex>> AdaptiveMultiVertexFinder::getVertexOutputList(
   std::vector<Vertex> outputVec;
   for (auto vtx : allVerticesPtr) {
     auto& outVtx = *vtx;
-    std::vector<TrackAtVertex> tracksAtVtx;
-    for (const auto& trk : fitterState.vtxInfoMap[vtx].trackLinks) {
-      tracksAtVtx.push_back(
-          fitterState.tracksAtVerticesMap.at(std::make_pair(trk, vtx)));
-    }
-    outVtx.setTracksAtVertex(std::move(tracksAtVtx));
+    outVtx.setTracksAtVertex(fitterState.vertexInfo(*vtx).tracksAtVertex);
     outputVec.push_back(outVtx);
   }
   return Result<std::vector<Vertex>>(outputVec);
@@ -13,6 +13,87 @@
 #include "Acts/Vertexing/KalmanVertexUpdater.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <stdexcept>
+
+std::size_t Acts::AdaptiveMultiVertexFitter::State::addVertex(
+    Vertex& vtx, VertexInfo vtxInfo) {
+  auto [it, inserted] = vertexIndices.try_emplace(&vtx, vertices.size());
+  if (inserted) {
+    vertices.push_back(&vtx);
+    vertexInfos.push_back(std::move(vtxInfo));
+  } else {
+    // The vertex, or a previous vertex at the same address, is reset
+    unlinkVertexTracks(vtx);
+    vertexInfos[it->second] = std::move(vtxInfo);
+  }
+  return it->second;
+}
+
+void Acts::AdaptiveMultiVertexFitter::State::addTrack(Vertex& vtx,
+                                                      const InputTrack& trk,
+                                                      TrackAtVertex trkAtVtx) {
+  auto [it, inserted] = trackIndices.try_emplace(trk, trackToVertices.size());
+  if (inserted) {
+    trackToVertices.emplace_back();
+  }
+  VertexInfo& vtxInfo = vertexInfo(vtx);
+  vtxInfo.trackLinks.push_back(trk);
+  vtxInfo.trackIndices.push_back(it->second);
+  vtxInfo.tracksAtVertex.push_back(std::move(trkAtVtx));
+  vtxInfo.impactParams3D.emplace_back();
+}
+
+Acts::TrackAtVertex& Acts::AdaptiveMultiVertexFitter::State::trackAtVertex(
+    const Vertex& vtx, const InputTrack& trk) {
+  VertexInfo& vtxInfo = vertexInfo(vtx);
+  auto it = std::ranges::find(vtxInfo.trackLinks, trk);
+  if (it == vtxInfo.trackLinks.end()) {
+    throw std::out_of_range("Track is not assigned to the vertex");
+  }
+  return vtxInfo.tracksAtVertex[std::distance(vtxInfo.trackLinks.begin(), it)];
+}
+
+void Acts::AdaptiveMultiVertexFitter::State::linkVertexTracks(
+    const Vertex& vtx) {
+  const std::size_t vtxIndex = vertexIndex(vtx);
+  const VertexInfo& vtxInfo = vertexInfos[vtxIndex];
+  for (std::size_t i = 0; i < vtxInfo.trackIndices.size(); ++i) {
+    trackToVertices[vtxInfo.trackIndices[i]].push_back({vtxIndex, i});
+  }
+}
+
+void Acts::AdaptiveMultiVertexFitter::State::unlinkVertexTracks(
+    const Vertex& vtx) {
+  const std::size_t vtxIndex = vertexIndex(vtx);
+  for (std::size_t trkIndex : vertexInfos[vtxIndex].trackIndices) {
+    auto& links = trackToVertices[trkIndex];
+    // Keep the order of the remaining links, which determines the order of
+    // the sum over the compatibilities in the annealing
+    links.erase(std::remove_if(links.begin(), links.end(),
+                               [&](const TrackLink& trkLink) {
+                                 return trkLink.vertex == vtxIndex;
+                               }),
+                links.end());
+  }
+}
+
+Acts::Result<void>
+Acts::AdaptiveMultiVertexFitter::State::removeVertexFromCollection(
+    const Vertex& vtxToRemove, const Logger& logger) {
+  auto vtxIt = vertexIndices.find(&vtxToRemove);
+  auto it = vtxIt == vertexIndices.end()
+                ? vertexCollection.end()
+                : std::ranges::find(vertexCollection, vtxIt->second);
+  // Check if the value was found before erasing
+  if (it == vertexCollection.end()) {
+    ACTS_ERROR("vtxToRemove is not part of vertexCollection.");
+    return VertexingError::ElementNotFound;
+  }
+  // Erase the element if found
+  vertexCollection.erase(it);
+  return {};
+}
+
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
     State& state, const VertexingOptions& vertexingOptions) const {
   // Reset annealing tool
@@ -32,8 +113,9 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
   while (nIter < m_cfg.maxIterations &&
          (!state.annealingState.equilibriumReached || !isSmallShift)) {
     // Initial loop over all vertices in state.vertexCollection
-    for (auto vtx : state.vertexCollection) {
-      VertexInfo& vtxInfo = state.vtxInfoMap[vtx];
+    for (std::size_t vtxIndex : state.vertexCollection) {
+      Vertex* vtx = state.vertices[vtxIndex];
+      VertexInfo& vtxInfo = state.vertexInfos[vtxIndex];
       vtxInfo.relinearize = false;
       // Store old position of vertex, i.e. seed position
       // in case of first iteration or position determined
@@ -52,7 +134,7 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
         // Recalculate the track impact parameters at the current vertex
         // position
         auto prepareVertexResult =
-            prepareVertexForFit(state, vtx, vertexingOptions);
+            prepareVertexForFit(state, vtxIndex, vertexingOptions);
         if (!prepareVertexResult.ok()) {
           // Print vertices and associated tracks if logger is in debug mode
           if (logger().doPrint(Logging::DEBUG)) {
@@ -63,9 +145,8 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
       }
 
       // Check if we use the constraint during the vertex fit
-      if (state.vtxInfoMap[vtx].constraint.fullCovariance() !=
-          SquareMatrix4::Zero()) {
-        const Acts::Vertex& constraint = state.vtxInfoMap[vtx].constraint;
+      if (vtxInfo.constraint.fullCovariance() != SquareMatrix4::Zero()) {
+        const Acts::Vertex& constraint = vtxInfo.constraint;
         vtx->setFullPosition(constraint.fullPosition());
         vtx->setFitQuality(constraint.fitQuality());
         vtx->setFullCovariance(constraint.fullCovariance());
@@ -76,7 +157,7 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
       // Set vertexCompatibility for all TrackAtVertex objects
       // at the current vertex
       auto setCompatibilitiesResult =
-          setAllVertexCompatibilities(state, vtx, vertexingOptions);
+          setAllVertexCompatibilities(state, vtxIndex, vertexingOptions);
       if (!setCompatibilitiesResult.ok()) {
         // Print vertices and associated tracks if logger is in debug mode
         if (logger().doPrint(Logging::DEBUG)) {
@@ -118,40 +199,39 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::fit(
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::addVtxToFit(
     State& state, Vertex& newVertex,
     const VertexingOptions& vertexingOptions) const {
-  if (state.vtxInfoMap[&newVertex].trackLinks.empty()) {
+  auto newVertexIt = state.vertexIndices.find(&newVertex);
+  if (newVertexIt == state.vertexIndices.end() ||
+      state.vertexInfos[newVertexIt->second].trackLinks.empty()) {
     ACTS_ERROR(
         "newVertex does not have any associated tracks (i.e., its trackLinks "
         "are empty).");
     return VertexingError::EmptyInput;
   }
+  const std::size_t newVertexIndex = newVertexIt->second;
 
-  std::vector<Vertex*> verticesToFit = {&newVertex};
+  std::vector<std::size_t> verticesToFit = {newVertexIndex};
+  // Flags of the vertices which are already in verticesToFit
+  std::vector<bool> isToFit(state.vertices.size(), false);
+  isToFit[newVertexIndex] = true;
 
   // List of vertices added in last iteration
-  std::vector<Vertex*> lastIterAddedVertices = {&newVertex};
+  std::vector<std::size_t> lastIterAddedVertices = {newVertexIndex};
   // List of vertices added in current iteration
-  std::vector<Vertex*> currentIterAddedVertices;
+  std::vector<std::size_t> currentIterAddedVertices;
 
   // Fill verticesToFit with vertices that are connected to newVertex (via
   // tracks and/or other vertices).
   while (!lastIterAddedVertices.empty()) {
-    for (auto& lastIterAddedVertex : lastIterAddedVertices) {
+    for (std::size_t lastIterAddedVertex : lastIterAddedVertices) {
       // Loop over all tracks at lastIterAddedVertex
-      const std::vector<InputTrack>& trks =
-          state.vtxInfoMap[lastIterAddedVertex].trackLinks;
-      for (const auto& trk : trks) {
-        // Range of vertices that are associated with trk. The range is
-        // represented via its bounds: begin refers to the first iterator of the
-        // range; end refers to the iterator after the last iterator of the
-        // range.
-        auto [begin, end] = state.trackToVerticesMultiMap.equal_range(trk);
-
-        for (auto it = begin; it != end; ++it) {
-          // it->first corresponds to trk, it->second to one of its associated
-          // vertices
-          auto vtxToFit = it->second;
+      for (std::size_t trk :
+           state.vertexInfos[lastIterAddedVertex].trackIndices) {
+        // Loop over all vertices that are associated with trk
+        for (const auto& trkLink : state.trackToVertices[trk]) {
+          std::size_t vtxToFit = trkLink.vertex;
           // Add vertex to the fit if it is not already included
-          if (!isAlreadyInList(vtxToFit, verticesToFit)) {
+          if (!isToFit[vtxToFit]) {
+            isToFit[vtxToFit] = true;
             verticesToFit.push_back(vtxToFit);
 
             // Collect vertices that were added this iteration
@@ -167,10 +247,10 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::addVtxToFit(
     currentIterAddedVertices.clear();
   }  // End while loop
 
-  state.vertexCollection = verticesToFit;
+  state.vertexCollection = std::move(verticesToFit);
 
   // Save the 3D impact parameters of all tracks associated with newVertex.
-  auto res = prepareVertexForFit(state, &newVertex, vertexingOptions);
+  auto res = prepareVertexForFit(state, newVertexIndex, vertexingOptions);
   if (!res.ok()) {
     // Print vertices and associated tracks if logger is in debug mode
     if (logger().doPrint(Logging::DEBUG)) {
@@ -188,65 +268,65 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::addVtxToFit(
   return {};
 }
 
-bool Acts::AdaptiveMultiVertexFitter::isAlreadyInList(
-    Vertex* vtx, const std::vector<Vertex*>& vertices) const {
-  return rangeContainsValue(vertices, vtx);
-}
-
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::prepareVertexForFit(
-    State& state, Vertex* vtx, const VertexingOptions& vertexingOptions) const {
+    State& state, std::size_t vtx,
+    const VertexingOptions& vertexingOptions) const {
   // Vertex info object
-  auto& vtxInfo = state.vtxInfoMap[vtx];
+  auto& vtxInfo = state.vertexInfos[vtx];
   // Vertex seed position
   const Vector3& seedPos = vtxInfo.seedPosition.template head<3>();
 
   // Loop over all tracks at the vertex
-  for (const auto& trk : vtxInfo.trackLinks) {
+  for (std::size_t i = 0; i < vtxInfo.trackLinks.size(); ++i) {
     auto res = m_cfg.ipEst.estimate3DImpactParameters(
         vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-        m_cfg.extractParameters(trk), seedPos, state.ipState);
+        m_cfg.extractParameters(vtxInfo.trackLinks[i]), seedPos,
+        state.ipState);
     if (!res.ok()) {
       return res.error();
     }
-    // Save 3D impact parameters of the track
-    vtxInfo.impactParams3D.emplace(trk, res.value());
+    // Save 3D impact parameters of the track, unless they are already set
+    if (!vtxInfo.impactParams3D[i].has_value()) {
+      vtxInfo.impactParams3D[i] = std::move(*res);
+    }
   }
   return {};
 }
 
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setAllVertexCompatibilities(
-    State& state, Vertex* vtx, const VertexingOptions& vertexingOptions) const {
-  VertexInfo& vtxInfo = state.vtxInfoMap[vtx];
+    State& state, std::size_t vtx,
+    const VertexingOptions& vertexingOptions) const {
+  VertexInfo& vtxInfo = state.vertexInfos[vtx];
 
   // Loop over all tracks that are associated with vtx and estimate their
   // compatibility
-  for (const auto& trk : vtxInfo.trackLinks) {
-    auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+  for (std::size_t i = 0; i < vtxInfo.trackLinks.size(); ++i) {
+    auto& trkAtVtx = vtxInfo.tracksAtVertex[i];
+    auto& impactParams3D = vtxInfo.impactParams3D[i];
     // Recover from cases where linearization point != 0 but
     // more tracks were added later on
-    if (!vtxInfo.impactParams3D.contains(trk)) {
+    if (!impactParams3D.has_value()) {
       auto res = m_cfg.ipEst.estimate3DImpactParameters(
           vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-          m_cfg.extractParameters(trk),
+          m_cfg.extractParameters(vtxInfo.trackLinks[i]),
           VectorHelpers::position(vtxInfo.linPoint), state.ipState);
       if (!res.ok()) {
         return res.error();
       }
       // Set impactParams3D for current trackAtVertex
-      vtxInfo.impactParams3D.emplace(trk, res.value());
+      impactParams3D = std::move(*res);
     }
     // Set compatibility with current vertex
     Acts::Result<double> compatibilityResult(0.);
     if (m_cfg.useTime) {
       compatibilityResult = m_cfg.ipEst.getVertexCompatibility(
-          vertexingOptions.geoContext, &(vtxInfo.impactParams3D.at(trk)),
+          vertexingOptions.geoContext, &(*impactParams3D),
           vtxInfo.oldPosition);
     } else {
       Acts::Vector3 vertexPosOnly =
           VectorHelpers::position(vtxInfo.oldPosition);
       compatibilityResult = m_cfg.ipEst.getVertexCompatibility(
-          vertexingOptions.geoContext, &(vtxInfo.impactParams3D.at(trk)),
-          vertexPosOnly);
+          vertexingOptions.geoContext, &(*impactParams3D), vertexPosOnly);
     }
 
     if (!compatibilityResult.ok()) {
@@ -259,8 +339,9 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setAllVertexCompatibilities(
 
 Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setWeightsAndUpdate(
     State& state, const VertexingOptions& vertexingOptions) const {
-  for (auto vtx : state.vertexCollection) {
-    VertexInfo& vtxInfo = state.vtxInfoMap[vtx];
+  for (std::size_t vtxIndex : state.vertexCollection) {
+    Vertex* vtx = state.vertices[vtxIndex];
+    VertexInfo& vtxInfo = state.vertexInfos[vtxIndex];
 
     if (vtxInfo.relinearize) {
       vtxInfo.linPoint = vtxInfo.oldPosition;
@@ -270,13 +351,15 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setWeightsAndUpdate(
         Surface::makeShared<PerigeeSurface>(
             VectorHelpers::position(vtxInfo.linPoint));
 
-    for (const auto& trk : vtxInfo.trackLinks) {
-      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+    for (std::size_t i = 0; i < vtxInfo.trackLinks.size(); ++i) {
+      const auto& trk = vtxInfo.trackLinks[i];
+      auto& trkAtVtx = vtxInfo.tracksAtVertex[i];
 
       // Set trackWeight for current track
+      collectTrackToVertexCompatibilities(state, vtxInfo.trackIndices[i]);
       trkAtVtx.trackWeight = m_cfg.annealingTool.getWeight(
           state.annealingState, trkAtVtx.vertexCompatibility,
-          collectTrackToVertexCompatibilities(state, trk));
+          state.compatibilities);
 
       if (trkAtVtx.trackWeight > m_cfg.minWeight) {
         // Check if track is already linearized and whether we need to
@@ -309,34 +392,22 @@ Acts::Result<void> Acts::AdaptiveMultiVertexFitter::setWeightsAndUpdate(
   return {};
 }
 
-std::vector<double>
-Acts::AdaptiveMultiVertexFitter::collectTrackToVertexCompatibilities(
-    State& state, const InputTrack& trk) const {
+void Acts::AdaptiveMultiVertexFitter::collectTrackToVertexCompatibilities(
+    State& state, std::size_t trk) const {
   // Compatibilities of trk wrt all of its associated vertices
-  std::vector<double> trkToVtxCompatibilities;
-
-  // Range of vertices that are associated with trk. The range is
-  // represented via its bounds: begin refers to the first iterator of the
-  // range; end refers to the iterator after the last iterator of the range.
-  auto [begin, end] = state.trackToVerticesMultiMap.equal_range(trk);
-  // Allocate space in memory for the vector of compatibilities
-  trkToVtxCompatibilities.reserve(std::distance(begin, end));
-
-  for (auto it = begin; it != end; ++it) {
-    // it->first corresponds to trk, it->second to one of its associated
-    // vertices
-    trkToVtxCompatibilities.push_back(
-        state.tracksAtVerticesMap.at(std::make_pair(trk, it->second))
-            .vertexCompatibility);
+  state.compatibilities.clear();
+  for (const auto& trkLink : state.trackToVertices[trk]) {
+    state.compatibilities.push_back(state.vertexInfos[trkLink.vertex]
+                                        .tracksAtVertex[trkLink.link]
+                                        .vertexCompatibility);
   }
-
-  return trkToVtxCompatibilities;
 }
 
 bool Acts::AdaptiveMultiVertexFitter::checkSmallShift(State& state) const {
-  for (auto* vtx : state.vertexCollection) {
-    Vector3 diff =
-        state.vtxInfoMap[vtx].oldPosition.template head<3>() - vtx->position();
+  for (std::size_t vtxIndex : state.vertexCollection) {
+    const Vertex* vtx = state.vertices[vtxIndex];
+    Vector3 diff = state.vertexInfos[vtxIndex].oldPosition.template head<3>() -
+                   vtx->position();
     const SquareMatrix3& vtxCov = vtx->covariance();
     double relativeShift = diff.dot(vtxCov.inverse() * diff);
     if (relativeShift > m_cfg.maxRelativeShift) {
@@ -347,9 +418,9 @@ bool Acts::AdaptiveMultiVertexFitter::checkSmallShift(State& state) const {
 }
 
 void Acts::AdaptiveMultiVertexFitter::doVertexSmoothing(State& state) const {
-  for (const auto vtx : state.vertexCollection) {
-    for (const auto& trk : state.vtxInfoMap[vtx].trackLinks) {
-      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+  for (std::size_t vtxIndex : state.vertexCollection) {
+    const Vertex* vtx = state.vertices[vtxIndex];
+    for (auto& trkAtVtx : state.vertexInfos[vtxIndex].tracksAtVertex) {
       if (trkAtVtx.trackWeight > m_cfg.minWeight) {
         // Update the new track under the assumption that it originates at the
         // vertex. The second template argument corresponds to the number of
@@ -368,16 +439,16 @@ void Acts::AdaptiveMultiVertexFitter::logDebugData(
              << state.vertexCollection.size() << " vertices:");
   for (std::size_t vtxInd = 0; vtxInd < state.vertexCollection.size();
        ++vtxInd) {
-    auto vtx = state.vertexCollection[vtxInd];
+    const VertexInfo& vtxInfo =
+        state.vertexInfos[state.vertexCollection[vtxInd]];
     ACTS_DEBUG("Position of " << vtxInd << ". vertex seed:\n"
-                              << state.vtxInfoMap.at(vtx).seedPosition);
+                              << vtxInfo.seedPosition);
     ACTS_DEBUG("Position of said vertex after the last fitting step:\n"
-               << state.vtxInfoMap.at(vtx).oldPosition);
+               << vtxInfo.oldPosition);
     ACTS_DEBUG("Associated tracks:");
-    const auto& trks = state.vtxInfoMap.at(vtx).trackLinks;
-    for (std::size_t trkInd = 0; trkInd < trks.size(); ++trkInd) {
-      const auto& trkAtVtx =
-          state.tracksAtVerticesMap.at(std::make_pair(trks[trkInd], vtx));
+    const auto& trksAtVtx = vtxInfo.tracksAtVertex;
+    for (std::size_t trkInd = 0; trkInd < trksAtVtx.size(); ++trkInd) {
+      const auto& trkAtVtx = trksAtVtx[trkInd];
       const auto& trkParams = m_cfg.extractParameters(trkAtVtx.originalParams);
       ACTS_DEBUG(trkInd << ". track parameters:\n" << trkParams.parameters());
       ACTS_DEBUG(trkInd << ". track covariance matrix:\n"
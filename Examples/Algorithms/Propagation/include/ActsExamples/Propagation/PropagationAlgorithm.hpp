@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Material/MaterialInteraction.hpp"
 #include "Acts/Propagator/MaterialInteractor.hpp"
+#include "Acts/Propagator/PropagationProfiler.hpp"
 #include "Acts/Propagator/detail/SteppingLogger.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/EventData/PropagationSummary.hpp"
@@ -61,6 +62,9 @@ class PropagationAlgorithm : public IAlgorithm {
     double maxStepSize = 5 * Acts::UnitConstants::m;
     /// Switch covariance transport on
     bool covarianceTransport = false;
+    /// Profile the steps into this, the per volume cost table is printed at
+    /// the end of the job
+    std::shared_ptr<Acts::PropagationProfile> stepProfile = nullptr;
   };
 
   /// Constructor
@@ -74,6 +78,9 @@ class PropagationAlgorithm : public IAlgorithm {
   ActsExamples::ProcessCode execute(
       const AlgorithmContext& context) const override;
 
+  /// Framework finalize method
+  ActsExamples::ProcessCode finalize() override;
+
   /// Get const access to the config
   const Config& config() const { return m_cfg; }
 
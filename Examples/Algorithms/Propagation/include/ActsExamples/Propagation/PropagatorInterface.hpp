@@ -66,10 +66,11 @@ class ConcretePropagator : public PropagatorInterface {
     using MaterialInteractor = Acts::MaterialInteractor;
     using SteppingLogger = Acts::detail::SteppingLogger;
     using EndOfWorld = Acts::EndOfWorldReached;
+    using Profiler = Acts::PropagationProfiler;
 
     // Actor list
-    using ActorList =
-        Acts::ActorList<SteppingLogger, MaterialInteractor, EndOfWorld>;
+    using ActorList = Acts::ActorList<SteppingLogger, MaterialInteractor,
+                                      Profiler, EndOfWorld>;
     using PropagatorOptions =
         typename propagator_t::template Options<ActorList>;
 
@@ -90,6 +91,9 @@ class ConcretePropagator : public PropagatorInterface {
     // Set a maximum step size
     options.stepping.maxStepSize = cfg.maxStepSize;
 
+    // Profile the steps if requested
+    options.actorList.template get<Profiler>().profile = cfg.stepProfile.get();
+
     auto state = m_propagator.makeState(startParameters, options);
 
     // Propagate using the propagator
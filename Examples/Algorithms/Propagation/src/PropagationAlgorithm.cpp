@@ -90,4 +90,11 @@ ProcessCode PropagationAlgorithm::execute(
   return ProcessCode::SUCCESS;
 }
 
+ProcessCode PropagationAlgorithm::finalize() {
+  if (m_cfg.stepProfile) {
+    ACTS_INFO("Step profile per volume:\n" << *m_cfg.stepProfile);
+  }
+  return ProcessCode::SUCCESS;
+}
+
 }  // namespace ActsExamples
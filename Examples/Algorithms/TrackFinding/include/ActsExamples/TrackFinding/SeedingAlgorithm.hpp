@@ -24,6 +24,7 @@
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -75,6 +76,16 @@ class SeedingAlgorithm final : public IAlgorithm {
     // Connect custom selections on the space points or to the doublet
     // compatibility
     bool useExtraCuts = false;
+
+    /// Number of consecutive space point groups which are seeded together
+    /// in one task. The groups of an event are split into blocks of this size
+    /// which are processed in parallel, and the seeds are merged in the order
+    /// of the groups, so they are identical to the serial seeding.
+    ///
+    /// The seed confirmation uses the quality of seeds found in earlier
+    /// groups, so the groups are always seeded serially if it is enabled.
+    /// If 0, all groups are seeded serially.
+    std::size_t numGroupsPerTask = 0;
   };
 
   /// Construct the seeding algorithm.
@@ -8,10 +8,12 @@
 
 #pragma once
 
+#include "Acts/EventData/ContainerPool.hpp"
 #include "Acts/EventData/SourceLink.hpp"
 #include "Acts/EventData/TrackContainer.hpp"
 #include "Acts/EventData/TrackProxy.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
 #include "Acts/TrackFinding/MeasurementSelector.hpp"
@@ -124,6 +126,30 @@ class TrackFindingAlgorithm final : public IAlgorithm {
     bool computeSharedHits = false;
     /// Whether to trim the tracks
     bool trimTracks = true;
+    /// Advance all branches of a seed together, surface by surface
+    bool breadthFirst = false;
+    /// Maximum number of branches per seed in breadth-first mode
+    std::size_t beamWidth = std::numeric_limits<std::size_t>::max();
+    /// Maximum chi2 difference of a branch to the best branch in
+    /// breadth-first mode
+    double maxBranchChi2Difference = std::numeric_limits<double>::infinity();
+    /// Number of consecutive seeds which are processed together in one task.
+    /// The seeds of an event are split into blocks of this size which are
+    /// processed in parallel, and the tracks are merged in the order of the
+    /// seeds.
+    ///
+    /// Seed deduplication within a block uses the tracks found earlier in the
+    /// same block, and is repeated across the blocks when they are merged.
+    /// Seeds which were skipped in their block only because of a seed that is
+    /// dropped in the merge are processed again, so the tracks, their
+    /// trackGroup and the statistics are the same as with the serial
+    /// processing. If 0, all seeds are processed serially as a single block.
+    std::size_t numSeedsPerTask = 0;
+    /// Select the measurements on a packed copy of the event measurements.
+    /// The chi2 of all measurements on a surface is computed in one pass and
+    /// only the selected measurements are calibrated into track states. This
+    /// is not compatible with `stayOnSeed`.
+    bool packMeasurements = false;
 
     // Pixel and strip volume ids to be used for maxPixel/StripHoles cuts
     std::vector<std::uint32_t> pixelVolumeIds;
@@ -184,12 +210,20 @@ class TrackFindingAlgorithm final : public IAlgorithm {
   mutable std::atomic<std::size_t> m_nFoundTracks{0};
   mutable std::atomic<std::size_t> m_nSelectedTracks{0};
   mutable std::atomic<std::size_t> m_nStoppedBranches{0};
+  mutable std::atomic<std::size_t> m_nPropagationSteps{0};
+  mutable std::atomic<std::size_t> m_nSavedSteps{0};
+  mutable std::atomic<std::size_t> m_nPrunedBranches{0};
 
   mutable tbb::combinable<Acts::VectorMultiTrajectory::Statistics>
       m_memoryStatistics{[]() {
         auto mtj = std::make_shared<Acts::VectorMultiTrajectory>();
         return mtj->statistics();
       }};
+
+  // containers are reused across events to avoid growing them from scratch
+  mutable Acts::ContainerPool<Acts::VectorTrackContainer> m_trackContainerPool;
+  mutable Acts::ContainerPool<Acts::VectorMultiTrajectory>
+      m_trackStateContainerPool;
 };
 
 // TODO this is somewhat duplicated in AmbiguityResolutionAlgorithm.cpp
@@ -19,7 +19,9 @@
 #include "Acts/Utilities/GridBinFinder.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <csignal>
 #include <cstddef>
@@ -28,6 +30,8 @@
 #include <ostream>
 #include <stdexcept>
 
+#include <tbb/enumerable_thread_specific.h>
+
 using namespace Acts::HashedStringLiteral;
 
 namespace ActsExamples {
@@ -177,6 +181,11 @@ ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
     }
   }
 
+  if (m_cfg.numGroupsPerTask > 0 && m_cfg.seedFilterConfig.seedConfirmation) {
+    ACTS_INFO("The seed confirmation depends on the order of the groups, "
+              "they are seeded serially");
+  }
+
   if (m_cfg.useExtraCuts) {
     // This function will be applied to select space points during grid filling
     m_cfg.seedFinderConfig.spacePointSelector
@@ -282,13 +291,65 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
   // run the seeding
   static thread_local std::vector<seed_type> seeds;
   seeds.clear();
-  static thread_local decltype(m_seedFinder)::SeedingState state;
-  state.spacePointMutableData.resize(spContainer.size());
 
-  for (const auto [bottom, middle, top] : spacePointsGrouping) {
-    m_seedFinder.createSeedsForGroup(m_cfg.seedFinderOptions, state,
-                                     spacePointsGrouping.grid(), seeds, bottom,
-                                     middle, top, rMiddleSPRange);
+  // only the seed confirmation reads the quality which earlier seeds stored
+  // on their space points, otherwise the groups are seeded independently
+  if (m_cfg.numGroupsPerTask == 0 || m_cfg.seedFilterConfig.seedConfirmation) {
+    static thread_local decltype(m_seedFinder)::SeedingState state;
+    state.spacePointMutableData.resize(spContainer.size());
+
+    for (const auto [bottom, middle, top] : spacePointsGrouping) {
+      m_seedFinder.createSeedsForGroup(m_cfg.seedFinderOptions, state,
+                                       spacePointsGrouping.grid(), seeds,
+                                       bottom, middle, top, rMiddleSPRange);
+    }
+  } else {
+    std::vector<decltype(*spacePointsGrouping.begin())> groups;
+    for (auto group : spacePointsGrouping) {
+      groups.push_back(std::move(group));
+    }
+
+    // every block of groups is seeded into its own buffer and the buffers are
+    // merged in the order of the groups, which reproduces the serial seeding
+    const std::size_t nBlocks =
+        (groups.size() + m_cfg.numGroupsPerTask - 1) / m_cfg.numGroupsPerTask;
+    std::vector<std::vector<seed_type>> blockSeeds(nBlocks);
+    // the mutable space point data is sized once per thread and shared by the
+    // blocks it runs
+    tbb::enumerable_thread_specific<decltype(m_seedFinder)::SeedingState>
+        states([&] {
+          decltype(m_seedFinder)::SeedingState state;
+          state.spacePointMutableData.resize(spContainer.size());
+          return state;
+        });
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nBlocks),
+        [&](const tbb::blocked_range<std::size_t>& r) {
+          auto& state = states.local();
+          for (std::size_t block = r.begin(); block != r.end(); ++block) {
+            const std::size_t first = block * m_cfg.numGroupsPerTask;
+            const std::size_t last =
+                std::min(first + m_cfg.numGroupsPerTask, groups.size());
+            for (std::size_t i = first; i < last; ++i) {
+              const auto& [bottom, middle, top] = groups[i];
+              m_seedFinder.createSeedsForGroup(
+                  m_cfg.seedFinderOptions, state, spacePointsGrouping.grid(),
+                  blockSeeds[block], bottom, middle, top, rMiddleSPRange);
+            }
+          }
+        });
+
+    // this thread might have run the seeding of another event while waiting
+    // for the blocks, which reuses the thread local seed buffer
+    seeds.clear();
+    std::size_t nSeeds = 0;
+    for (const auto& block : blockSeeds) {
+      nSeeds += block.size();
+    }
+    seeds.reserve(nSeeds);
+    for (auto& block : blockSeeds) {
+      std::ranges::move(block, std::back_inserter(seeds));
+    }
   }
 
   ACTS_DEBUG("Created " << seeds.size() << " track seeds from "
@@ -27,6 +27,8 @@
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
+#include "Acts/TrackFinding/PackedMeasurements.hpp"
+#include "Acts/TrackFinding/PackedTrackStateCreator.hpp"
 #include "Acts/TrackFitting/GainMatrixUpdater.hpp"
 #include "Acts/Utilities/Enumerate.hpp"
 #include "Acts/Utilities/Logger.hpp"
@@ -37,7 +39,9 @@
 #include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <memory>
@@ -47,6 +51,7 @@
 #include <system_error>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <boost/functional/hash.hpp>
 
@@ -169,6 +174,40 @@ void visitSeedIdentifiers(const TrackProxy& track, Visitor visitor) {
   }
 }
 
+/// Tracks found for a block of consecutive seeds
+struct TrackFindingShard {
+  /// Outcome of the track finding for a single seed
+  struct SeedTracks {
+    /// Index of the seed
+    std::size_t iSeed = 0;
+    /// Whether the seed was skipped because tracks found earlier in the same
+    /// block cover it
+    bool deduplicated = false;
+    /// Whether the track finding failed for the seed
+    bool failed = false;
+    /// Range of the selected tracks of the seed in the shard
+    std::size_t firstTrack = 0;
+    std::size_t lastTrack = 0;
+    /// Number of found tracks before the track selection
+    std::size_t nFoundTracks = 0;
+    std::size_t nFailedSmoothing = 0;
+    std::size_t nFailedExtrapolation = 0;
+    std::size_t nStoppedBranches = 0;
+    Acts::CombinatorialKalmanFilterStatistics ckfStatistics;
+    /// Deduplication slots of the seeds covered by the found tracks
+    std::vector<std::size_t> coveredSeeds;
+  };
+
+  explicit TrackFindingShard(TrackContainer tracks_)
+      : tracks(std::move(tracks_)) {}
+
+  /// Selected tracks of all seeds of the block, together with their track
+  /// states
+  TrackContainer tracks;
+  /// Seeds of the block in the order of processing
+  std::vector<SeedTracks> seeds;
+};
+
 class BranchStopper {
  public:
   using BranchStopperResult =
@@ -283,6 +322,10 @@ TrackFindingAlgorithm::TrackFindingAlgorithm(Config config,
         "Missing seeds input collection. This is "
         "required for staying on seed.");
   }
+  if (m_cfg.packMeasurements && m_cfg.stayOnSeed) {
+    throw std::invalid_argument(
+        "Packed measurements can not be combined with staying on seed.");
+  }
 
   if (m_cfg.trackSelectorCfg.has_value()) {
     m_trackSelector = std::visit(
@@ -322,28 +365,29 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   PassThroughCalibrator pcalibrator;
   MeasurementCalibratorAdapter calibrator(pcalibrator, measurements);
   Acts::GainMatrixUpdater kfUpdater;
-  MeasurementSelector measSel{
-      Acts::MeasurementSelector(m_cfg.measurementSelectorCfg)};
 
   using Extensions = Acts::CombinatorialKalmanFilterExtensions<TrackContainer>;
 
-  BranchStopper branchStopper(m_cfg);
-
-  Extensions extensions;
-  extensions.calibrator.connect<&MeasurementCalibratorAdapter::calibrate>(
-      &calibrator);
-  extensions.updater.connect<&Acts::GainMatrixUpdater::operator()<
-      typename TrackContainer::TrackStateContainerBackend>>(&kfUpdater);
-  extensions.measurementSelector.connect<&MeasurementSelector::select>(
-      &measSel);
-  extensions.branchStopper.connect<&BranchStopper::operator()>(&branchStopper);
-
   IndexSourceLinkAccessor slAccessor;
   slAccessor.container = &sourceLinks;
   Acts::SourceLinkAccessorDelegate<IndexSourceLinkAccessor::Iterator>
       slAccessorDelegate;
   slAccessorDelegate.connect<&IndexSourceLinkAccessor::range>(&slAccessor);
 
+  // The source links are ordered by surface, which is the order in which the
+  // accessor returns them and the packed measurements expect them
+  Acts::PackedMeasurements packedMeasurements;
+  const Acts::MeasurementSelector packedMeasSel(m_cfg.measurementSelectorCfg);
+  if (m_cfg.packMeasurements) {
+    for (const IndexSourceLink& sourceLink : sourceLinks) {
+      const auto measurement = measurements.getMeasurement(sourceLink.index());
+      packedMeasurements.add(sourceLink.geometryId(),
+                             measurement.subspaceIndexVector(),
+                             measurement.parameters(),
+                             measurement.covariance());
+    }
+  }
+
   Acts::PropagatorPlainOptions firstPropOptions(ctx.geoContext,
                                                 ctx.magFieldContext);
   firstPropOptions.maxSteps = m_cfg.maxSteps;
@@ -359,18 +403,6 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   secondPropOptions.constrainToVolumeIds = m_cfg.constrainToVolumeIds;
   secondPropOptions.endOfWorldVolumeIds = m_cfg.endOfWorldVolumeIds;
 
-  // Set the CombinatorialKalmanFilter options
-  TrackFinderOptions firstOptions(ctx.geoContext, ctx.magFieldContext,
-                                  ctx.calibContext, slAccessorDelegate,
-                                  extensions, firstPropOptions);
-  firstOptions.targetSurface = m_cfg.reverseSearch ? pSurface.get() : nullptr;
-
-  TrackFinderOptions secondOptions(ctx.geoContext, ctx.magFieldContext,
-                                   ctx.calibContext, slAccessorDelegate,
-                                   extensions, secondPropOptions);
-  secondOptions.targetSurface = m_cfg.reverseSearch ? nullptr : pSurface.get();
-  secondOptions.skipPrePropagationUpdate = true;
-
   using Extrapolator = Acts::Propagator<Acts::SympyStepper, Acts::Navigator>;
   using ExtrapolatorOptions = Extrapolator::template Options<
       Acts::ActorList<Acts::MaterialInteractor, Acts::EndOfWorldReached>>;
@@ -389,259 +421,445 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
                                           << " seeds.");
 
-  auto trackContainer = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainer = std::make_shared<Acts::VectorMultiTrajectory>();
-
-  auto trackContainerTemp = std::make_shared<Acts::VectorTrackContainer>();
-  auto trackStateContainerTemp =
-      std::make_shared<Acts::VectorMultiTrajectory>();
+  auto trackContainer = m_trackContainerPool.acquire();
+  auto trackStateContainer = m_trackStateContainerPool.acquire();
 
   TrackContainer tracks(trackContainer, trackStateContainer);
-  TrackContainer tracksTemp(trackContainerTemp, trackStateContainerTemp);
 
   // Note that not all backends support PODs as column types
   tracks.addColumn<BranchStopper::BranchState>("MyBranchState");
-  tracksTemp.addColumn<BranchStopper::BranchState>("MyBranchState");
-
   tracks.addColumn<unsigned int>("trackGroup");
-  tracksTemp.addColumn<unsigned int>("trackGroup");
   Acts::ProxyAccessor<unsigned int> seedNumber("trackGroup");
 
-  unsigned int nSeed = 0;
-
-  // A map indicating whether a seed has been discovered already
-  std::unordered_map<SeedIdentifier, bool> discoveredSeeds;
+  // Seeds with the same identifier share one deduplication slot, which
+  // indicates whether the seed has been discovered already
+  std::unordered_map<SeedIdentifier, std::size_t> seedSlots;
+  std::vector<std::size_t> seedSlotOfSeed;
 
-  auto addTrack = [&](const TrackProxy& track) {
-    ++m_nFoundTracks;
+  if (seeds != nullptr && m_cfg.seedDeduplication) {
+    // Index the seeds for deduplication
+    seedSlotOfSeed.reserve(seeds->size());
+    for (const auto& seed : *seeds) {
+      SeedIdentifier seedIdentifier = makeSeedIdentifier(seed);
+      auto [it, inserted] =
+          seedSlots.try_emplace(seedIdentifier, seedSlots.size());
+      seedSlotOfSeed.push_back(it->second);
+    }
+  }
 
-    // flag seeds which are covered by the track
-    visitSeedIdentifiers(track, [&](const SeedIdentifier& seedIdentifier) {
-      if (auto it = discoveredSeeds.find(seedIdentifier);
-          it != discoveredSeeds.end()) {
-        it->second = true;
-      }
-    });
+  // Every block keeps the track states of its selected tracks in its own
+  // container, so the blocks do not share any output
+  auto makeShard = [&]() {
+    TrackContainer shardTracks(m_trackContainerPool.acquire(),
+                               m_trackStateContainerPool.acquire());
+    shardTracks.addColumn<BranchStopper::BranchState>("MyBranchState");
+    shardTracks.addColumn<unsigned int>("trackGroup");
+    return TrackFindingShard(std::move(shardTracks));
+  };
 
-    // trim the track if requested
-    if (m_cfg.trimTracks) {
-      Acts::trimTrack(track, true, true, true);
+  // Find the tracks of the seeds [firstSeed, lastSeed) into the shard. Seeds
+  // which are covered by tracks found earlier in the same shard are skipped.
+  auto findTracksForSeeds = [&](std::size_t firstSeed, std::size_t lastSeed,
+                                TrackFindingShard& shard) {
+    MeasurementSelector measSel{
+        Acts::MeasurementSelector(m_cfg.measurementSelectorCfg)};
+
+    BranchStopper branchStopper(m_cfg);
+
+    Extensions extensions;
+    extensions.calibrator.connect<&MeasurementCalibratorAdapter::calibrate>(
+        &calibrator);
+    extensions.updater.connect<&Acts::GainMatrixUpdater::operator()<
+        typename TrackContainer::TrackStateContainerBackend>>(&kfUpdater);
+    extensions.measurementSelector.connect<&MeasurementSelector::select>(
+        &measSel);
+    extensions.branchStopper.connect<&BranchStopper::operator()>(
+        &branchStopper);
+
+    using PackedCreator =
+        Acts::PackedTrackStateCreator<IndexSourceLinkAccessor::Iterator,
+                                      TrackContainer>;
+    PackedCreator packedCreator;
+    packedCreator.calibrator.connect<&MeasurementCalibratorAdapter::calibrate>(
+        &calibrator);
+    packedCreator.measurementSelector = &packedMeasSel;
+    packedCreator.measurements = &packedMeasurements;
+
+    // Set the CombinatorialKalmanFilter options
+    TrackFinderOptions firstOptions(ctx.geoContext, ctx.magFieldContext,
+                                    ctx.calibContext, slAccessorDelegate,
+                                    extensions, firstPropOptions);
+    firstOptions.targetSurface =
+        m_cfg.reverseSearch ? pSurface.get() : nullptr;
+    firstOptions.breadthFirst = m_cfg.breadthFirst;
+    firstOptions.beamWidth = m_cfg.beamWidth;
+    firstOptions.maxBranchChi2Difference = m_cfg.maxBranchChi2Difference;
+    if (m_cfg.packMeasurements) {
+      firstOptions.trackStateCandidateCreator
+          .connect<&PackedCreator::createSourceLinkTrackStates>(&packedCreator);
+      packedCreator.optionalComponents =
+          firstOptions.optionalTrackStateComponents;
     }
-    Acts::calculateTrackQuantities(track);
 
-    if (m_trackSelector.has_value() && !m_trackSelector->isValidTrack(track)) {
-      return;
-    }
+    TrackFinderOptions secondOptions(ctx.geoContext, ctx.magFieldContext,
+                                     ctx.calibContext, slAccessorDelegate,
+                                     extensions, secondPropOptions);
+    secondOptions.targetSurface =
+        m_cfg.reverseSearch ? nullptr : pSurface.get();
+    secondOptions.skipPrePropagationUpdate = true;
+    secondOptions.breadthFirst = m_cfg.breadthFirst;
+    secondOptions.beamWidth = m_cfg.beamWidth;
+    secondOptions.maxBranchChi2Difference = m_cfg.maxBranchChi2Difference;
+    secondOptions.trackStateCandidateCreator =
+        firstOptions.trackStateCandidateCreator;
 
-    ++m_nSelectedTracks;
+    auto trackContainerTemp = m_trackContainerPool.acquire();
+    auto trackStateContainerTemp = m_trackStateContainerPool.acquire();
+    TrackContainer tracksTemp(trackContainerTemp, trackStateContainerTemp);
+    tracksTemp.addColumn<BranchStopper::BranchState>("MyBranchState");
+    tracksTemp.addColumn<unsigned int>("trackGroup");
 
-    auto destProxy = tracks.makeTrack();
-    // make sure we copy track states!
-    destProxy.copyFrom(track, true);
-  };
+    unsigned int nSeed = 0;
 
-  if (seeds != nullptr && m_cfg.seedDeduplication) {
-    // Index the seeds for deduplication
-    for (const auto& seed : *seeds) {
-      SeedIdentifier seedIdentifier = makeSeedIdentifier(seed);
-      discoveredSeeds.emplace(seedIdentifier, false);
-    }
-  }
+    // Deduplication slots of the seeds which have been discovered already
+    std::vector<bool> discoveredSeeds(seedSlots.size(), false);
 
-  for (std::size_t iSeed = 0; iSeed < initialParameters.size(); ++iSeed) {
-    m_nTotalSeeds++;
+    TrackFindingShard::SeedTracks* seedTracks = nullptr;
 
-    if (seeds != nullptr) {
-      const SimSeed& seed = seeds->at(iSeed);
+    auto addTrack = [&](const TrackProxy& track) {
+      ++seedTracks->nFoundTracks;
 
+      // flag seeds which are covered by the track
       if (m_cfg.seedDeduplication) {
-        SeedIdentifier seedIdentifier = makeSeedIdentifier(seed);
-        // check if the seed has been discovered already
-        if (auto it = discoveredSeeds.find(seedIdentifier);
-            it != discoveredSeeds.end() && it->second) {
-          m_nDeduplicatedSeeds++;
-          ACTS_VERBOSE("Skipping seed " << iSeed << " due to deduplication.");
-          continue;
-        }
+        visitSeedIdentifiers(track, [&](const SeedIdentifier& seedIdentifier) {
+          if (auto it = seedSlots.find(seedIdentifier);
+              it != seedSlots.end()) {
+            discoveredSeeds[it->second] = true;
+            seedTracks->coveredSeeds.push_back(it->second);
+          }
+        });
       }
 
-      if (m_cfg.stayOnSeed) {
-        measSel.setSeed(seed);
+      // trim the track if requested
+      if (m_cfg.trimTracks) {
+        Acts::trimTrack(track, true, true, true);
       }
-    }
+      Acts::calculateTrackQuantities(track);
 
-    // Clear trackContainerTemp and trackStateContainerTemp
-    tracksTemp.clear();
+      if (m_trackSelector.has_value() &&
+          !m_trackSelector->isValidTrack(track)) {
+        return;
+      }
 
-    const Acts::BoundTrackParameters& firstInitialParameters =
-        initialParameters.at(iSeed);
+      auto destProxy = shard.tracks.makeTrack();
+      // make sure we copy track states!
+      destProxy.copyFrom(track, true);
+      seedTracks->lastTrack = shard.tracks.size();
+    };
 
-    auto firstRootBranch = tracksTemp.makeTrack();
-    auto firstResult = (*m_cfg.findTracks)(firstInitialParameters, firstOptions,
-                                           tracksTemp, firstRootBranch);
-    nSeed++;
+    for (std::size_t iSeed = firstSeed; iSeed < lastSeed; ++iSeed) {
+      seedTracks = &shard.seeds.emplace_back();
+      seedTracks->iSeed = iSeed;
+      seedTracks->firstTrack = shard.tracks.size();
+      seedTracks->lastTrack = shard.tracks.size();
 
-    if (!firstResult.ok()) {
-      m_nFailedSeeds++;
-      ACTS_WARNING("Track finding failed for seed " << iSeed << " with error"
-                                                    << firstResult.error());
-      continue;
-    }
+      if (seeds != nullptr) {
+        const SimSeed& seed = seeds->at(iSeed);
+
+        // check if the seed has been discovered already
+        if (m_cfg.seedDeduplication &&
+            discoveredSeeds[seedSlotOfSeed[iSeed]]) {
+          seedTracks->deduplicated = true;
+          ACTS_VERBOSE("Skipping seed " << iSeed << " due to deduplication.");
+          continue;
+        }
 
-    auto& firstTracksForSeed = firstResult.value();
-    for (auto& firstTrack : firstTracksForSeed) {
-      // TODO a copy of the track should not be necessary but is the safest way
-      //      with the current EDM
-      // TODO a lightweight copy without copying all the track state components
-      //      might be a solution
-      auto trackCandidate = tracksTemp.makeTrack();
-      trackCandidate.copyFrom(firstTrack, true);
-
-      auto firstSmoothingResult =
-          Acts::smoothTrack(ctx.geoContext, trackCandidate, logger());
-      if (!firstSmoothingResult.ok()) {
-        m_nFailedSmoothing++;
-        ACTS_ERROR("First smoothing for seed "
-                   << iSeed << " and track " << firstTrack.index()
-                   << " failed with error " << firstSmoothingResult.error());
+        if (m_cfg.stayOnSeed) {
+          measSel.setSeed(seed);
+        }
+      }
+
+      // Clear trackContainerTemp and trackStateContainerTemp
+      tracksTemp.clear();
+
+      // the statistics are kept per seed, so that they only count the seeds
+      // which end up in the output
+      firstOptions.statistics = &seedTracks->ckfStatistics;
+      secondOptions.statistics = &seedTracks->ckfStatistics;
+      const std::size_t nStoppedBranches = branchStopper.m_nStoppedBranches;
+
+      const Acts::BoundTrackParameters& firstInitialParameters =
+          initialParameters.at(iSeed);
+
+      auto firstRootBranch = tracksTemp.makeTrack();
+      auto firstResult = (*m_cfg.findTracks)(
+          firstInitialParameters, firstOptions, tracksTemp, firstRootBranch);
+      nSeed++;
+
+      if (!firstResult.ok()) {
+        seedTracks->failed = true;
+        seedTracks->nStoppedBranches =
+            branchStopper.m_nStoppedBranches - nStoppedBranches;
+        ACTS_WARNING("Track finding failed for seed " << iSeed << " with error"
+                                                      << firstResult.error());
         continue;
       }
 
-      // number of second tracks found
-      std::size_t nSecond = 0;
-
-      // Set the seed number, this number decrease by 1 since the seed number
-      // has already been updated
-      seedNumber(trackCandidate) = nSeed - 1;
-
-      if (m_cfg.twoWay) {
-        std::optional<Acts::VectorMultiTrajectory::TrackStateProxy>
-            firstMeasurementOpt;
-        for (auto trackState : trackCandidate.trackStatesReversed()) {
-          bool isMeasurement = trackState.typeFlags().test(
-              Acts::TrackStateFlag::MeasurementFlag);
-          bool isOutlier =
-              trackState.typeFlags().test(Acts::TrackStateFlag::OutlierFlag);
-          // We are excluding non measurement states and outlier here. Those can
-          // decrease resolution because only the smoothing corrected the very
-          // first prediction as filtering is not possible.
-          if (isMeasurement && !isOutlier) {
-            firstMeasurementOpt = trackState;
-          }
+      auto& firstTracksForSeed = firstResult.value();
+      for (auto& firstTrack : firstTracksForSeed) {
+        // TODO a copy of the track should not be necessary but is the safest
+        //      way with the current EDM
+        // TODO a lightweight copy without copying all the track state
+        //      components might be a solution
+        auto trackCandidate = tracksTemp.makeTrack();
+        trackCandidate.copyFrom(firstTrack, true);
+
+        auto firstSmoothingResult =
+            Acts::smoothTrack(ctx.geoContext, trackCandidate, logger());
+        if (!firstSmoothingResult.ok()) {
+          ++seedTracks->nFailedSmoothing;
+          ACTS_ERROR("First smoothing for seed "
+                     << iSeed << " and track " << firstTrack.index()
+                     << " failed with error " << firstSmoothingResult.error());
+          continue;
         }
 
-        if (firstMeasurementOpt.has_value()) {
-          auto& firstMeasurement = firstMeasurementOpt.value();
-
-          Acts::BoundTrackParameters secondInitialParameters =
-              trackCandidate.createParametersFromState(firstMeasurement);
-
-          auto secondRootBranch = tracksTemp.makeTrack();
-          secondRootBranch.copyFrom(trackCandidate, false);
-          auto secondResult =
-              (*m_cfg.findTracks)(secondInitialParameters, secondOptions,
-                                  tracksTemp, secondRootBranch);
-
-          if (!secondResult.ok()) {
-            ACTS_WARNING("Second track finding failed for seed "
-                         << iSeed << " with error" << secondResult.error());
-          } else {
-            // store the original previous state to restore it later
-            auto originalFirstMeasurementPrevious = firstMeasurement.previous();
-
-            auto& secondTracksForSeed = secondResult.value();
-            for (auto& secondTrack : secondTracksForSeed) {
-              // TODO a copy of the track should not be necessary but is the
-              //      safest way with the current EDM
-              // TODO a lightweight copy without copying all the track state
-              //      components might be a solution
-              auto secondTrackCopy = tracksTemp.makeTrack();
-              secondTrackCopy.copyFrom(secondTrack, true);
-
-              // Note that this is only valid if there are no branches
-              // We disallow this by breaking this look after a second track was
-              // processed
-              secondTrackCopy.reverseTrackStates(true);
-
-              firstMeasurement.previous() =
-                  secondTrackCopy.outermostTrackState().index();
-
-              trackCandidate.copyFrom(secondTrackCopy, false);
-
-              // finalize the track candidate
-
-              bool doExtrapolate = true;
-
-              if (!m_cfg.reverseSearch) {
-                // these parameters are already extrapolated by the CKF and have
-                // the optimal resolution. note that we did not smooth all the
-                // states.
-
-                // only extrapolate if we did not do it already
-                doExtrapolate = !trackCandidate.hasReferenceSurface();
-              } else {
-                // smooth the full track and extrapolate to the reference
-
-                auto secondSmoothingResult =
-                    Acts::smoothTrack(ctx.geoContext, trackCandidate, logger());
-                if (!secondSmoothingResult.ok()) {
-                  m_nFailedSmoothing++;
-                  ACTS_ERROR("Second smoothing for seed "
-                             << iSeed << " and track " << secondTrack.index()
-                             << " failed with error "
-                             << secondSmoothingResult.error());
-                  continue;
-                }
+        // number of second tracks found
+        std::size_t nSecond = 0;
+
+        // Set the seed number, this number decrease by 1 since the seed number
+        // has already been updated
+        seedNumber(trackCandidate) = nSeed - 1;
+
+        if (m_cfg.twoWay) {
+          std::optional<Acts::VectorMultiTrajectory::TrackStateProxy>
+              firstMeasurementOpt;
+          for (auto trackState : trackCandidate.trackStatesReversed()) {
+            bool isMeasurement = trackState.typeFlags().test(
+                Acts::TrackStateFlag::MeasurementFlag);
+            bool isOutlier =
+                trackState.typeFlags().test(Acts::TrackStateFlag::OutlierFlag);
+            // We are excluding non measurement states and outlier here. Those
+            // can decrease resolution because only the smoothing corrected the
+            // very first prediction as filtering is not possible.
+            if (isMeasurement && !isOutlier) {
+              firstMeasurementOpt = trackState;
+            }
+          }
 
-                trackCandidate.reverseTrackStates(true);
-              }
+          if (firstMeasurementOpt.has_value()) {
+            auto& firstMeasurement = firstMeasurementOpt.value();
+
+            Acts::BoundTrackParameters secondInitialParameters =
+                trackCandidate.createParametersFromState(firstMeasurement);
+
+            auto secondRootBranch = tracksTemp.makeTrack();
+            secondRootBranch.copyFrom(trackCandidate, false);
+            auto secondResult =
+                (*m_cfg.findTracks)(secondInitialParameters, secondOptions,
+                                    tracksTemp, secondRootBranch);
+
+            if (!secondResult.ok()) {
+              ACTS_WARNING("Second track finding failed for seed "
+                           << iSeed << " with error" << secondResult.error());
+            } else {
+              // store the original previous state to restore it later
+              auto originalFirstMeasurementPrevious =
+                  firstMeasurement.previous();
+
+              auto& secondTracksForSeed = secondResult.value();
+              for (auto& secondTrack : secondTracksForSeed) {
+                // TODO a copy of the track should not be necessary but is the
+                //      safest way with the current EDM
+                // TODO a lightweight copy without copying all the track state
+                //      components might be a solution
+                auto secondTrackCopy = tracksTemp.makeTrack();
+                secondTrackCopy.copyFrom(secondTrack, true);
+
+                // Note that this is only valid if there are no branches
+                // We disallow this by breaking this look after a second track
+                // was processed
+                secondTrackCopy.reverseTrackStates(true);
+
+                firstMeasurement.previous() =
+                    secondTrackCopy.outermostTrackState().index();
+
+                trackCandidate.copyFrom(secondTrackCopy, false);
+
+                // finalize the track candidate
+
+                bool doExtrapolate = true;
+
+                if (!m_cfg.reverseSearch) {
+                  // these parameters are already extrapolated by the CKF and
+                  // have the optimal resolution. note that we did not smooth
+                  // all the states.
+
+                  // only extrapolate if we did not do it already
+                  doExtrapolate = !trackCandidate.hasReferenceSurface();
+                } else {
+                  // smooth the full track and extrapolate to the reference
+
+                  auto secondSmoothingResult = Acts::smoothTrack(
+                      ctx.geoContext, trackCandidate, logger());
+                  if (!secondSmoothingResult.ok()) {
+                    ++seedTracks->nFailedSmoothing;
+                    ACTS_ERROR("Second smoothing for seed "
+                               << iSeed << " and track " << secondTrack.index()
+                               << " failed with error "
+                               << secondSmoothingResult.error());
+                    continue;
+                  }
+
+                  trackCandidate.reverseTrackStates(true);
+                }
 
-              if (doExtrapolate) {
-                auto secondExtrapolationResult =
-                    Acts::extrapolateTrackToReferenceSurface(
-                        trackCandidate, *pSurface, extrapolator,
-                        extrapolationOptions, m_cfg.extrapolationStrategy,
-                        logger());
-                if (!secondExtrapolationResult.ok()) {
-                  m_nFailedExtrapolation++;
-                  ACTS_ERROR("Second extrapolation for seed "
-                             << iSeed << " and track " << secondTrack.index()
-                             << " failed with error "
-                             << secondExtrapolationResult.error());
-                  continue;
+                if (doExtrapolate) {
+                  auto secondExtrapolationResult =
+                      Acts::extrapolateTrackToReferenceSurface(
+                          trackCandidate, *pSurface, extrapolator,
+                          extrapolationOptions, m_cfg.extrapolationStrategy,
+                          logger());
+                  if (!secondExtrapolationResult.ok()) {
+                    ++seedTracks->nFailedExtrapolation;
+                    ACTS_ERROR("Second extrapolation for seed "
+                               << iSeed << " and track " << secondTrack.index()
+                               << " failed with error "
+                               << secondExtrapolationResult.error());
+                    continue;
+                  }
                 }
-              }
 
-              addTrack(trackCandidate);
+                addTrack(trackCandidate);
+
+                ++nSecond;
+              }
 
-              ++nSecond;
+              // restore the original previous state
+              firstMeasurement.previous() = originalFirstMeasurementPrevious;
             }
+          }
+        }
 
-            // restore the original previous state
-            firstMeasurement.previous() = originalFirstMeasurementPrevious;
+        // if no second track was found, we will use only the first track
+        if (nSecond == 0) {
+          // restore the track to the original state
+          trackCandidate.copyFrom(firstTrack, false);
+
+          auto firstExtrapolationResult =
+              Acts::extrapolateTrackToReferenceSurface(
+                  trackCandidate, *pSurface, extrapolator, extrapolationOptions,
+                  m_cfg.extrapolationStrategy, logger());
+          if (!firstExtrapolationResult.ok()) {
+            ++seedTracks->nFailedExtrapolation;
+            ACTS_ERROR("Extrapolation for seed "
+                       << iSeed << " and track " << firstTrack.index()
+                       << " failed with error "
+                       << firstExtrapolationResult.error());
+            continue;
           }
+
+          addTrack(trackCandidate);
         }
       }
 
-      // if no second track was found, we will use only the first track
-      if (nSecond == 0) {
-        // restore the track to the original state
-        trackCandidate.copyFrom(firstTrack, false);
-
-        auto firstExtrapolationResult =
-            Acts::extrapolateTrackToReferenceSurface(
-                trackCandidate, *pSurface, extrapolator, extrapolationOptions,
-                m_cfg.extrapolationStrategy, logger());
-        if (!firstExtrapolationResult.ok()) {
-          m_nFailedExtrapolation++;
-          ACTS_ERROR("Extrapolation for seed "
-                     << iSeed << " and track " << firstTrack.index()
-                     << " failed with error "
-                     << firstExtrapolationResult.error());
+      seedTracks->nStoppedBranches =
+          branchStopper.m_nStoppedBranches - nStoppedBranches;
+    }
+  };
+
+  m_nTotalSeeds += initialParameters.size();
+
+  // Statistics of the seeds which end up in the output
+  auto accountSeed = [&](const TrackFindingShard::SeedTracks& seedTracks) {
+    if (seedTracks.deduplicated) {
+      m_nDeduplicatedSeeds++;
+      return;
+    }
+    m_nFailedSeeds += seedTracks.failed ? 1 : 0;
+    m_nFailedSmoothing += seedTracks.nFailedSmoothing;
+    m_nFailedExtrapolation += seedTracks.nFailedExtrapolation;
+    m_nFoundTracks += seedTracks.nFoundTracks;
+    m_nSelectedTracks += seedTracks.lastTrack - seedTracks.firstTrack;
+    m_nStoppedBranches += seedTracks.nStoppedBranches;
+    m_nPropagationSteps += seedTracks.ckfStatistics.steps;
+    m_nSavedSteps += seedTracks.ckfStatistics.savedSteps;
+    m_nPrunedBranches += seedTracks.ckfStatistics.prunedBranches;
+  };
+
+  if (m_cfg.numSeedsPerTask == 0) {
+    // the tracks are found directly into the output container
+    TrackFindingShard shard(tracks);
+    findTracksForSeeds(0, initialParameters.size(), shard);
+    for (const auto& seedTracks : shard.seeds) {
+      accountSeed(seedTracks);
+    }
+  } else {
+    // every block of seeds is processed into its own shard, so the result
+    // does not depend on which thread runs which block
+    const std::size_t nBlocks =
+        (initialParameters.size() + m_cfg.numSeedsPerTask - 1) /
+        m_cfg.numSeedsPerTask;
+    std::vector<TrackFindingShard> shards;
+    shards.reserve(nBlocks);
+    for (std::size_t block = 0; block < nBlocks; ++block) {
+      shards.push_back(makeShard());
+    }
+
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, nBlocks),
+        [&](const tbb::blocked_range<std::size_t>& r) {
+          for (std::size_t block = r.begin(); block != r.end(); ++block) {
+            const std::size_t firstSeed = block * m_cfg.numSeedsPerTask;
+            const std::size_t lastSeed = std::min(
+                firstSeed + m_cfg.numSeedsPerTask, initialParameters.size());
+            findTracksForSeeds(firstSeed, lastSeed, shards[block]);
+          }
+        });
+
+    // Merge the shards in the order of the seeds and repeat the deduplication
+    // as it happens in the serial processing: the tracks of a seed are dropped
+    // if a track of an earlier kept seed covers it. A seed which was skipped
+    // in its block is processed again if the seed covering it was dropped.
+    // The tracks are copied together with their track states, so the output
+    // only contains the states of the kept tracks, in the order of the seeds.
+    std::vector<bool> discoveredSeeds(seedSlots.size(), false);
+    unsigned int nSeed = 0;
+    for (const auto& shard : shards) {
+      for (const auto& blockSeedTracks : shard.seeds) {
+        const std::size_t iSeed = blockSeedTracks.iSeed;
+        if (m_cfg.seedDeduplication &&
+            discoveredSeeds[seedSlotOfSeed[iSeed]]) {
+          m_nDeduplicatedSeeds++;
+          ACTS_VERBOSE("Dropping tracks of seed " << iSeed
+                                                  << " due to deduplication.");
           continue;
         }
 
-        addTrack(trackCandidate);
+        const TrackFindingShard* source = &shard;
+        std::optional<TrackFindingShard> rerun;
+        if (blockSeedTracks.deduplicated) {
+          ACTS_VERBOSE("Finding tracks for seed " << iSeed << " again.");
+          rerun.emplace(makeShard());
+          findTracksForSeeds(iSeed, iSeed + 1, *rerun);
+          source = &*rerun;
+        }
+        const auto& seedTracks =
+            rerun.has_value() ? rerun->seeds.front() : blockSeedTracks;
+
+        for (std::size_t slot : seedTracks.coveredSeeds) {
+          discoveredSeeds[slot] = true;
+        }
+        accountSeed(seedTracks);
+
+        for (std::size_t i = seedTracks.firstTrack; i < seedTracks.lastTrack;
+             ++i) {
+          auto sourceProxy = source->tracks.getTrack(i);
+          auto destProxy = tracks.makeTrack();
+          destProxy.copyFrom(sourceProxy, true);
+          seedNumber(destProxy) = nSeed;
+        }
+        ++nSeed;
       }
     }
   }
@@ -654,17 +872,17 @@ ProcessCode TrackFindingAlgorithm::execute(const AlgorithmContext& ctx) const {
   ACTS_DEBUG("Finalized track finding with " << tracks.size()
                                              << " track candidates.");
 
-  m_nStoppedBranches += branchStopper.m_nStoppedBranches;
-
   m_memoryStatistics.local().hist +=
       tracks.trackStateContainer().statistics().hist;
 
+  // the storage goes back to the pools once the event store releases it
   auto constTrackStateContainer =
-      std::make_shared<Acts::ConstVectorMultiTrajectory>(
-          std::move(*trackStateContainer));
+      Acts::ContainerPool<Acts::VectorMultiTrajectory>::makeConst<
+          Acts::ConstVectorMultiTrajectory>(std::move(trackStateContainer));
 
-  auto constTrackContainer = std::make_shared<Acts::ConstVectorTrackContainer>(
-      std::move(*trackContainer));
+  auto constTrackContainer =
+      Acts::ContainerPool<Acts::VectorTrackContainer>::makeConst<
+          Acts::ConstVectorTrackContainer>(std::move(trackContainer));
 
   ConstTrackContainer constTracks{constTrackContainer,
                                   constTrackStateContainer};
@@ -685,6 +903,11 @@ ProcessCode TrackFindingAlgorithm::finalize() {
   ACTS_INFO("- found tracks: " << m_nFoundTracks);
   ACTS_INFO("- selected tracks: " << m_nSelectedTracks);
   ACTS_INFO("- stopped branches: " << m_nStoppedBranches);
+  ACTS_INFO("- propagation steps: " << m_nPropagationSteps);
+  if (m_cfg.breadthFirst) {
+    ACTS_INFO("- saved propagation steps: " << m_nSavedSteps);
+    ACTS_INFO("- pruned branches: " << m_nPrunedBranches);
+  }
 
   auto memoryStatistics =
       m_memoryStatistics.combine([](const auto& a, const auto& b) {
@@ -78,6 +78,13 @@ using BetheHeitlerApprox = Acts::AtlasBetheHeitlerApprox<6, 5>;
 /// Available algorithms for the mixture reduction
 enum class MixtureReductionAlgorithm { weightCut, KLDistance };
 
+/// Available steppers for the components of the GSF
+///
+/// The @c simd stepper steps several components together in SIMD lanes. It
+/// matches the @c loop stepper exactly as long as the batched field lookup of
+/// the magnetic field provider returns the same values as the single one.
+enum class GsfMultiStepper { loop, simd };
+
 /// Makes a fitter function object for the GSF
 ///
 /// @param trackingGeometry the trackingGeometry for the propagator
@@ -90,13 +97,15 @@ enum class MixtureReductionAlgorithm { weightCut, KLDistance };
 /// @param mixtureReductionAlgorithm How to reduce the number of components
 /// in a mixture
 /// @param logger a logger instance
+/// @param multiStepper which stepper propagates the components
 std::shared_ptr<TrackFitterFunction> makeGsfFitterFunction(
     std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
     std::shared_ptr<const Acts::MagneticFieldProvider> magneticField,
     BetheHeitlerApprox betheHeitlerApprox, std::size_t maxComponents,
     double weightCutoff, Acts::ComponentMergeMethod componentMergeMethod,
     MixtureReductionAlgorithm mixtureReductionAlgorithm,
-    const Acts::Logger& logger);
+    const Acts::Logger& logger,
+    GsfMultiStepper multiStepper = GsfMultiStepper::loop);
 
 /// Makes a fitter function object for the Global Chi Square Fitter (GX2F)
 ///
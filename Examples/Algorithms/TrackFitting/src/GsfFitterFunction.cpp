@@ -16,7 +16,9 @@
 #include "Acts/EventData/VectorTrackContainer.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
 #include "Acts/Propagator/DirectNavigator.hpp"
+#include "Acts/Propagator/EigenStepperDefaultExtension.hpp"
 #include "Acts/Propagator/MultiEigenStepperLoop.hpp"
+#include "Acts/Propagator/MultiEigenStepperSIMD.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/TrackFitting/GainMatrixUpdater.hpp"
@@ -40,6 +42,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -57,22 +60,22 @@ using namespace ActsExamples;
 
 namespace {
 
-using MultiStepper =
-    Acts::MultiEigenStepperLoop<Acts::EigenStepperDefaultExtension,
-                                Acts::MaxWeightReducerLoop>;
-using Propagator = Acts::Propagator<MultiStepper, Acts::Navigator>;
-using DirectPropagator = Acts::Propagator<MultiStepper, Acts::DirectNavigator>;
-
-using Fitter = Acts::GaussianSumFitter<Propagator, BetheHeitlerApprox,
-                                       Acts::VectorMultiTrajectory>;
-using DirectFitter =
-    Acts::GaussianSumFitter<DirectPropagator, BetheHeitlerApprox,
-                            Acts::VectorMultiTrajectory>;
 using TrackContainer =
     Acts::TrackContainer<Acts::VectorTrackContainer,
                          Acts::VectorMultiTrajectory, std::shared_ptr>;
 
+template <typename multi_stepper_t>
 struct GsfFitterFunctionImpl final : public ActsExamples::TrackFitterFunction {
+  using Propagator = Acts::Propagator<multi_stepper_t, Acts::Navigator>;
+  using DirectPropagator =
+      Acts::Propagator<multi_stepper_t, Acts::DirectNavigator>;
+
+  using Fitter = Acts::GaussianSumFitter<Propagator, BetheHeitlerApprox,
+                                         Acts::VectorMultiTrajectory>;
+  using DirectFitter =
+      Acts::GaussianSumFitter<DirectPropagator, BetheHeitlerApprox,
+                              Acts::VectorMultiTrajectory>;
+
   Fitter fitter;
   DirectFitter directFitter;
 
@@ -187,43 +190,45 @@ struct GsfFitterFunctionImpl final : public ActsExamples::TrackFitterFunction {
   }
 };
 
-}  // namespace
-
-std::shared_ptr<TrackFitterFunction> ActsExamples::makeGsfFitterFunction(
+template <typename multi_stepper_t>
+std::shared_ptr<TrackFitterFunction> makeGsfFitterFunctionImpl(
     std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
     std::shared_ptr<const Acts::MagneticFieldProvider> magneticField,
     BetheHeitlerApprox betheHeitlerApprox, std::size_t maxComponents,
     double weightCutoff, Acts::ComponentMergeMethod componentMergeMethod,
     MixtureReductionAlgorithm mixtureReductionAlgorithm,
     const Acts::Logger& logger) {
+  using Impl = GsfFitterFunctionImpl<multi_stepper_t>;
+
   // Standard fitter
-  MultiStepper stepper(magneticField, logger.cloneWithSuffix("Step"));
+  multi_stepper_t stepper(magneticField, logger.cloneWithSuffix("Step"));
   const auto& geo = *trackingGeometry;
   Acts::Navigator::Config cfg{std::move(trackingGeometry)};
   cfg.resolvePassive = false;
   cfg.resolveMaterial = true;
   cfg.resolveSensitive = true;
   Acts::Navigator navigator(cfg, logger.cloneWithSuffix("Navigator"));
-  Propagator propagator(std::move(stepper), std::move(navigator),
-                        logger.cloneWithSuffix("Propagator"));
-  Fitter trackFitter(std::move(propagator),
-                     BetheHeitlerApprox(betheHeitlerApprox),
-                     logger.cloneWithSuffix("GSF"));
+  typename Impl::Propagator propagator(std::move(stepper),
+                                       std::move(navigator),
+                                       logger.cloneWithSuffix("Propagator"));
+  typename Impl::Fitter trackFitter(std::move(propagator),
+                                    BetheHeitlerApprox(betheHeitlerApprox),
+                                    logger.cloneWithSuffix("GSF"));
 
   // Direct fitter
-  MultiStepper directStepper(std::move(magneticField),
-                             logger.cloneWithSuffix("Step"));
+  multi_stepper_t directStepper(std::move(magneticField),
+                                logger.cloneWithSuffix("Step"));
   Acts::DirectNavigator directNavigator{
       logger.cloneWithSuffix("DirectNavigator")};
-  DirectPropagator directPropagator(std::move(directStepper),
-                                    std::move(directNavigator),
-                                    logger.cloneWithSuffix("DirectPropagator"));
-  DirectFitter directTrackFitter(std::move(directPropagator),
-                                 BetheHeitlerApprox(betheHeitlerApprox),
-                                 logger.cloneWithSuffix("DirectGSF"));
+  typename Impl::DirectPropagator directPropagator(
+      std::move(directStepper), std::move(directNavigator),
+      logger.cloneWithSuffix("DirectPropagator"));
+  typename Impl::DirectFitter directTrackFitter(
+      std::move(directPropagator), BetheHeitlerApprox(betheHeitlerApprox),
+      logger.cloneWithSuffix("DirectGSF"));
 
   // build the fitter functions. owns the fitter object.
-  auto fitterFunction = std::make_shared<GsfFitterFunctionImpl>(
+  auto fitterFunction = std::make_shared<Impl>(
       std::move(trackFitter), std::move(directTrackFitter), geo);
   fitterFunction->maxComponents = maxComponents;
   fitterFunction->weightCutoff = weightCutoff;
@@ -232,3 +237,30 @@ std::shared_ptr<TrackFitterFunction> ActsExamples::makeGsfFitterFunction(
 
   return fitterFunction;
 }
+
+}  // namespace
+
+std::shared_ptr<TrackFitterFunction> ActsExamples::makeGsfFitterFunction(
+    std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
+    std::shared_ptr<const Acts::MagneticFieldProvider> magneticField,
+    BetheHeitlerApprox betheHeitlerApprox, std::size_t maxComponents,
+    double weightCutoff, Acts::ComponentMergeMethod componentMergeMethod,
+    MixtureReductionAlgorithm mixtureReductionAlgorithm,
+    const Acts::Logger& logger, GsfMultiStepper multiStepper) {
+  switch (multiStepper) {
+    case GsfMultiStepper::loop:
+      return makeGsfFitterFunctionImpl<
+          Acts::MultiEigenStepperLoop<Acts::EigenStepperDefaultExtension,
+                                      Acts::MaxWeightReducerLoop>>(
+          std::move(trackingGeometry), std::move(magneticField),
+          std::move(betheHeitlerApprox), maxComponents, weightCutoff,
+          componentMergeMethod, mixtureReductionAlgorithm, logger);
+    case GsfMultiStepper::simd:
+      return makeGsfFitterFunctionImpl<
+          Acts::MultiEigenStepperSIMD<Acts::MaxWeightReducerLoop>>(
+          std::move(trackingGeometry), std::move(magneticField),
+          std::move(betheHeitlerApprox), maxComponents, weightCutoff,
+          componentMergeMethod, mixtureReductionAlgorithm, logger);
+  }
+  throw std::invalid_argument("Unknown multi-component stepper");
+}
@@ -32,6 +32,7 @@
 #include "ActsExamples/TruthTracking/TruthVertexFinder.hpp"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <optional>
 #include <ostream>
@@ -0,0 +1,191 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/Utilities/Axis.hpp"
+#include "Acts/Utilities/AxisFwd.hpp"
+#include "Acts/Utilities/Interpolation.hpp"
+#include "Acts/Utilities/detail/grid_helper.hpp"
+#include "ActsExamples/MagneticField/MagneticField.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace ActsExamples {
+
+/// Read-only field grid whose values are stored in external memory, e.g. a
+/// memory mapped binary field map file.
+///
+/// This provides the part of the Acts::Grid interface which is used by
+/// Acts::InterpolatedBFieldMap. The values are stored as consecutive doubles
+/// in the global bin order of Acts::Grid, including the under- and overflow
+/// bins, so a grid can be written out and used again without any conversion.
+///
+/// @tparam T value type, must be a fixed size Eigen vector of doubles
+/// @tparam Axes axis types of the grid
+template <typename T, class... Axes>
+class MappedFieldGrid {
+ public:
+  /// number of dimensions of the grid
+  static constexpr std::size_t DIM = sizeof...(Axes);
+
+  using value_type = T;
+  using point_t = std::array<Acts::ActsScalar, DIM>;
+  using index_t = std::array<std::size_t, DIM>;
+
+  /// @param axes the grid axes
+  /// @param storage keeps the memory behind @p values alive
+  /// @param values first grid value, must provide @c size() values
+  MappedFieldGrid(std::tuple<Axes...> axes,
+                  std::shared_ptr<const void> storage, const double* values)
+      : m_axes(std::move(axes)),
+        m_storage(std::move(storage)),
+        m_values(values) {}
+
+  /// total number of bins including under- and overflow bins
+  std::size_t size() const {
+    std::size_t nBins = 1;
+    for (std::size_t n : numLocalBins()) {
+      nBins *= n + 2;
+    }
+    return nBins;
+  }
+
+  /// @param bin global bin index
+  /// @return value stored in the bin
+  value_type at(std::size_t bin) const {
+    assert(bin < size());
+    return value_type(Eigen::Map<const value_type>(
+        m_values + bin * value_type::RowsAtCompileTime));
+  }
+
+  template <class Point>
+  Acts::detail::GlobalNeighborHoodIndices<DIM> closestPointsIndices(
+      const Point& position) const {
+    return Acts::detail::grid_helper::closestPointsIndices(
+        localBinsFromPosition(position), m_axes);
+  }
+
+  template <class Point>
+  index_t localBinsFromPosition(const Point& point) const {
+    return Acts::detail::grid_helper::getLocalBinIndices(point, m_axes);
+  }
+
+  point_t lowerLeftBinEdge(const index_t& localBins) const {
+    return Acts::detail::grid_helper::getLowerLeftBinEdge(localBins, m_axes);
+  }
+
+  point_t upperRightBinEdge(const index_t& localBins) const {
+    return Acts::detail::grid_helper::getUpperRightBinEdge(localBins, m_axes);
+  }
+
+  index_t numLocalBins() const {
+    return Acts::detail::grid_helper::getNBins(m_axes);
+  }
+
+  point_t minPosition() const {
+    return Acts::detail::grid_helper::getMin(m_axes);
+  }
+
+  point_t maxPosition() const {
+    return Acts::detail::grid_helper::getMax(m_axes);
+  }
+
+  /// @copydoc Acts::Grid::interpolate
+  template <class Point>
+  value_type interpolate(const Point& point) const {
+    constexpr std::size_t nCorners = 1 << DIM;
+    std::array<value_type, nCorners> neighbors;
+    const auto& llIndices = localBinsFromPosition(point);
+    std::size_t i = 0;
+    for (std::size_t index : closestPointsIndices(point)) {
+      neighbors.at(i++) = at(index);
+    }
+    return Acts::interpolate(point, lowerLeftBinEdge(llIndices),
+                             upperRightBinEdge(llIndices), neighbors);
+  }
+
+  /// @brief get the axes as a tuple
+  const std::tuple<Axes...>& axesTuple() const { return m_axes; }
+
+ private:
+  std::tuple<Axes...> m_axes;
+  std::shared_ptr<const void> m_storage;
+  const double* m_values = nullptr;
+};
+
+namespace detail {
+
+using MappedMagneticField2 = Acts::InterpolatedBFieldMap<
+    MappedFieldGrid<Acts::Vector2, Acts::Axis<Acts::AxisType::Equidistant>,
+                    Acts::Axis<Acts::AxisType::Equidistant>>>;
+
+using MappedMagneticField3 = Acts::InterpolatedBFieldMap<
+    MappedFieldGrid<Acts::Vector3, Acts::Axis<Acts::AxisType::Equidistant>,
+                    Acts::Axis<Acts::AxisType::Equidistant>,
+                    Acts::Axis<Acts::AxisType::Equidistant>>>;
+
+}  // namespace detail
+
+/// Write a rz field map to the binary field map format.
+///
+/// The binary format (version 2) consists of a fixed size header with the
+/// magic string, the format version, a byte order mark, the grid and value
+/// dimensions, the value format and the axis definitions, followed by the raw
+/// grid values as IEEE 754 doubles in internal units. The data block is
+/// aligned to 64 bytes so it can be used directly from a memory mapping. The
+/// byte order is the one of the writing machine. Files with a different byte
+/// order or value format are rejected when reading.
+///
+/// @note Only the grid is stored. When reading the file back, the standard
+///       rz transformations of Acts::fieldMapRZ are used.
+///
+/// @param fieldMapFile Path of the file to write
+/// @param fieldMap The field map to write
+void writeMagneticFieldMapBinary(
+    const std::string& fieldMapFile,
+    const detail::InterpolatedMagneticField2& fieldMap);
+
+/// Write a xyz field map to the binary field map format.
+///
+/// @note Only the grid is stored. When reading the file back, the standard
+///       xyz transformations of Acts::fieldMapXYZ are used.
+///
+/// @param fieldMapFile Path of the file to write
+/// @param fieldMap The field map to write
+void writeMagneticFieldMapBinary(
+    const std::string& fieldMapFile,
+    const detail::InterpolatedMagneticField3& fieldMap);
+
+/// Create a rz field map backed by a memory mapped binary field map file.
+///
+/// No parsing or copying of the field values takes place, the file is mapped
+/// read-only and the pages are shared between all processes using the same
+/// file.
+///
+/// @param fieldMapFile Path of the binary field map file
+/// @return A field map instance which keeps the file mapped while it exists
+detail::MappedMagneticField2 makeMagneticFieldMapRzFromBinary(
+    const std::string& fieldMapFile);
+
+/// Create a xyz field map backed by a memory mapped binary field map file.
+///
+/// @param fieldMapFile Path of the binary field map file
+/// @return A field map instance which keeps the file mapped while it exists
+detail::MappedMagneticField3 makeMagneticFieldMapXyzFromBinary(
+    const std::string& fieldMapFile);
+
+}  // namespace ActsExamples
@@ -0,0 +1,256 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/MagneticField/FieldMapBinaryIo.hpp"
+
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr std::array<char, 8> kMagic = {'A', 'C', 'T', 'S', 'B', 'F', 'M', 0};
+constexpr std::uint32_t kVersion = 2;
+constexpr std::uint64_t kDataAlignment = 64;
+/// written in the byte order of the writing machine
+constexpr std::uint32_t kByteOrderMark = 0x01020304;
+/// grid values are IEEE 754 binary64 numbers
+constexpr std::uint32_t kValueFormatFloat64 = 1;
+
+static_assert(std::numeric_limits<double>::is_iec559 && sizeof(double) == 8,
+              "The binary field map format requires IEEE 754 doubles");
+
+/// Fixed size header of the binary field map format
+struct BinaryFieldMapHeader {
+  std::array<char, 8> magic = kMagic;
+  std::uint32_t version = kVersion;
+  /// byte order of the file, see kByteOrderMark
+  std::uint32_t byteOrder = kByteOrderMark;
+  /// number of grid dimensions
+  std::uint32_t nDim = 0;
+  /// number of components of each grid value
+  std::uint32_t nValueDim = 0;
+  /// format of the grid values, see kValueFormatFloat64
+  std::uint32_t valueFormat = kValueFormatFloat64;
+  std::uint32_t reserved = 0;
+  /// axis definitions, unused entries are zero
+  std::array<double, 3> min{};
+  std::array<double, 3> max{};
+  std::array<std::uint64_t, 3> nBins{};
+  /// number of stored grid values including under- and overflow bins
+  std::uint64_t nValues = 0;
+  /// offset of the first grid value from the start of the file
+  std::uint64_t dataOffset = 0;
+};
+
+template <typename grid_t>
+void writeBinary(const std::string& fieldMapFile, const grid_t& grid) {
+  constexpr std::size_t nDim = grid_t::DIM;
+  constexpr std::size_t nValueDim = grid_t::value_type::RowsAtCompileTime;
+
+  BinaryFieldMapHeader header;
+  header.nDim = nDim;
+  header.nValueDim = nValueDim;
+  const auto min = grid.minPosition();
+  const auto max = grid.maxPosition();
+  const auto nBins = grid.numLocalBins();
+  for (std::size_t i = 0; i < nDim; ++i) {
+    header.min[i] = min[i];
+    header.max[i] = max[i];
+    header.nBins[i] = nBins[i];
+  }
+  header.nValues = grid.size();
+  header.dataOffset = ((sizeof(BinaryFieldMapHeader) + kDataAlignment - 1) /
+                       kDataAlignment) *
+                      kDataAlignment;
+
+  std::ofstream file(fieldMapFile, std::ios::out | std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("Unable to open field map file " +
+                             fieldMapFile + " for writing");
+  }
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  const std::vector<char> padding(header.dataOffset - sizeof(header), 0);
+  file.write(padding.data(), padding.size());
+  for (std::size_t i = 0; i < grid.size(); ++i) {
+    const auto& value = grid.at(i);
+    for (std::size_t j = 0; j < nValueDim; ++j) {
+      const double component = value[j];
+      file.write(reinterpret_cast<const char*>(&component), sizeof(double));
+    }
+  }
+  if (!file) {
+    throw std::runtime_error("Failed to write field map file " + fieldMapFile);
+  }
+}
+
+/// Map the file read-only and validate the header
+///
+/// @return the mapping, which is released with the last copy of the pointer,
+///         and the header
+std::pair<std::shared_ptr<const void>, BinaryFieldMapHeader> mapBinary(
+    const std::string& fieldMapFile, std::uint32_t nDim) {
+  int fd = ::open(fieldMapFile.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Unable to open field map file " + fieldMapFile);
+  }
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Unable to stat field map file " + fieldMapFile);
+  }
+  const auto fileSize = static_cast<std::size_t>(st.st_size);
+  if (fileSize < sizeof(BinaryFieldMapHeader)) {
+    ::close(fd);
+    throw std::runtime_error("Field map file " + fieldMapFile +
+                             " is too small for the header");
+  }
+  void* address = ::mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+  // the mapping stays valid after closing the file descriptor
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    throw std::runtime_error("Unable to map field map file " + fieldMapFile);
+  }
+  std::shared_ptr<const void> mapping(
+      address, [fileSize](const void* p) {
+        ::munmap(const_cast<void*>(p), fileSize);
+      });
+
+  BinaryFieldMapHeader header;
+  std::memcpy(&header, address, sizeof(header));
+  if (header.magic != kMagic) {
+    throw std::runtime_error(fieldMapFile + " is not a binary field map file");
+  }
+  if (header.version != kVersion) {
+    throw std::runtime_error("Unsupported binary field map version " +
+                             std::to_string(header.version) + " in " +
+                             fieldMapFile);
+  }
+  if (header.byteOrder != kByteOrderMark) {
+    throw std::runtime_error("Binary field map " + fieldMapFile +
+                             " was written with a different byte order");
+  }
+  if (header.valueFormat != kValueFormatFloat64) {
+    throw std::runtime_error("Unsupported value format " +
+                             std::to_string(header.valueFormat) +
+                             " in binary field map " + fieldMapFile);
+  }
+  if (header.nDim != nDim || header.nValueDim != nDim) {
+    throw std::runtime_error("Binary field map " + fieldMapFile + " has " +
+                             std::to_string(header.nDim) +
+                             " dimensions, expected " + std::to_string(nDim));
+  }
+  std::uint64_t nValues = 1;
+  for (std::size_t i = 0; i < nDim; ++i) {
+    nValues *= header.nBins[i] + 2;
+  }
+  const std::uint64_t dataSize = nValues * header.nValueDim * sizeof(double);
+  if (header.nValues != nValues || header.dataOffset % alignof(double) != 0 ||
+      header.dataOffset > fileSize || fileSize - header.dataOffset < dataSize) {
+    throw std::runtime_error("Binary field map " + fieldMapFile +
+                             " is inconsistent or truncated");
+  }
+  return {std::move(mapping), header};
+}
+
+template <typename field_map_t, std::size_t... Is>
+typename field_map_t::Grid makeMappedGrid(const std::string& fieldMapFile,
+                                          std::index_sequence<Is...>) {
+  using Grid = typename field_map_t::Grid;
+  auto [mapping, header] = mapBinary(fieldMapFile, Grid::DIM);
+  const auto* values = reinterpret_cast<const double*>(
+      static_cast<const char*>(mapping.get()) + header.dataOffset);
+  return Grid(std::tuple(Acts::Axis(header.min[Is], header.max[Is],
+                                    header.nBins[Is])...),
+              std::move(mapping), values);
+}
+
+}  // namespace
+
+void ActsExamples::writeMagneticFieldMapBinary(
+    const std::string& fieldMapFile,
+    const detail::InterpolatedMagneticField2& fieldMap) {
+  writeBinary(fieldMapFile, fieldMap.getGrid());
+}
+
+void ActsExamples::writeMagneticFieldMapBinary(
+    const std::string& fieldMapFile,
+    const detail::InterpolatedMagneticField3& fieldMap) {
+  writeBinary(fieldMapFile, fieldMap.getGrid());
+}
+
+ActsExamples::detail::MappedMagneticField2
+ActsExamples::makeMagneticFieldMapRzFromBinary(
+    const std::string& fieldMapFile) {
+  using Acts::VectorHelpers::perp;
+
+  auto grid = makeMappedGrid<detail::MappedMagneticField2>(
+      fieldMapFile, std::make_index_sequence<2>());
+
+  // same transformations as in Acts::fieldMapRZ
+  auto transformPos = [](const Acts::Vector3& pos) {
+    return Acts::Vector2(perp(pos), pos.z());
+  };
+
+  auto transformBField = [](const Acts::Vector2& field,
+                            const Acts::Vector3& pos) {
+    double r_sin_theta_2 = pos.x() * pos.x() + pos.y() * pos.y();
+    double cos_phi = 0, sin_phi = 0;
+    if (r_sin_theta_2 > std::numeric_limits<double>::min()) {
+      double inv_r_sin_theta = 1. / std::sqrt(r_sin_theta_2);
+      cos_phi = pos.x() * inv_r_sin_theta;
+      sin_phi = pos.y() * inv_r_sin_theta;
+    } else {
+      cos_phi = 1.;
+      sin_phi = 0.;
+    }
+    return Acts::Vector3(field.x() * cos_phi, field.x() * sin_phi, field.y());
+  };
+
+  return detail::MappedMagneticField2(
+      {transformPos, transformBField, std::move(grid), 1.,
+       Acts::transformPosJacobianRZ, Acts::transformBFieldJacobianRZ});
+}
+
+ActsExamples::detail::MappedMagneticField3
+ActsExamples::makeMagneticFieldMapXyzFromBinary(
+    const std::string& fieldMapFile) {
+  auto grid = makeMappedGrid<detail::MappedMagneticField3>(
+      fieldMapFile, std::make_index_sequence<3>());
+
+  // same transformations as in Acts::fieldMapXYZ
+  auto transformPos = [](const Acts::Vector3& pos) { return pos; };
+
+  auto transformPosJacobian = [](const Acts::Vector3& /*pos*/) {
+    return Acts::ActsMatrix<3, 3>::Identity().eval();
+  };
+  auto transformBFieldJacobian = [](const Acts::Vector3& /*field*/,
+                                    const Acts::Vector3& /*pos*/) {
+    return Acts::ActsMatrix<3, 3>::Zero().eval();
+  };
+
+  auto transformBField = [](const Acts::Vector3& field,
+                            const Acts::Vector3& /*pos*/) { return field; };
+
+  return detail::MappedMagneticField3(
+      {transformPos, transformBField, std::move(grid), 1.,
+       transformPosJacobian, transformBFieldJacobian});
+}
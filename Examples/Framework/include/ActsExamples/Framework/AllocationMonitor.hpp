@@ -0,0 +1,87 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ActsExamples {
+
+/// Scoped monitor of the heap allocations of the current thread
+///
+/// The allocations are recorded by replacements of the global allocation and
+/// deallocation functions, which are thin wrappers around the C allocator.
+/// They are not part of the framework library, but of the separate
+/// ActsExamplesAllocationHooks library, which is only built with
+/// ACTS_BUILD_EXAMPLES_ALLOCATION_HOOKS. It has to be preloaded, e.g. with
+/// LD_PRELOAD, or linked into the executable. While a monitor is alive, the
+/// wrappers record every allocation and deallocation of the thread which
+/// created the monitor. Without a monitor, the overhead is a single lookup
+/// of the current monitor per allocation. Without the hooks library, nothing
+/// is recorded.
+///
+/// Only the innermost monitor of a thread records. Allocations made by other
+/// threads, e.g. by tasks which are spawned by the monitored code, are not
+/// attributed to the monitor.
+///
+/// In addition, the monitor records how much the peak resident set size of
+/// the process grew during its lifetime. This is a process wide quantity,
+/// which is attributed to whichever monitor observes the growth.
+class AllocationMonitor {
+ public:
+  struct Result {
+    /// Number of allocations
+    std::size_t allocations = 0;
+    /// Number of deallocations
+    std::size_t deallocations = 0;
+    /// Number of allocated bytes
+    std::size_t allocatedBytes = 0;
+    /// High-water mark of the live heap bytes, relative to the start
+    std::size_t peakBytes = 0;
+    /// Growth of the peak resident set size of the process in bytes
+    std::size_t peakRssIncrease = 0;
+
+    /// Accumulate a result, the high-water mark is the maximum of both
+    void merge(const Result& other);
+  };
+
+  /// Start monitoring the current thread
+  AllocationMonitor();
+  /// Stop monitoring and restore the previous monitor of the thread
+  ~AllocationMonitor();
+
+  AllocationMonitor(const AllocationMonitor&) = delete;
+  AllocationMonitor& operator=(const AllocationMonitor&) = delete;
+
+  /// @return the allocations recorded so far
+  Result result() const;
+
+  /// @return the innermost monitor of the current thread, if any
+  static AllocationMonitor* current();
+
+  /// Check whether the replaced allocation functions are in use
+  ///
+  /// This is not the case if the hooks library is not loaded, or if the
+  /// symbol lookup of the process prefers another definition, and then no
+  /// allocations are recorded.
+  static bool hooksInstalled();
+
+  /// Record an allocation, called by the allocation functions
+  void recordAllocation(std::size_t bytes);
+  /// Record a deallocation, called by the deallocation functions
+  void recordDeallocation(std::size_t bytes);
+
+ private:
+  AllocationMonitor* m_previous = nullptr;
+  Result m_result;
+  std::int64_t m_liveBytes = 0;
+  std::size_t m_startPeakRss = 0;
+};
+
+}  // namespace ActsExamples
@@ -41,6 +41,7 @@ class DataHandleBase {
   void maybeInitialize(const std::string& key) {
     if (!key.empty()) {
       m_key = key;
+      m_slot = WhiteBoard::slot(key);
     }
   }
 
@@ -52,6 +53,8 @@ class DataHandleBase {
   SequenceElement* m_parent{nullptr};
   std::string m_name;
   std::optional<std::string> m_key{};
+  // white board slot of the key, resolved once at initialization
+  std::size_t m_slot = 0;
 };
 
 template <typename T>
@@ -74,7 +77,7 @@ class WriteDataHandle final : public DataHandleBase {
       throw std::runtime_error{"WriteDataHandle '" + fullName() +
                                "' not initialized"};
     }
-    wb.add(m_key.value(), std::move(value));
+    wb.add(m_slot, std::move(value));
   }
 
   void initialize(const std::string& key) {
@@ -83,6 +86,7 @@ class WriteDataHandle final : public DataHandleBase {
                                   "' cannot receive empty key"};
     }
     m_key = key;
+    m_slot = WhiteBoard::slot(key);
   }
 
   bool isCompatible(const DataHandleBase& other) const override {
@@ -106,6 +110,7 @@ class ReadDataHandle final : public DataHandleBase {
                                   "' cannot receive empty key"};
     }
     m_key = key;
+    m_slot = WhiteBoard::slot(key);
   }
 
   const T& operator()(const AlgorithmContext& ctx) const {
@@ -117,7 +122,7 @@ class ReadDataHandle final : public DataHandleBase {
       throw std::runtime_error{"ReadDataHandle '" + fullName() +
                                "' not initialized"};
     }
-    return wb.get<T>(m_key.value());
+    return wb.get<T>(m_slot);
   }
 
   bool isCompatible(const DataHandleBase& other) const override {
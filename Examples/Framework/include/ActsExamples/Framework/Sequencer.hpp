@@ -87,6 +87,21 @@ class Sequencer {
     std::vector<FpeMask> fpeMasks{};
     bool failOnFirstFpe = false;
     std::size_t fpeStackTraceLength = 8;
+
+    /// Record the heap allocations and the growth of the peak resident set
+    /// size of every sequence element and add them to the timing file. The
+    /// heap allocations require the allocation hooks library, see
+    /// AllocationMonitor.
+    bool trackAllocations = false;
+
+    /// Run the sequence elements of an event concurrently as soon as the
+    /// elements which write their inputs have finished, instead of strictly
+    /// in the order in which they were added. The dependencies are derived
+    /// from the read and write data handles of the elements. An element
+    /// without any data handles, e.g. a Python algorithm which accesses the
+    /// event store directly, runs after all earlier elements and before all
+    /// later ones.
+    bool concurrentAlgorithms = false;
   };
 
   Sequencer(const Config &cfg);
@@ -156,6 +171,8 @@ class Sequencer {
  private:
   /// List of all configured algorithm names.
   std::vector<std::string> listAlgorithmNames() const;
+  /// Indices of the sequence elements each sequence element reads data from
+  std::vector<std::vector<std::size_t>> dataDependencies() const;
   /// Determine range of (requested) events;
   /// [std::numeric_limits<std::size_t>::max(),
   /// std::numeric_limits<std::size_t>::max()) for error.
@@ -12,9 +12,13 @@
 #include <Acts/Utilities/Logger.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <ostream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -31,20 +35,55 @@ namespace ActsExamples {
 /// This is an append-only container that takes ownership of the objects
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
-/// Its lifetime is bound to the lifetime of the white board.
+/// Its lifetime is bound to the lifetime of the white board, or until the
+/// white board is cleared.
+///
+/// Every object name is mapped to an integer slot in a process wide
+/// registry, once, when a data handle is initialized with it. The white board
+/// itself is an array of slots, so that accessing an object through a data
+/// handle neither hashes a string nor allocates. Objects in different slots
+/// can be added and read concurrently without locking, e.g. by sequence
+/// elements of the same event which run in parallel. The slots are stored in
+/// chunks which are never moved, so that the white board can also grow
+/// concurrently for names which were registered after it was created.
 class WhiteBoard {
  public:
   WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
                  Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO),
-             std::unordered_map<std::string, std::string> objectAliases = {});
+             const std::unordered_map<std::string, std::string>&
+                 objectAliases = {});
 
   // A WhiteBoard holds unique elements and can not be copied
   WhiteBoard(const WhiteBoard& other) = delete;
   WhiteBoard& operator=(const WhiteBoard&) = delete;
 
+  ~WhiteBoard();
+
   bool exists(const std::string& name) const;
 
+  /// Remove all objects, so that the white board can be reused for the next
+  /// event. Must not be called concurrently with any other access.
+  void clear();
+
+  /// Replace the logger, e.g. to name the white board after the next event.
+  /// Must not be called concurrently with any other access.
+  void setLogger(std::unique_ptr<const Acts::Logger> logger);
+
+  /// Get the slot of an object name, registering the name if necessary.
+  ///
+  /// @param name Non-empty object name
+  /// @return the slot, which is the same for the lifetime of the process
+  static std::size_t slot(const std::string& name);
+
  private:
+  /// Store an object on the white board and transfer ownership.
+  ///
+  /// @param slot Slot of the object name
+  /// @param object Movable reference to the transferable object
+  /// @throws std::invalid_argument on duplicate object
+  template <typename T>
+  void add(std::size_t slot, T&& object);
+
   /// Store an object on the white board and transfer ownership.
   ///
   /// @param name Non-empty identifier to store it under
@@ -53,6 +92,14 @@ class WhiteBoard {
   template <typename T>
   void add(const std::string& name, T&& object);
 
+  /// Get access to a stored object.
+  ///
+  /// @param[in] slot Slot of the object name
+  /// @return reference to the stored object
+  /// @throws std::out_of_range if no object is stored in the requested slot
+  template <typename T>
+  const T& get(std::size_t slot) const;
+
   /// Get access to a stored object.
   ///
   /// @param[in] name Identifier for the object
@@ -80,9 +127,44 @@ class WhiteBoard {
     const std::type_info& type() const override { return typeid(T); }
   };
 
+  struct Slot {
+    // the object visible in this slot, which is either owned by this slot
+    // or, for aliases, by the slot of the original object
+    std::atomic<const IHolder*> object{nullptr};
+    std::unique_ptr<const IHolder> owned;
+  };
+
+  /// Number of slots in the first chunk, every following chunk is twice as
+  /// large as the previous one
+  static constexpr std::size_t s_firstChunkSize = 64;
+  /// Maximum number of chunks, which is enough for any number of slots
+  static constexpr std::size_t s_maxChunks = 48;
+
+  /// The chunk of a slot and the index of the slot within the chunk
+  static std::pair<std::size_t, std::size_t> chunkIndex(std::size_t slot);
+  /// The number of slots in a chunk
+  static std::size_t chunkSize(std::size_t chunk);
+  /// Get a slot, allocating its chunk if necessary
+  Slot& ensureSlot(std::size_t slot);
+  /// Get a slot, or nullptr if its chunk has not been allocated
+  Slot* findSlotStorage(std::size_t slot) const;
+  /// Store a holder in a slot, which takes ownership
+  void store(std::size_t slot, std::unique_ptr<const IHolder> holder,
+             const char* typeName);
+  /// The object in a slot or nullptr
+  const IHolder* find(std::size_t slot) const;
+  /// The name of the object in a slot
+  static std::string slotName(std::size_t slot);
+  /// The slot of an object name if it is registered
+  static std::optional<std::size_t> findSlot(const std::string& name);
+  /// The number of registered slots
+  static std::size_t numSlots();
+
   std::unique_ptr<const Acts::Logger> m_logger;
-  std::unordered_map<std::string, std::shared_ptr<IHolder>> m_store;
-  std::unordered_map<std::string, std::string> m_objectAliases;
+  // chunks of slots, which are allocated on demand and never moved
+  std::array<std::atomic<Slot*>, s_maxChunks> m_chunks{};
+  // pairs of the slots of an object and of its alias
+  std::vector<std::pair<std::size_t, std::size_t>> m_aliasSlots;
 
   const Acts::Logger& logger() const { return *m_logger; }
 
@@ -98,34 +180,25 @@ class WhiteBoard {
 
 }  // namespace ActsExamples
 
-inline ActsExamples::WhiteBoard::WhiteBoard(
-    std::unique_ptr<const Acts::Logger> logger,
-    std::unordered_map<std::string, std::string> objectAliases)
-    : m_logger(std::move(logger)), m_objectAliases(std::move(objectAliases)) {}
+template <typename T>
+inline void ActsExamples::WhiteBoard::add(std::size_t slot, T&& object) {
+  store(slot, std::make_unique<HolderT<T>>(std::forward<T>(object)),
+        typeid(T).name());
+}
 
 template <typename T>
 inline void ActsExamples::WhiteBoard::add(const std::string& name, T&& object) {
   if (name.empty()) {
     throw std::invalid_argument("Object can not have an empty name");
   }
-  if (m_store.contains(name)) {
-    throw std::invalid_argument("Object '" + name + "' already exists");
-  }
-  auto holder = std::make_shared<HolderT<T>>(std::forward<T>(object));
-  m_store.emplace(name, holder);
-  ACTS_VERBOSE("Added object '" << name << "' of type " << typeid(T).name());
-  if (auto it = m_objectAliases.find(name); it != m_objectAliases.end()) {
-    m_store[it->second] = holder;
-    ACTS_VERBOSE("Added alias object '" << it->second << "'");
-  }
+  add(WhiteBoard::slot(name), std::forward<T>(object));
 }
 
 template <typename T>
-inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
-  ACTS_VERBOSE("Attempt to get object '" << name << "' of type "
-                                         << typeid(T).name());
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
+inline const T& ActsExamples::WhiteBoard::get(std::size_t slot) const {
+  const IHolder* holder = find(slot);
+  if (holder == nullptr) {
+    const std::string name = slotName(slot);
     const auto names = similarNames(name, 10, 3);
 
     std::stringstream ss;
@@ -140,20 +213,21 @@ inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
     throw std::out_of_range("Object '" + name + "' does not exists" + ss.str());
   }
 
-  const IHolder* holder = it->second.get();
-
-  const auto* castedHolder = dynamic_cast<const HolderT<T>*>(holder);
-  if (castedHolder == nullptr) {
-    std::string msg =
-        typeMismatchMessage(name, typeid(T).name(), holder->type().name());
+  // comparing the type is cheaper than a dynamic cast
+  if (holder->type() != typeid(T)) {
+    std::string msg = typeMismatchMessage(slotName(slot), typeid(T).name(),
+                                          holder->type().name());
     throw std::out_of_range(msg.c_str());
   }
 
-  ACTS_VERBOSE("Retrieved object '" << name << "'");
-  return castedHolder->value;
+  return static_cast<const HolderT<T>*>(holder)->value;
 }
 
-inline bool ActsExamples::WhiteBoard::exists(const std::string& name) const {
-  // TODO remove this function?
-  return m_store.contains(name);
+template <typename T>
+inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
+  ACTS_VERBOSE("Attempt to get object '" << name << "' of type "
+                                         << typeid(T).name());
+  const T& value = get<T>(WhiteBoard::slot(name));
+  ACTS_VERBOSE("Retrieved object '" << name << "'");
+  return value;
 }
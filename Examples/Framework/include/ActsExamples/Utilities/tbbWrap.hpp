@@ -21,6 +21,7 @@
 #include <tbb/parallel_for.h>
 #include <tbb/queuing_mutex.h>
 #include <tbb/task_arena.h>
+#include <tbb/task_group.h>
 #endif
 
 /// Wrapper for most of the tbb functions that we use in Sequencer.
@@ -132,6 +133,43 @@ class parallel_for {
   }
 };
 
+/// Small wrapper for tbb::task_group.
+/// Without tbb, the tasks are executed immediately when they are run.
+class task_group {
+#ifndef ACTS_EXAMPLES_NO_TBB
+  std::optional<tbb::task_group> tbb;
+#endif
+
+ public:
+  task_group() {
+#ifndef ACTS_EXAMPLES_NO_TBB
+    if (enableTBB()) {
+      tbb.emplace();
+    }
+#endif
+  }
+
+  template <typename F>
+  void run(const F& f) {
+#ifndef ACTS_EXAMPLES_NO_TBB
+    if (tbb) {
+      tbb->run(f);
+    } else
+#endif
+    {
+      f();
+    }
+  }
+
+  void wait() {
+#ifndef ACTS_EXAMPLES_NO_TBB
+    if (tbb) {
+      tbb->wait();
+    }
+#endif
+  }
+};
+
 /// Small wrapper for tbb::queuing_mutex and tbb::queuing_mutex::scoped_lock.
 class queuing_mutex {
 #ifndef ACTS_EXAMPLES_NO_TBB
@@ -0,0 +1,194 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+// Replacements of the global allocation and deallocation functions, which
+// forward to the allocation monitor of the current thread. This file is built
+// into a separate library, which is only in effect when it is preloaded or
+// linked into an executable, see AllocationMonitor.
+
+#include "ActsExamples/Framework/AllocationMonitor.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+namespace ActsExamples {
+
+namespace {
+
+// Allocated and deallocated sizes are both taken from the allocator, so that
+// they match even for deallocation functions without a size argument.
+std::size_t allocationSize(void* ptr) {
+#if defined(__APPLE__)
+  return malloc_size(ptr);
+#else
+  return malloc_usable_size(ptr);
+#endif
+}
+
+void* allocate(std::size_t size, std::size_t alignment) noexcept {
+  void* ptr = nullptr;
+  if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    ptr = std::malloc(std::max<std::size_t>(size, 1));
+  } else {
+    // the size has to be a multiple of the alignment
+    ptr = std::aligned_alloc(
+        alignment, std::max<std::size_t>(
+                       (size + alignment - 1) / alignment * alignment,
+                       alignment));
+  }
+  if (AllocationMonitor* monitor = AllocationMonitor::current();
+      monitor != nullptr && ptr != nullptr) {
+    monitor->recordAllocation(allocationSize(ptr));
+  }
+  return ptr;
+}
+
+void* allocateOrThrow(std::size_t size, std::size_t alignment) {
+  while (true) {
+    if (void* ptr = allocate(size, alignment); ptr != nullptr) {
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc{};
+    }
+    handler();
+  }
+}
+
+void deallocate(void* ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (AllocationMonitor* monitor = AllocationMonitor::current();
+      monitor != nullptr) {
+    monitor->recordDeallocation(allocationSize(ptr));
+  }
+  std::free(ptr);
+}
+
+constexpr std::size_t kDefaultAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+}  // namespace
+
+}  // namespace ActsExamples
+
+void* operator new(std::size_t size) {
+  return ActsExamples::allocateOrThrow(size, ActsExamples::kDefaultAlignment);
+}
+
+void* operator new[](std::size_t size) {
+  return ActsExamples::allocateOrThrow(size, ActsExamples::kDefaultAlignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return ActsExamples::allocateOrThrow(size,
+                                       static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return ActsExamples::allocateOrThrow(size,
+                                       static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  try {
+    return ActsExamples::allocateOrThrow(size,
+                                         ActsExamples::kDefaultAlignment);
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  try {
+    return ActsExamples::allocateOrThrow(size,
+                                         ActsExamples::kDefaultAlignment);
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t& /*tag*/) noexcept {
+  try {
+    return ActsExamples::allocateOrThrow(size,
+                                         static_cast<std::size_t>(alignment));
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t& /*tag*/) noexcept {
+  try {
+    return ActsExamples::allocateOrThrow(size,
+                                         static_cast<std::size_t>(alignment));
+  } catch (const std::bad_alloc&) {
+    return nullptr;
+  }
+}
+
+void operator delete(void* ptr) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t /*alignment*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/,
+                       std::align_val_t /*alignment*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/,
+                     const std::nothrow_t& /*tag*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t /*alignment*/,
+                       const std::nothrow_t& /*tag*/) noexcept {
+  ActsExamples::deallocate(ptr);
+}
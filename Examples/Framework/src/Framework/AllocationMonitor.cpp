@@ -0,0 +1,88 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/AllocationMonitor.hpp"
+
+#include <algorithm>
+#include <new>
+
+#include <sys/resource.h>
+
+namespace ActsExamples {
+
+namespace {
+
+thread_local AllocationMonitor* s_currentMonitor = nullptr;
+
+std::size_t peakRss() {
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#if defined(__APPLE__)
+  // reported in bytes
+  return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+  // reported in kilobytes
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+}  // namespace
+
+void AllocationMonitor::Result::merge(const Result& other) {
+  allocations += other.allocations;
+  deallocations += other.deallocations;
+  allocatedBytes += other.allocatedBytes;
+  peakBytes = std::max(peakBytes, other.peakBytes);
+  peakRssIncrease += other.peakRssIncrease;
+}
+
+AllocationMonitor::AllocationMonitor()
+    : m_previous(s_currentMonitor), m_startPeakRss(peakRss()) {
+  s_currentMonitor = this;
+}
+
+AllocationMonitor::~AllocationMonitor() {
+  s_currentMonitor = m_previous;
+}
+
+AllocationMonitor::Result AllocationMonitor::result() const {
+  Result result = m_result;
+  result.peakRssIncrease = peakRss() - m_startPeakRss;
+  return result;
+}
+
+AllocationMonitor* AllocationMonitor::current() {
+  return s_currentMonitor;
+}
+
+bool AllocationMonitor::hooksInstalled() {
+  AllocationMonitor monitor;
+  // an explicit call of the allocation function cannot be elided
+  void* ptr = ::operator new(1);
+  ::operator delete(ptr);
+  return monitor.m_result.allocations > 0;
+}
+
+void AllocationMonitor::recordAllocation(std::size_t bytes) {
+  ++m_result.allocations;
+  m_result.allocatedBytes += bytes;
+  m_liveBytes += static_cast<std::int64_t>(bytes);
+  if (m_liveBytes > 0) {
+    m_result.peakBytes =
+        std::max(m_result.peakBytes, static_cast<std::size_t>(m_liveBytes));
+  }
+}
+
+void AllocationMonitor::recordDeallocation(std::size_t bytes) {
+  ++m_result.deallocations;
+  m_liveBytes -= static_cast<std::int64_t>(bytes);
+}
+
+}  // namespace ActsExamples
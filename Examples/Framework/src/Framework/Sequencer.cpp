@@ -12,6 +12,7 @@
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/AllocationMonitor.hpp"
 #include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/IContextDecorator.hpp"
@@ -34,6 +35,7 @@
 #include <iterator>
 #include <limits>
 #include <numeric>
+#include <optional>
 #include <ostream>
 #include <ratio>
 #include <regex>
@@ -285,6 +287,69 @@ std::vector<std::string> Sequencer::listAlgorithmNames() const {
   return names;
 }
 
+std::vector<std::vector<std::size_t>> Sequencer::dataDependencies() const {
+  std::vector<std::vector<std::size_t>> dependencies(m_sequenceElements.size());
+  // the element which writes each white board key, including aliases
+  std::unordered_map<std::string, std::size_t> producers;
+  // the last element without data handles, e.g. an algorithm which accesses
+  // the white board directly
+  std::optional<std::size_t> lastUndeclared;
+
+  auto isInitialized = [](const DataHandleBase* handle) {
+    return handle->isInitialized();
+  };
+
+  for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+    const SequenceElement& element = *m_sequenceElements[i].sequenceElement;
+
+    // an element without data handles may read or write anything, so it runs
+    // after all earlier elements and before all later ones
+    if (std::ranges::none_of(element.readHandles(), isInitialized) &&
+        std::ranges::none_of(element.writeHandles(), isInitialized)) {
+      for (std::size_t j = 0; j < i; ++j) {
+        dependencies[i].push_back(j);
+      }
+      lastUndeclared = i;
+      ACTS_DEBUG(getAlgorithmType(element)
+                 << " " << element.name()
+                 << " has no data handles and depends on all earlier "
+                    "sequence elements");
+      continue;
+    }
+    if (lastUndeclared.has_value()) {
+      dependencies[i].push_back(*lastUndeclared);
+    }
+
+    for (const auto* handle : element.readHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      // keys without producer have been rejected when adding the element
+      if (auto it = producers.find(handle->key()); it != producers.end() &&
+          !Acts::rangeContainsValue(dependencies[i], it->second)) {
+        dependencies[i].push_back(it->second);
+      }
+    }
+
+    for (const auto* handle : element.writeHandles()) {
+      if (!handle->isInitialized()) {
+        continue;
+      }
+      producers[handle->key()] = i;
+      if (auto it = m_whiteboardObjectAliases.find(handle->key());
+          it != m_whiteboardObjectAliases.end()) {
+        producers[it->second] = i;
+      }
+    }
+
+    ACTS_DEBUG(getAlgorithmType(element)
+               << " " << element.name() << " depends on "
+               << dependencies[i].size() << " sequence elements");
+  }
+
+  return dependencies;
+}
+
 std::pair<std::size_t, std::size_t> Sequencer::determineEventsRange() const {
   constexpr auto kInvalidEventsRange =
       std::make_pair(std::numeric_limits<std::size_t>::max(),
@@ -364,6 +429,24 @@ struct StopWatch {
   ~StopWatch() { store += Clock::now() - start; }
 };
 
+// RAII-based allocation monitor of the execution within a block, which
+// merges the allocations into the given store if enabled
+struct AllocationScope {
+  std::optional<AllocationMonitor> monitor;
+  AllocationMonitor::Result& store;
+
+  AllocationScope(bool enabled, AllocationMonitor::Result& s) : store(s) {
+    if (enabled) {
+      monitor.emplace();
+    }
+  }
+  ~AllocationScope() {
+    if (monitor) {
+      store.merge(monitor->result());
+    }
+  }
+};
+
 // Convert duration to a printable string w/ reasonable unit.
 template <typename D>
 inline std::string asString(D duration) {
@@ -387,16 +470,29 @@ inline std::string perEvent(D duration, std::size_t numEvents) {
 
 void storeTiming(const std::vector<std::string>& identifiers,
                  const std::vector<Duration>& durations, std::size_t numEvents,
-                 const std::string& path) {
+                 const std::string& path,
+                 const std::vector<AllocationMonitor::Result>* allocations) {
   std::ofstream file(path);
 
-  file << "identifier,time_total_s,time_perevent_s\n";
+  file << "identifier,time_total_s,time_perevent_s";
+  if (allocations != nullptr) {
+    file << ",allocations_perevent,allocated_bytes_perevent,peak_heap_bytes,"
+            "peak_rss_increase_bytes";
+  }
+  file << "\n";
 
   for (std::size_t i = 0; i < identifiers.size(); ++i) {
     const auto time_total_s =
         std::chrono::duration_cast<Seconds>(durations[i]).count();
     file << identifiers[i] << "," << time_total_s << ","
-         << time_total_s / numEvents << "\n";
+         << time_total_s / numEvents;
+    if (allocations != nullptr) {
+      const AllocationMonitor::Result& alloc = (*allocations)[i];
+      file << "," << static_cast<double>(alloc.allocations) / numEvents << ","
+           << static_cast<double>(alloc.allocatedBytes) / numEvents << ","
+           << alloc.peakBytes << "," << alloc.peakRssIncrease;
+    }
+    file << "\n";
   }
   file << "\n";
 }
@@ -408,6 +504,8 @@ int Sequencer::run() {
   // per-algorithm time measures
   std::vector<std::string> names = listAlgorithmNames();
   std::vector<Duration> clocksAlgorithms(names.size(), Duration::zero());
+  // per-algorithm allocation measures, only filled if requested
+  std::vector<AllocationMonitor::Result> allocationsAlgorithms(names.size());
   tbbWrap::queuing_mutex clocksAlgorithmsMutex;
 
   // processing only works w/ a well-known number of events
@@ -443,6 +541,13 @@ int Sequencer::run() {
   ACTS_INFO("  " << nAlgorithms << " algorithms");
   ACTS_INFO("  " << nWriters << " writers");
 
+  if (m_cfg.trackAllocations && !AllocationMonitor::hooksInstalled()) {
+    ACTS_WARNING(
+        "Allocation tracking requested, but the allocation hooks are not in "
+        "use. Build with ACTS_BUILD_EXAMPLES_ALLOCATION_HOOKS and preload "
+        "libActsExamplesAllocationHooks. No allocations will be recorded.");
+  }
+
   ACTS_VERBOSE("Initialize sequence elements");
   for (auto& [alg, fpe] : m_sequenceElements) {
     ACTS_VERBOSE("Initialize " << getAlgorithmType(*alg) << ": "
@@ -454,6 +559,19 @@ int Sequencer::run() {
     }
   }
 
+  // data dependencies between the sequence elements, which determine the
+  // order of execution within an event if elements may run concurrently
+  std::vector<std::vector<std::size_t>> dependencies = dataDependencies();
+  std::vector<std::vector<std::size_t>> dependents(dependencies.size());
+  for (std::size_t i = 0; i < dependencies.size(); ++i) {
+    for (std::size_t dependency : dependencies[i]) {
+      dependents[dependency].push_back(i);
+    }
+  }
+  if (m_cfg.concurrentAlgorithms) {
+    ACTS_INFO("Run independent sequence elements of an event concurrently");
+  }
+
   // execute the parallel event loop
   std::atomic<std::size_t> nProcessedEvents = 0;
   std::size_t nTotalEvents = eventsRange.second - eventsRange.first;
@@ -463,22 +581,33 @@ int Sequencer::run() {
         [&](const tbb::blocked_range<std::size_t>& r) {
           std::vector<Duration> localClocksAlgorithms(names.size(),
                                                       Duration::zero());
+          std::vector<AllocationMonitor::Result> localAllocationsAlgorithms(
+              names.size());
+
+          // Event store which is reused for all events of the range
+          auto eventStoreLogger = [&](std::size_t event) {
+            return Acts::getDefaultLogger(
+                "EventStore#" + std::to_string(event), m_cfg.logLevel);
+          };
+          WhiteBoard eventStore(eventStoreLogger(r.begin()),
+                                m_whiteboardObjectAliases);
 
           for (std::size_t event = r.begin(); event != r.end(); ++event) {
             ACTS_DEBUG("start processing event " << event);
             m_cfg.iterationCallback();
-            // Use per-event store
-            WhiteBoard eventStore(
-                Acts::getDefaultLogger("EventStore#" + std::to_string(event),
-                                       m_cfg.logLevel),
-                m_whiteboardObjectAliases);
-            // If we ever wanted to run algorithms in parallel, this needs to
-            // be changed to Algorithm context copies
+            // the event store only logs at the verbose level, so it is only
+            // renamed if its messages are printed
+            if (event != r.begin() &&
+                m_cfg.logLevel <= Acts::Logging::VERBOSE) {
+              eventStore.setLogger(eventStoreLogger(event));
+            }
             AlgorithmContext context(0, event, eventStore);
             std::size_t ialgo = 0;
 
             /// Decorate the context
             for (auto& cdr : m_decorators) {
+              AllocationScope as(m_cfg.trackAllocations,
+                                 localAllocationsAlgorithms[ialgo]);
               StopWatch sw(localClocksAlgorithms[ialgo++]);
               ACTS_VERBOSE("Execute context decorator: " << cdr->name());
               if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
@@ -488,16 +617,26 @@ int Sequencer::run() {
 
             ACTS_VERBOSE("Execute sequence elements");
 
-            for (auto& [alg, fpe] : m_sequenceElements) {
+            // Every element runs on its own copy of the context, so that
+            // independent elements can be executed concurrently
+            auto execute = [&](std::size_t ielement) {
+              auto& [alg, fpe] = m_sequenceElements[ielement];
+              AlgorithmContext elementContext = context;
+              elementContext.algorithmNumber += ielement + 1;
+              const std::size_t ialgoElement = ialgo + ielement;
+
               std::optional<Acts::FpeMonitor> mon;
               if (m_cfg.trackFpes) {
                 mon.emplace();
-                context.fpeMonitor = &mon.value();
+                elementContext.fpeMonitor = &mon.value();
               }
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
+              AllocationScope as(m_cfg.trackAllocations,
+                                 localAllocationsAlgorithms[ialgoElement]);
+              StopWatch sw(localClocksAlgorithms[ialgoElement]);
               ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": "
                                       << alg->name());
-              if (alg->internalExecute(++context) != ProcessCode::SUCCESS) {
+              if (alg->internalExecute(elementContext) !=
+                  ProcessCode::SUCCESS) {
                 ACTS_FATAL("Failed to execute " << getAlgorithmType(*alg)
                                                 << ": " << alg->name());
                 throw std::runtime_error("Failed to process event data");
@@ -533,9 +672,43 @@ int Sequencer::run() {
 
                 local.merge(mon->result());
               }
-              context.fpeMonitor = nullptr;
+            };
+
+            if (m_cfg.concurrentAlgorithms) {
+              // Start every element as soon as all elements it reads data
+              // from have finished
+              std::vector<std::atomic<std::size_t>> pending(
+                  m_sequenceElements.size());
+              for (std::size_t i = 0; i < pending.size(); ++i) {
+                pending[i] = dependencies[i].size();
+              }
+              tbbWrap::task_group group;
+              std::function<void(std::size_t)> schedule =
+                  [&](std::size_t ielement) {
+                    group.run([&, ielement] {
+                      execute(ielement);
+                      for (std::size_t next : dependents[ielement]) {
+                        if (--pending[next] == 0) {
+                          schedule(next);
+                        }
+                      }
+                    });
+                  };
+              for (std::size_t i = 0; i < pending.size(); ++i) {
+                if (dependencies[i].empty()) {
+                  schedule(i);
+                }
+              }
+              group.wait();
+            } else {
+              for (std::size_t i = 0; i < m_sequenceElements.size(); ++i) {
+                execute(i);
+              }
             }
 
+            // release the event data before the next event
+            eventStore.clear();
+
             nProcessedEvents++;
             if (logger().level() <= Acts::Logging::DEBUG) {
               ACTS_DEBUG("finished event " << event);
@@ -552,6 +725,7 @@ int Sequencer::run() {
             tbbWrap::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
             for (std::size_t i = 0; i < clocksAlgorithms.size(); ++i) {
               clocksAlgorithms[i] += localClocksAlgorithms[i];
+              allocationsAlgorithms[i].merge(localAllocationsAlgorithms[i]);
             }
           }
         });
@@ -585,7 +759,8 @@ int Sequencer::run() {
 
   if (!m_cfg.outputDir.empty()) {
     storeTiming(names, clocksAlgorithms, numEvents,
-                joinPaths(m_cfg.outputDir, m_cfg.outputTimingFile));
+                joinPaths(m_cfg.outputDir, m_cfg.outputTimingFile),
+                m_cfg.trackAllocations ? &allocationsAlgorithms : nullptr);
   }
 
   if (m_nUnmaskedFpe > 0) {
@@ -10,6 +10,11 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 
 #include <Eigen/Core>
@@ -56,13 +61,200 @@ inline int levenshteinDistance(const std::string_view &a,
   return d(a.size(), b.size());
 }
 
+/// Process wide mapping of the object names to white board slots
+struct SlotRegistry {
+  std::mutex mutex;
+  std::unordered_map<std::string, std::size_t> slots;
+  // stable storage of the names, indexed by slot
+  std::deque<std::string> names;
+};
+
+SlotRegistry &slotRegistry() {
+  static SlotRegistry registry;
+  return registry;
+}
+
 }  // namespace
 
+ActsExamples::WhiteBoard::WhiteBoard(
+    std::unique_ptr<const Acts::Logger> logger,
+    const std::unordered_map<std::string, std::string> &objectAliases)
+    : m_logger(std::move(logger)) {
+  for (const auto &[object, alias] : objectAliases) {
+    m_aliasSlots.emplace_back(slot(object), slot(alias));
+  }
+  // allocate the slots of all names which are already registered, so that
+  // the white board usually does not have to grow later
+  if (std::size_t n = numSlots(); n > 0) {
+    ensureSlot(n - 1);
+  }
+}
+
+ActsExamples::WhiteBoard::~WhiteBoard() {
+  for (auto &chunk : m_chunks) {
+    delete[] chunk.load();
+  }
+}
+
+void ActsExamples::WhiteBoard::setLogger(
+    std::unique_ptr<const Acts::Logger> logger) {
+  m_logger = std::move(logger);
+}
+
+std::size_t ActsExamples::WhiteBoard::slot(const std::string &name) {
+  SlotRegistry &registry = slotRegistry();
+  std::lock_guard lock(registry.mutex);
+  auto [it, inserted] = registry.slots.try_emplace(name, registry.names.size());
+  if (inserted) {
+    registry.names.push_back(name);
+  }
+  return it->second;
+}
+
+std::optional<std::size_t> ActsExamples::WhiteBoard::findSlot(
+    const std::string &name) {
+  SlotRegistry &registry = slotRegistry();
+  std::lock_guard lock(registry.mutex);
+  if (auto it = registry.slots.find(name); it != registry.slots.end()) {
+    return it->second;
+  }
+  return std::nullopt;
+}
+
+std::string ActsExamples::WhiteBoard::slotName(std::size_t slot) {
+  SlotRegistry &registry = slotRegistry();
+  std::lock_guard lock(registry.mutex);
+  return registry.names.at(slot);
+}
+
+std::size_t ActsExamples::WhiteBoard::numSlots() {
+  SlotRegistry &registry = slotRegistry();
+  std::lock_guard lock(registry.mutex);
+  return registry.names.size();
+}
+
+std::pair<std::size_t, std::size_t> ActsExamples::WhiteBoard::chunkIndex(
+    std::size_t slot) {
+  // chunk c starts at slot s_firstChunkSize * (2^c - 1)
+  const std::size_t chunk = std::bit_width(slot / s_firstChunkSize + 1) - 1;
+  return {chunk, slot - s_firstChunkSize * ((std::size_t{1} << chunk) - 1)};
+}
+
+std::size_t ActsExamples::WhiteBoard::chunkSize(std::size_t chunk) {
+  return s_firstChunkSize << chunk;
+}
+
+ActsExamples::WhiteBoard::Slot &ActsExamples::WhiteBoard::ensureSlot(
+    std::size_t slot) {
+  const auto [chunk, index] = chunkIndex(slot);
+  if (chunk >= s_maxChunks) {
+    throw std::out_of_range("White board slot " + std::to_string(slot) +
+                            " is out of range");
+  }
+  // allocate all chunks up to the one of the slot, which makes the chunks
+  // of all registered names available in one go
+  for (std::size_t c = 0; c <= chunk; ++c) {
+    if (m_chunks[c].load(std::memory_order_acquire) != nullptr) {
+      continue;
+    }
+    // several threads may allocate the same chunk, only one of them wins
+    auto *chunkNew = new Slot[chunkSize(c)];
+    Slot *expected = nullptr;
+    if (!m_chunks[c].compare_exchange_strong(expected, chunkNew,
+                                             std::memory_order_acq_rel)) {
+      delete[] chunkNew;
+    }
+  }
+  return m_chunks[chunk].load(std::memory_order_acquire)[index];
+}
+
+ActsExamples::WhiteBoard::Slot *ActsExamples::WhiteBoard::findSlotStorage(
+    std::size_t slot) const {
+  const auto [chunk, index] = chunkIndex(slot);
+  if (chunk >= s_maxChunks) {
+    return nullptr;
+  }
+  Slot *chunkSlots = m_chunks[chunk].load(std::memory_order_acquire);
+  return chunkSlots != nullptr ? &chunkSlots[index] : nullptr;
+}
+
+void ActsExamples::WhiteBoard::store(std::size_t slot,
+                                     std::unique_ptr<const IHolder> holder,
+                                     const char *typeName) {
+  Slot &target = ensureSlot(slot);
+  const IHolder *object = holder.get();
+  const IHolder *expected = nullptr;
+  if (!target.object.compare_exchange_strong(expected, object,
+                                             std::memory_order_acq_rel)) {
+    throw std::invalid_argument("Object '" + slotName(slot) +
+                                "' already exists");
+  }
+  target.owned = std::move(holder);
+  ACTS_VERBOSE("Added object '" << slotName(slot) << "' of type " << typeName);
+
+  for (const auto &[objectSlot, aliasSlot] : m_aliasSlots) {
+    if (objectSlot == slot) {
+      ensureSlot(aliasSlot).object.store(object, std::memory_order_release);
+      ACTS_VERBOSE("Added alias object '" << slotName(aliasSlot) << "'");
+    }
+  }
+}
+
+const ActsExamples::WhiteBoard::IHolder *ActsExamples::WhiteBoard::find(
+    std::size_t slot) const {
+  const Slot *storage = findSlotStorage(slot);
+  if (storage == nullptr) {
+    return nullptr;
+  }
+  return storage->object.load(std::memory_order_acquire);
+}
+
+bool ActsExamples::WhiteBoard::exists(const std::string &name) const {
+  // TODO remove this function?
+  std::optional<std::size_t> slot = findSlot(name);
+  return slot.has_value() && find(*slot) != nullptr;
+}
+
+void ActsExamples::WhiteBoard::clear() {
+  // aliases point to objects owned by other slots, so all pointers are reset
+  // before any object is destroyed
+  for (std::size_t c = 0; c < s_maxChunks; ++c) {
+    if (Slot *chunk = m_chunks[c].load(); chunk != nullptr) {
+      for (std::size_t i = 0; i < chunkSize(c); ++i) {
+        chunk[i].object = nullptr;
+      }
+    }
+  }
+  for (std::size_t c = 0; c < s_maxChunks; ++c) {
+    if (Slot *chunk = m_chunks[c].load(); chunk != nullptr) {
+      for (std::size_t i = 0; i < chunkSize(c); ++i) {
+        chunk[i].owned.reset();
+      }
+    }
+  }
+  // pick up names which were registered in the meantime
+  if (std::size_t n = numSlots(); n > 0) {
+    ensureSlot(n - 1);
+  }
+}
+
 std::vector<std::string_view> ActsExamples::WhiteBoard::similarNames(
     const std::string_view &name, int distThreshold,
     std::size_t maxNumber) const {
+  // the registry is append-only, so the names stay valid
+  std::vector<std::string_view> stored;
+  {
+    SlotRegistry &registry = slotRegistry();
+    std::lock_guard lock(registry.mutex);
+    for (std::size_t i = 0; i < registry.names.size(); ++i) {
+      if (find(i) != nullptr) {
+        stored.emplace_back(registry.names[i]);
+      }
+    }
+  }
+
   std::vector<std::pair<int, std::string_view>> names;
-  for (const auto &[n, h] : m_store) {
+  for (const auto &n : stored) {
     if (const auto d = levenshteinDistance(n, name); d < distThreshold) {
       names.push_back({d, n});
     }
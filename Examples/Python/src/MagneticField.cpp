@@ -15,6 +15,7 @@
 #include "Acts/MagneticField/NullBField.hpp"
 #include "Acts/MagneticField/SolenoidBField.hpp"
 #include "Acts/Plugins/Python/Utilities.hpp"
+#include "ActsExamples/MagneticField/FieldMapBinaryIo.hpp"
 #include "ActsExamples/MagneticField/FieldMapRootIo.hpp"
 #include "ActsExamples/MagneticField/FieldMapTextIo.hpp"
 
@@ -82,6 +83,29 @@ void addMagneticField(Context& ctx) {
              std::shared_ptr<ActsExamples::detail::InterpolatedMagneticField3>>(
       mex, "InterpolatedMagneticField3");
 
+  py::class_<ActsExamples::detail::MappedMagneticField2,
+             Acts::InterpolatedMagneticField, Acts::MagneticFieldProvider,
+             std::shared_ptr<ActsExamples::detail::MappedMagneticField2>>(
+      mex, "MappedMagneticField2");
+
+  py::class_<ActsExamples::detail::MappedMagneticField3,
+             Acts::InterpolatedMagneticField, Acts::MagneticFieldProvider,
+             std::shared_ptr<ActsExamples::detail::MappedMagneticField3>>(
+      mex, "MappedMagneticField3");
+
+  mex.def("writeMagneticFieldMapBinary",
+          py::overload_cast<
+              const std::string&,
+              const ActsExamples::detail::InterpolatedMagneticField2&>(
+              &ActsExamples::writeMagneticFieldMapBinary),
+          py::arg("file"), py::arg("field"));
+  mex.def("writeMagneticFieldMapBinary",
+          py::overload_cast<
+              const std::string&,
+              const ActsExamples::detail::InterpolatedMagneticField3&>(
+              &ActsExamples::writeMagneticFieldMapBinary),
+          py::arg("file"), py::arg("field"));
+
   py::class_<Acts::NullBField, Acts::MagneticFieldProvider,
              std::shared_ptr<Acts::NullBField>>(m, "NullBField")
       .def(py::init<>());
@@ -112,7 +136,8 @@ void addMagneticField(Context& ctx) {
   mex.def(
       "MagneticFieldMapXyz",
       [](const std::string& filename, const std::string& tree,
-         double lengthUnit, double BFieldUnit, bool firstOctant) {
+         double lengthUnit, double BFieldUnit, bool firstOctant)
+          -> std::shared_ptr<Acts::InterpolatedMagneticField> {
         const std::filesystem::path file = filename;
 
         auto mapBins = [](std::array<std::size_t, 3> bins,
@@ -133,6 +158,12 @@ void addMagneticField(Context& ctx) {
               firstOctant);
           return std::make_shared<
               ActsExamples::detail::InterpolatedMagneticField3>(std::move(map));
+        } else if (file.extension() == ".bin") {
+          // binary maps are stored in internal units, the units are ignored
+          auto map =
+              ActsExamples::makeMagneticFieldMapXyzFromBinary(file.native());
+          return std::make_shared<
+              ActsExamples::detail::MappedMagneticField3>(std::move(map));
         } else {
           throw std::runtime_error("Unsupported magnetic field map file type");
         }
@@ -145,7 +176,8 @@ void addMagneticField(Context& ctx) {
   mex.def(
       "MagneticFieldMapRz",
       [](const std::string& filename, const std::string& tree,
-         double lengthUnit, double BFieldUnit, bool firstQuadrant) {
+         double lengthUnit, double BFieldUnit, bool firstQuadrant)
+          -> std::shared_ptr<Acts::InterpolatedMagneticField> {
         const std::filesystem::path file = filename;
 
         auto mapBins = [](std::array<std::size_t, 2> bins,
@@ -165,6 +197,12 @@ void addMagneticField(Context& ctx) {
               firstQuadrant);
           return std::make_shared<
               ActsExamples::detail::InterpolatedMagneticField2>(std::move(map));
+        } else if (file.extension() == ".bin") {
+          // binary maps are stored in internal units, the units are ignored
+          auto map =
+              ActsExamples::makeMagneticFieldMapRzFromBinary(file.native());
+          return std::make_shared<
+              ActsExamples::detail::MappedMagneticField2>(std::move(map));
         } else {
           throw std::runtime_error("Unsupported magnetic field map file type");
         }
@@ -13,6 +13,7 @@
 #include "Acts/Propagator/AtlasStepper.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/PropagationProfiler.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Propagator/SympyStepper.hpp"
@@ -26,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -87,6 +89,10 @@ void addPropagation(Context& ctx) {
     ACTS_PYTHON_MEMBER(resolvePassive);
     ACTS_PYTHON_MEMBER(resolveSensitive);
     ACTS_PYTHON_MEMBER(trackingGeometry);
+    ACTS_PYTHON_MEMBER(cacheCandidates);
+    ACTS_PYTHON_MEMBER(candidateCachePositionBinSize);
+    ACTS_PYTHON_MEMBER(candidateCacheEtaBinSize);
+    ACTS_PYTHON_MEMBER(candidateCachePhiBinSize);
     ACTS_PYTHON_STRUCT_END();
   }
 
@@ -113,12 +119,23 @@ void addPropagation(Context& ctx) {
     ACTS_PYTHON_STRUCT_END();
   }
 
+  py::class_<Acts::PropagationProfile,
+             std::shared_ptr<Acts::PropagationProfile>>(m, "PropagationProfile")
+      .def(py::init<>())
+      .def("propagations", &Acts::PropagationProfile::propagations)
+      .def("clear", &Acts::PropagationProfile::clear)
+      .def("__str__", [](const Acts::PropagationProfile& profile) {
+        std::stringstream ss;
+        ss << profile;
+        return ss.str();
+      });
+
   ACTS_PYTHON_DECLARE_ALGORITHM(
       ActsExamples::PropagationAlgorithm, mex, "PropagationAlgorithm",
       propagatorImpl, sterileLogger, debugOutput, energyLoss,
       multipleScattering, recordMaterialInteractions, ptLoopers, maxStepSize,
-      covarianceTransport, inputTrackParameters, outputSummaryCollection,
-      outputMaterialCollection);
+      covarianceTransport, stepProfile, inputTrackParameters,
+      outputSummaryCollection, outputMaterialCollection);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::SimHitToSummaryConversion, mex,
                                 "SimHitToSummaryConversion", inputSimHits,
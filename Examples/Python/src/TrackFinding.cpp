@@ -264,7 +264,7 @@ void addTrackFinding(Context& ctx) {
       ActsExamples::SeedingAlgorithm, mex, "SeedingAlgorithm", inputSpacePoints,
       outputSeeds, seedFilterConfig, seedFinderConfig, seedFinderOptions,
       gridConfig, gridOptions, allowSeparateRMax, zBinNeighborsTop,
-      zBinNeighborsBottom, numPhiNeighbors, useExtraCuts);
+      zBinNeighborsBottom, numPhiNeighbors, useExtraCuts, numGroupsPerTask);
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::SeedingOrthogonalAlgorithm, mex,
                                 "SeedingOrthogonalAlgorithm", inputSpacePoints,
@@ -342,6 +342,11 @@ void addTrackFinding(Context& ctx) {
     ACTS_PYTHON_MEMBER(maxPixelHoles);
     ACTS_PYTHON_MEMBER(maxStripHoles);
     ACTS_PYTHON_MEMBER(trimTracks);
+    ACTS_PYTHON_MEMBER(breadthFirst);
+    ACTS_PYTHON_MEMBER(beamWidth);
+    ACTS_PYTHON_MEMBER(maxBranchChi2Difference);
+    ACTS_PYTHON_MEMBER(numSeedsPerTask);
+    ACTS_PYTHON_MEMBER(packMeasurements);
     ACTS_PYTHON_MEMBER(constrainToVolumeIds);
     ACTS_PYTHON_MEMBER(endOfWorldVolumeIds);
     ACTS_PYTHON_STRUCT_END();
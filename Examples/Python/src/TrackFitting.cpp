@@ -105,13 +105,28 @@ void addTrackFitting(Context& ctx) {
         .value("weightCut", MixtureReductionAlgorithm::weightCut)
         .value("KLDistance", MixtureReductionAlgorithm::KLDistance);
 
-    py::class_<ActsExamples::BetheHeitlerApprox>(mex, "AtlasBetheHeitlerApprox")
-        .def_static("loadFromFiles",
-                    &ActsExamples::BetheHeitlerApprox::loadFromFiles,
-                    py::arg("lowParametersPath"), py::arg("highParametersPath"),
-                    py::arg("lowLimit") = 0.1, py::arg("highLimit") = 0.2)
+    py::enum_<ActsExamples::GsfMultiStepper>(mex, "GsfMultiStepper")
+        .value("loop", ActsExamples::GsfMultiStepper::loop)
+        .value("simd", ActsExamples::GsfMultiStepper::simd);
+
+    py::class_<ActsExamples::BetheHeitlerApprox> bha(mex,
+                                                     "AtlasBetheHeitlerApprox");
+    bha.def_static("loadFromFiles",
+                   &ActsExamples::BetheHeitlerApprox::loadFromFiles,
+                   py::arg("lowParametersPath"), py::arg("highParametersPath"),
+                   py::arg("lowLimit") = 0.1, py::arg("highLimit") = 0.2)
         .def_static("makeDefault",
                     []() { return Acts::makeDefaultBetheHeitlerApprox(); });
+
+    // the enum has to be known before it is used as default argument
+    using Interpolation = ActsExamples::BetheHeitlerApprox::Interpolation;
+    py::enum_<Interpolation>(bha, "Interpolation")
+        .value("Linear", Interpolation::Linear)
+        .value("Cubic", Interpolation::Cubic);
+
+    bha.def("tabulate", &ActsExamples::BetheHeitlerApprox::tabulate,
+            py::arg("nPoints"),
+            py::arg("interpolation") = Interpolation::Linear);
     mex.def(
         "makeGsfFitterFunction",
         [](std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry,
@@ -119,17 +134,18 @@ void addTrackFitting(Context& ctx) {
            BetheHeitlerApprox betheHeitlerApprox, std::size_t maxComponents,
            double weightCutoff, Acts::ComponentMergeMethod componentMergeMethod,
            ActsExamples::MixtureReductionAlgorithm mixtureReductionAlgorithm,
-           Logging::Level level) {
+           Logging::Level level, ActsExamples::GsfMultiStepper multiStepper) {
           return ActsExamples::makeGsfFitterFunction(
               trackingGeometry, magneticField, betheHeitlerApprox,
               maxComponents, weightCutoff, componentMergeMethod,
               mixtureReductionAlgorithm,
-              *Acts::getDefaultLogger("GSFFunc", level));
+              *Acts::getDefaultLogger("GSFFunc", level), multiStepper);
         },
         py::arg("trackingGeometry"), py::arg("magneticField"),
         py::arg("betheHeitlerApprox"), py::arg("maxComponents"),
         py::arg("weightCutoff"), py::arg("componentMergeMethod"),
-        py::arg("mixtureReductionAlgorithm"), py::arg("level"));
+        py::arg("mixtureReductionAlgorithm"), py::arg("level"),
+        py::arg("multiStepper") = ActsExamples::GsfMultiStepper::loop);
 
     mex.def(
         "makeGlobalChiSquareFitterFunction",
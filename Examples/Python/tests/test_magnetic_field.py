@@ -72,3 +72,53 @@ def test_solenoid(conf_const):
     )
 
     assert isinstance(field, acts.examples.InterpolatedMagneticField2)
+
+
+def test_binary_field_map(tmp_path):
+    solenoid = acts.SolenoidBField(
+        radius=1200 * u.mm,
+        length=6000 * u.mm,
+        bMagCenter=2 * u.T,
+        nCoils=1194,
+    )
+
+    field = acts.solenoidFieldMap(
+        rlim=(0, 1200 * u.mm),
+        zlim=(-5000 * u.mm, 5000 * u.mm),
+        nbins=(10, 10),
+        field=solenoid,
+    )
+
+    file = tmp_path / "solenoid.bin"
+    acts.examples.writeMagneticFieldMapBinary(str(file), field)
+    assert file.exists()
+
+    mapped = acts.examples.MagneticFieldMapRz(str(file))
+    assert isinstance(mapped, acts.examples.MappedMagneticField2)
+
+    ct = acts.MagneticFieldContext()
+    fc = field.makeCache(ct)
+    mfc = mapped.makeCache(ct)
+
+    for i in range(100):
+        x = random.uniform(-1000.0, 1000.0)
+        y = random.uniform(-1000.0, 1000.0)
+        z = random.uniform(-4000.0, 4000.0)
+
+        pos = acts.Vector3(x, y, z)
+        rv = field.getField(pos, fc)
+        mrv = mapped.getField(pos, mfc)
+
+        for j in range(3):
+            assert mrv[j] == pytest.approx(rv[j])
+
+    with pytest.raises(RuntimeError):
+        acts.examples.MagneticFieldMapXyz(str(file))
+
+    # the byte order mark follows the magic string and the version
+    data = bytearray(file.read_bytes())
+    data[12:16] = bytes(reversed(data[12:16]))
+    swapped = tmp_path / "swapped.bin"
+    swapped.write_bytes(data)
+    with pytest.raises(RuntimeError):
+        acts.examples.MagneticFieldMapRz(str(swapped))
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+import argparse
+from pathlib import Path
+
+import acts
+import acts.examples
+
+u = acts.UnitConstants
+
+
+def convertToBinary(
+    inputFile: Path,
+    outputFile: Path,
+    gridType: str = "rz",
+    tree: str = "bField",
+    lengthUnit: float = u.mm,
+    BFieldUnit: float = u.T,
+    symmetric: bool = False,
+):
+    """Convert a ROOT or text field map to the memory mapped binary format"""
+    if gridType == "rz":
+        field = acts.examples.MagneticFieldMapRz(
+            str(inputFile),
+            tree=tree,
+            lengthUnit=lengthUnit,
+            BFieldUnit=BFieldUnit,
+            firstQuadrant=symmetric,
+        )
+    elif gridType == "xyz":
+        field = acts.examples.MagneticFieldMapXyz(
+            str(inputFile),
+            tree=tree,
+            lengthUnit=lengthUnit,
+            BFieldUnit=BFieldUnit,
+            firstOctant=symmetric,
+        )
+    else:
+        raise ValueError(f"Unknown grid type {gridType}")
+
+    acts.examples.writeMagneticFieldMapBinary(str(outputFile), field)
+    return field
+
+
+if "__main__" == __name__:
+    p = argparse.ArgumentParser(
+        description="Convert a field map to the memory mapped binary format"
+    )
+    p.add_argument("input", type=Path, help="Input field map (.root, .txt, .csv)")
+    p.add_argument("output", type=Path, help="Output binary field map (.bin)")
+    p.add_argument("--grid", choices=["rz", "xyz"], default="rz")
+    p.add_argument("--tree", default="bField", help="Tree name for ROOT input")
+    p.add_argument(
+        "--symmetric",
+        action="store_true",
+        help="Input only covers the first quadrant / octant",
+    )
+    args = p.parse_args()
+
+    convertToBinary(
+        args.input, args.output, args.grid, tree=args.tree, symmetric=args.symmetric
+    )
@@ -0,0 +1,43 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Count all heap allocations of the executable by replacing the global
+// allocation functions
+
+namespace {
+std::atomic<std::size_t> nAllocations{0};
+std::atomic<std::size_t> nAllocatedBytes{0};
+}  // namespace
+
+Acts::Test::AllocationCount Acts::Test::allocationCount() {
+  return {nAllocations.load(std::memory_order_relaxed),
+          nAllocatedBytes.load(std::memory_order_relaxed)};
+}
+
+void* operator new(std::size_t size) {
+  nAllocations.fetch_add(1, std::memory_order_relaxed);
+  nAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
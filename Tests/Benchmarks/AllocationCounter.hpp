@@ -0,0 +1,29 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+
+namespace Acts::Test {
+
+/// Heap allocations of this process so far
+struct AllocationCount {
+  std::size_t allocations = 0;
+  std::size_t bytes = 0;
+
+  AllocationCount operator-(const AllocationCount& other) const {
+    return {allocations - other.allocations, bytes - other.bytes};
+  }
+};
+
+/// @return the number of allocations and allocated bytes so far, counted by
+///         the global allocation functions replaced in AllocationCounter.cpp
+AllocationCount allocationCount();
+
+}  // namespace Acts::Test
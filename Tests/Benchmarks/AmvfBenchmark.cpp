@@ -0,0 +1,234 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/AnnealingUtility.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
+#include "Acts/Vertexing/GaussianTrackDensity.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/TrackAtVertex.hpp"
+#include "Acts/Vertexing/TrackDensityVertexFinder.hpp"
+#include "Acts/Vertexing/Vertex.hpp"
+#include "Acts/Vertexing/VertexingOptions.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+using Stepper = EigenStepper<>;
+using Linearizer = HelicalTrackLinearizer;
+
+const double bz = 2_T;
+
+// Resolutions of the perigee parameters
+const double resD0 = 30_um;
+const double resZ0 = 50_um;
+const double resPhi = 1e-3;
+const double resTheta = 1e-3;
+const double resQOverP = 1e-2 / 1_GeV;
+const double resTime = 1_ns;
+
+/// A pileup event with @p mu vertices along the beam line and
+/// @p nTracksPerVertex tracks from each of them, expressed at the origin
+std::vector<BoundTrackParameters> makeEvent(unsigned int mu,
+                                            unsigned int nTracksPerVertex,
+                                            unsigned int seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<double> gauss(0, 1);
+  std::uniform_real_distribution<double> phiDist(-std::numbers::pi,
+                                                 std::numbers::pi);
+  std::uniform_real_distribution<double> etaDist(-2.5, 2.5);
+  std::exponential_distribution<double> ptDist(1 / 1_GeV);
+  std::bernoulli_distribution chargeDist(0.5);
+
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+
+  BoundSquareMatrix cov = BoundSquareMatrix::Zero();
+  cov(eBoundLoc0, eBoundLoc0) = resD0 * resD0;
+  cov(eBoundLoc1, eBoundLoc1) = resZ0 * resZ0;
+  cov(eBoundPhi, eBoundPhi) = resPhi * resPhi;
+  cov(eBoundTheta, eBoundTheta) = resTheta * resTheta;
+  cov(eBoundQOverP, eBoundQOverP) = resQOverP * resQOverP;
+  cov(eBoundTime, eBoundTime) = resTime * resTime;
+
+  std::vector<BoundTrackParameters> tracks;
+  tracks.reserve(mu * nTracksPerVertex);
+  for (unsigned int iVtx = 0; iVtx < mu; ++iVtx) {
+    const Vector3 vtxPos(10_um * gauss(rng), 10_um * gauss(rng),
+                         50_mm * gauss(rng));
+    for (unsigned int iTrk = 0; iTrk < nTracksPerVertex; ++iTrk) {
+      const double phi = phiDist(rng);
+      const double theta = 2 * std::atan(std::exp(-etaDist(rng)));
+      const double pt = 400_MeV + ptDist(rng);
+      const double charge = chargeDist(rng) ? 1 : -1;
+
+      // The transverse displacement of the vertex is small enough to treat
+      // the track as straight between the vertex and the perigee
+      BoundVector params;
+      params[eBoundLoc0] = -vtxPos.x() * std::sin(phi) +
+                           vtxPos.y() * std::cos(phi) + resD0 * gauss(rng);
+      params[eBoundLoc1] = vtxPos.z() + resZ0 * gauss(rng);
+      params[eBoundPhi] = phi + resPhi * gauss(rng);
+      params[eBoundTheta] = theta + resTheta * gauss(rng);
+      params[eBoundQOverP] =
+          charge * std::sin(theta) / pt + resQOverP * gauss(rng);
+      params[eBoundTime] = 0;
+
+      tracks.emplace_back(perigee, params, cov, ParticleHypothesis::pion());
+    }
+  }
+  return tracks;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Logging::INFO;
+  unsigned int minMu = 0;
+  unsigned int maxMu = 0;
+  unsigned int muStep = 0;
+  unsigned int nTracksPerVertex = 0;
+  unsigned int nRuns = 0;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("min-mu", po::value<unsigned int>(&minMu)->default_value(60), "smallest number of pileup vertices")
+      ("max-mu", po::value<unsigned int>(&maxMu)->default_value(200), "largest number of pileup vertices")
+      ("mu-step", po::value<unsigned int>(&muStep)->default_value(20), "step of the number of pileup vertices")
+      ("tracks-per-vertex", po::value<unsigned int>(&nTracksPerVertex)->default_value(10), "number of tracks per vertex")
+      ("runs", po::value<unsigned int>(&nRuns)->default_value(3), "number of benchmark runs")
+      ("verbose", po::value<unsigned int>(&lvl)->default_value(Logging::INFO), "logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.contains("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+    if (minMu == 0 || muStep == 0) {
+      std::cerr << "error: the pileup and its step have to be positive"
+                << std::endl;
+      return 1;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("AMVF", Logging::Level(lvl)));
+
+  GeometryContext geoContext;
+  MagneticFieldContext magFieldContext;
+
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, bz));
+  auto propagator = std::make_shared<Propagator<Stepper>>(Stepper(bField));
+
+  ImpactPointEstimator::Config ipEstimatorCfg(bField, propagator);
+  ImpactPointEstimator ipEstimator(ipEstimatorCfg);
+
+  AnnealingUtility::Config annealingConfig;
+  annealingConfig.setOfTemperatures = {8.0, 4.0, 2.0, 1.4142136, 1.2247449,
+                                       1.0};
+  AnnealingUtility annealingUtility(annealingConfig);
+
+  Linearizer::Config ltConfig;
+  ltConfig.bField = bField;
+  ltConfig.propagator = propagator;
+  Linearizer linearizer(ltConfig);
+
+  AdaptiveMultiVertexFitter::Config fitterCfg(ipEstimator);
+  fitterCfg.annealingTool = annealingUtility;
+  fitterCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  fitterCfg.trackLinearizer.connect<&Linearizer::linearizeTrack>(&linearizer);
+  AdaptiveMultiVertexFitter fitter(fitterCfg);
+
+  GaussianTrackDensity::Config densityCfg;
+  densityCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  auto seedFinder = std::make_shared<TrackDensityVertexFinder>(
+      TrackDensityVertexFinder::Config{densityCfg});
+
+  AdaptiveMultiVertexFinder::Config finderCfg(std::move(fitter), seedFinder,
+                                              ipEstimator, bField);
+  finderCfg.extractParameters.connect<&InputTrack::extractParameters>();
+  // Allow to find all vertices of the largest pileup
+  finderCfg.maxIterations = 1000;
+  AdaptiveMultiVertexFinder finder(std::move(finderCfg));
+
+  // Beam spot constraint
+  Vertex beamSpot;
+  SquareMatrix4 beamSpotCov = SquareMatrix4::Zero();
+  beamSpotCov(eX, eX) = 15_um * 15_um;
+  beamSpotCov(eY, eY) = 15_um * 15_um;
+  beamSpotCov(eZ, eZ) = 50_mm * 50_mm;
+  beamSpotCov(eTime, eTime) = 1_ns * 1_ns;
+  beamSpot.setFullCovariance(beamSpotCov);
+  VertexingOptions vertexingOptions(geoContext, magFieldContext, beamSpot);
+
+  for (unsigned int mu = minMu; mu <= maxMu; mu += muStep) {
+    const std::vector<BoundTrackParameters> tracks =
+        makeEvent(mu, nTracksPerVertex, mu);
+    std::vector<InputTrack> inputTracks;
+    for (const auto& trk : tracks) {
+      inputTracks.emplace_back(&trk);
+    }
+
+    std::size_t nVertices = 0;
+    const auto result = Test::microBenchmark(
+        [&] {
+          IVertexFinder::State state = finder.makeState(magFieldContext);
+          auto vertices = finder.find(inputTracks, vertexingOptions, state);
+          nVertices = vertices.ok() ? vertices->size() : 0;
+          return nVertices;
+        },
+        1, nRuns, std::chrono::milliseconds(0));
+
+    ACTS_INFO("mu " << mu << ", " << inputTracks.size() << " tracks, "
+                    << nVertices << " vertices: " << result);
+    if (logger().doPrint(Logging::DEBUG)) {
+      IVertexFinder::State state = finder.makeState(magFieldContext);
+      auto vertices = finder.find(inputTracks, vertexingOptions, state);
+      for (const auto& vtx : *vertices) {
+        ACTS_DEBUG("vertex at " << vtx.fullPosition().transpose() << " with "
+                                << vtx.tracks().size() << " tracks");
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+// Compares the propagation of many tracks one after the other with the
+// propagation of bundles of tracks, whose Runge-Kutta steps the EigenStepper
+// performs together in SIMD lanes
+int main(int argc, char* argv[]) {
+  std::size_t nTracks = 256;
+  std::size_t nRuns = 20;
+  if (argc >= 2) {
+    nTracks = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nRuns = std::stoi(argv[2]);
+  }
+
+  GeometryContext geoCtx;
+  MagneticFieldContext magCtx;
+
+  // tracks from the origin into the barrel, with momenta from 0.5 to 10 GeV
+  std::mt19937 rng(4242);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> thetaDist(M_PI / 4, 3 * M_PI / 4);
+  std::uniform_real_distribution<double> pDist(0.5_GeV, 10_GeV);
+  BoundSquareMatrix cov = BoundSquareMatrix::Identity();
+  std::vector<CurvilinearTrackParameters> starts;
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    const double q = (i % 2 == 0) ? 1 : -1;
+    starts.emplace_back(Vector4::Zero(), phiDist(rng), thetaDist(rng),
+                        q / pDist(rng), cov, ParticleHypothesis::pion());
+  }
+
+  const double length = 5.8_m;
+  const double radius = 1.25_m;
+  SolenoidBField solenoid({radius, length, 1154, 2_T});
+  auto fieldMap = std::make_shared<
+      decltype(solenoidFieldMap({0, 2 * radius}, {-length, length}, {150, 200},
+                                solenoid))>(solenoidFieldMap(
+      {0, 2 * radius}, {-length, length}, {150, 200}, solenoid));
+
+  auto run = [&](const std::string& fieldName,
+                 std::shared_ptr<const MagneticFieldProvider> bField,
+                 bool withCov) {
+    using Stepper = EigenStepper<>;
+    using BenchmarkPropagator = Propagator<Stepper>;
+    BenchmarkPropagator propagator(Stepper(std::move(bField)));
+
+    BenchmarkPropagator::Options<> options(geoCtx, magCtx);
+    options.pathLimit = 1_m;
+    options.maxSteps = 10000;
+
+    std::vector<CurvilinearTrackParameters> tracks = starts;
+    if (!withCov) {
+      for (auto& track : tracks) {
+        track = CurvilinearTrackParameters(
+            track.fourPosition(geoCtx), track.direction(), track.qOverP(),
+            std::nullopt, track.particleHypothesis());
+      }
+    }
+
+    std::cout << fieldName << (withCov ? " with" : " without")
+              << " covariance transport" << std::endl;
+
+    std::cout << "  one after the other: " << std::flush;
+    const auto serial = Acts::Test::microBenchmark(
+        [&] {
+          std::size_t nSteps = 0;
+          for (const auto& track : tracks) {
+            nSteps += propagator.propagate(track, options).value().steps;
+          }
+          return nSteps;
+        },
+        1, nRuns);
+    std::cout << serial << std::endl;
+
+    for (std::size_t bundleSize : {4u, 16u, 64u}) {
+      std::vector<std::vector<CurvilinearTrackParameters>> bundles;
+      for (std::size_t i = 0; i < tracks.size(); i += bundleSize) {
+        const std::size_t end = std::min(i + bundleSize, tracks.size());
+        bundles.emplace_back(tracks.begin() + i, tracks.begin() + end);
+      }
+
+      std::cout << "  bundles of " << bundleSize << ": " << std::flush;
+      const auto batched = Acts::Test::microBenchmark(
+          [&] {
+            std::size_t nSteps = 0;
+            for (const auto& bundle : bundles) {
+              for (const auto& result :
+                   propagator.propagateBatch(bundle, options)) {
+                nSteps += result.value().steps;
+              }
+            }
+            return nSteps;
+          },
+          1, nRuns);
+      std::cout << batched << std::endl;
+      std::cout << "  speed-up: "
+                << serial.runTimeMedian().count() /
+                       batched.runTimeMedian().count()
+                << std::endl;
+    }
+  };
+
+  for (bool withCov : {false, true}) {
+    run("constant field", std::make_shared<ConstantBField>(Vector3(0, 0, 2_T)),
+        withCov);
+    run("solenoid field map", fieldMap, withCov);
+  }
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+
+// Compares the mixture of the default Bethe-Heitler approximation evaluated
+// from the polynomials with the interpolation of the tabulated mixture
+int main(int argc, char* argv[]) {
+  std::size_t nCalls = 10000;
+  std::size_t nRuns = 100;
+  std::size_t nPoints = 1000;
+  if (argc >= 2) {
+    nCalls = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nRuns = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    nPoints = std::stoi(argv[3]);
+  }
+
+  using Approx = AtlasBetheHeitlerApprox<6, 5>;
+
+  // the thickness of the material surfaces in terms of x/x0, in the ranges
+  // of the multi component parameterizations
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> xDist(0.002, 0.2);
+  std::vector<double> xs(nCalls);
+  for (auto& x : xs) {
+    x = xDist(rng);
+  }
+
+  auto run = [&](const std::string& name, const Approx& approx) {
+    std::cout << name << ": " << std::flush;
+    const auto result = Acts::Test::microBenchmark(
+        [&] {
+          double sum = 0;
+          for (double x : xs) {
+            for (const auto& cmp : approx.mixture(x)) {
+              sum += cmp.weight * cmp.mean;
+            }
+          }
+          return sum;
+        },
+        1, nRuns);
+    std::cout << result << std::endl;
+    std::cout << "  per mixture: " << result.runTimeMedian().count() / nCalls
+              << " ns" << std::endl;
+    return result;
+  };
+
+  const Approx polynomial = makeDefaultBetheHeitlerApprox();
+  const auto polynomialResult = run("polynomials", polynomial);
+
+  for (auto interpolation :
+       {Approx::Interpolation::Linear, Approx::Interpolation::Cubic}) {
+    Approx tabulated = polynomial;
+    tabulated.tabulate(nPoints, interpolation);
+    const auto tabulatedResult =
+        run(interpolation == Approx::Interpolation::Linear
+                ? "tabulated, linear"
+                : "tabulated, cubic",
+            tabulated);
+    std::cout << "  speed-up: "
+              << polynomialResult.runTimeMedian().count() /
+                     tabulatedResult.runTimeMedian().count()
+              << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,274 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/ContainerPool.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
+#include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Holders.hpp"
+
+#include "AllocationCounter.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::Test;
+using namespace Acts::detail::Test;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+using Tracks =
+    Acts::TrackContainer<VectorTrackContainer, VectorMultiTrajectory,
+                         std::shared_ptr>;
+using ConstTracks =
+    Acts::TrackContainer<ConstVectorTrackContainer,
+                         ConstVectorMultiTrajectory, std::shared_ptr>;
+using TrackStateBackend = VectorMultiTrajectory;
+
+using CkfPropagator = Acts::Propagator<EigenStepper<>, Navigator>;
+using CKF = CombinatorialKalmanFilter<CkfPropagator, Tracks>;
+
+using SourceLinkContainer =
+    std::unordered_multimap<GeometryIdentifier, TestSourceLink>;
+
+struct SourceLinkAccessor {
+  struct Iterator {
+    using BaseIterator = SourceLinkContainer::const_iterator;
+
+    using iterator_category = BaseIterator::iterator_category;
+    using value_type = BaseIterator::value_type;
+    using difference_type = BaseIterator::difference_type;
+    using pointer = BaseIterator::pointer;
+    using reference = BaseIterator::reference;
+
+    Iterator& operator++() {
+      ++m_iterator;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return m_iterator == other.m_iterator;
+    }
+
+    SourceLink operator*() const { return SourceLink{m_iterator->second}; }
+
+    BaseIterator m_iterator;
+  };
+
+  const SourceLinkContainer* container = nullptr;
+
+  std::pair<Iterator, Iterator> range(const Surface& surface) const {
+    auto [begin, end] = container->equal_range(surface.geometryId());
+    return {Iterator{begin}, Iterator{end}};
+  }
+};
+
+Navigator makeNavigator(std::shared_ptr<const TrackingGeometry> geometry) {
+  Navigator::Config cfg{std::move(geometry)};
+  cfg.resolvePassive = false;
+  cfg.resolveMaterial = true;
+  cfg.resolveSensitive = true;
+  return Navigator{cfg};
+}
+
+struct Summary {
+  std::size_t allocations = 0;
+  std::size_t bytes = 0;
+  double time = 0;
+  std::size_t trackStates = 0;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t nEvents = 1000;
+  std::size_t nTracks = 20;
+  if (argc >= 2) {
+    nEvents = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nTracks = std::stoi(argv[2]);
+  }
+
+  GeometryContext geoCtx;
+  MagneticFieldContext magCtx;
+  CalibrationContext calCtx;
+
+  CubicTrackingGeometry store(geoCtx);
+  auto geometry = store();
+
+  MeasurementResolution resPixel = {MeasurementType::eLoc01, {25_um, 50_um}};
+  MeasurementResolution resStrip0 = {MeasurementType::eLoc0, {100_um}};
+  MeasurementResolution resStrip1 = {MeasurementType::eLoc1, {150_um}};
+  MeasurementResolutionMap resolutions = {
+      {GeometryIdentifier().setVolume(2), resPixel},
+      {GeometryIdentifier().setVolume(3).setLayer(2), resStrip0},
+      {GeometryIdentifier().setVolume(3).setLayer(4), resStrip1},
+      {GeometryIdentifier().setVolume(3).setLayer(6), resStrip0},
+      {GeometryIdentifier().setVolume(3).setLayer(8), resStrip1},
+  };
+
+  // tracks along the x axis with small variations in position and direction
+  BoundVector stddev;
+  stddev[eBoundLoc0] = 100_um;
+  stddev[eBoundLoc1] = 100_um;
+  stddev[eBoundTime] = 25_ns;
+  stddev[eBoundPhi] = 2_degree;
+  stddev[eBoundTheta] = 2_degree;
+  stddev[eBoundQOverP] = 1 / 100_GeV;
+  BoundSquareMatrix cov = stddev.cwiseProduct(stddev).asDiagonal();
+
+  std::default_random_engine rng(421235);
+  std::uniform_real_distribution<double> posDist(-20_mm, 20_mm);
+  std::uniform_real_distribution<double> angleDist(-1_degree, 1_degree);
+
+  std::vector<CurvilinearTrackParameters> startParameters;
+  SourceLinkContainer sourceLinks;
+  Acts::Propagator<StraightLineStepper, Navigator> measPropagator(
+      StraightLineStepper{}, makeNavigator(geometry));
+  for (std::size_t trackId = 0; trackId < nTracks; ++trackId) {
+    Vector4 pos(-3_m, posDist(rng), posDist(rng), 0_ns);
+    double phi = angleDist(rng);
+    double theta = 90_degree + angleDist(rng);
+    startParameters.emplace_back(pos, phi, theta, 1_e / 1_GeV, cov,
+                                 ParticleHypothesis::pion());
+    auto measurements =
+        createMeasurements(measPropagator, geoCtx, magCtx,
+                           startParameters.back(), resolutions, rng, trackId);
+    for (auto& sl : measurements.sourceLinks) {
+      sourceLinks.emplace(sl.m_geometryId, std::move(sl));
+    }
+  }
+
+  auto field = std::make_shared<ConstantBField>(Vector3(0, 0, 0.5_T));
+  CKF ckf(CkfPropagator(EigenStepper<>(field), makeNavigator(geometry)));
+
+  GainMatrixUpdater updater;
+  MeasurementSelector::Config selectorCfg = {
+      {GeometryIdentifier(), {{}, {std::numeric_limits<double>::max()}, {1u}}},
+  };
+  MeasurementSelector selector{selectorCfg};
+
+  CombinatorialKalmanFilterExtensions<Tracks> extensions;
+  extensions.calibrator
+      .connect<&testSourceLinkCalibrator<TrackStateBackend>>();
+  extensions.updater
+      .connect<&GainMatrixUpdater::operator()<TrackStateBackend>>(&updater);
+  extensions.measurementSelector
+      .connect<&MeasurementSelector::select<TrackStateBackend>>(&selector);
+
+  SourceLinkAccessor slAccessor;
+  slAccessor.container = &sourceLinks;
+
+  CombinatorialKalmanFilterOptions<SourceLinkAccessor::Iterator,
+                                   Tracks>
+      options(geoCtx, magCtx, calCtx, {}, extensions,
+              PropagatorPlainOptions(geoCtx, magCtx));
+  options.sourceLinkAccessor.connect<&SourceLinkAccessor::range>(&slAccessor);
+
+  ContainerPool<VectorTrackContainer> trackPool;
+  ContainerPool<VectorMultiTrajectory> trackStatePool;
+
+  // One event: find all tracks into fresh or pooled containers and hand the
+  // read-only result to a consumer, like the examples track finding does.
+  auto runEvent = [&](bool pooled) {
+    auto trackContainer = pooled ? trackPool.acquire()
+                                 : std::make_shared<VectorTrackContainer>();
+    auto trackStateContainer =
+        pooled ? trackStatePool.acquire()
+               : std::make_shared<VectorMultiTrajectory>();
+
+    Tracks tracks(trackContainer, trackStateContainer);
+    for (const auto& start : startParameters) {
+      auto res = ckf.findTracks(start, options, tracks);
+      if (!res.ok()) {
+        std::cerr << "Track finding failed: " << res.error().message()
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+    }
+
+    std::size_t nStates = trackStateContainer->size();
+    if (pooled) {
+      ConstTracks constTracks{
+          ContainerPool<VectorTrackContainer>::makeConst<
+              ConstVectorTrackContainer>(std::move(trackContainer)),
+          ContainerPool<VectorMultiTrajectory>::makeConst<
+              ConstVectorMultiTrajectory>(std::move(trackStateContainer))};
+    } else {
+      ConstTracks constTracks{
+          std::make_shared<ConstVectorTrackContainer>(
+              std::move(*trackContainer)),
+          std::make_shared<ConstVectorMultiTrajectory>(
+              std::move(*trackStateContainer))};
+    }
+    return nStates;
+  };
+
+  auto measure = [&](bool pooled) {
+    // warm up, this fills the pool
+    runEvent(pooled);
+
+    Summary result;
+    const AllocationCount before = allocationCount();
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < nEvents; ++i) {
+      result.trackStates += runEvent(pooled);
+    }
+    auto stop = std::chrono::steady_clock::now();
+    const AllocationCount allocated = allocationCount() - before;
+    result.allocations = allocated.allocations;
+    result.bytes = allocated.bytes;
+    result.time = std::chrono::duration<double, std::micro>(stop - start)
+                      .count();
+    return result;
+  };
+
+  auto print = [&](const std::string& name, const Summary& r) {
+    std::cout << name << ": " << r.trackStates / nEvents
+              << " track states/event, " << r.allocations / nEvents
+              << " allocations/event, " << r.bytes / nEvents
+              << " bytes/event, " << r.time / nEvents << " us/event"
+              << std::endl;
+  };
+
+  std::cout << "Running CKF on " << nEvents << " events with " << nTracks
+            << " tracks each" << std::endl;
+  const auto fresh = measure(false);
+  print("fresh containers ", fresh);
+  const auto pooled = measure(true);
+  print("pooled containers", pooled);
+
+  return 0;
+}
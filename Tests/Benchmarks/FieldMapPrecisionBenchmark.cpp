@@ -0,0 +1,185 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+
+int main(int argc, char* argv[]) {
+  std::size_t iters_map = 5e2;
+  std::size_t n_precision = 1e5;
+  if (argc >= 2) {
+    iters_map = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    n_precision = std::stoi(argv[2]);
+  }
+
+  const double L = 5.8_m;
+  const double R = (2.56 + 2.46) * 0.5 * 0.5_m;
+  const std::size_t nCoils = 1154;
+  const double bMagCenter = 2_T;
+  const std::size_t nBinsR = 150;
+  const std::size_t nBinsZ = 200;
+
+  double rMin = -0.1;
+  double rMax = R * 2.;
+  double zMin = 2 * (-L / 2.);
+  double zMax = 2 * (L / 2.);
+
+  Acts::SolenoidBField bSolenoidField({R, L, nCoils, bMagCenter});
+  std::cout << "Building interpolated field maps" << std::endl;
+  auto bFieldMap = Acts::solenoidFieldMap({rMin, rMax}, {zMin, zMax},
+                                          {nBinsR, nBinsZ}, bSolenoidField);
+  auto bFieldMapFloat = Acts::singlePrecisionFieldMap(bFieldMap);
+  Acts::MagneticFieldContext mctx{};
+
+  std::minstd_rand rng;
+  std::uniform_real_distribution<double> zDist(1.5 * (-L / 2.), 1.5 * L / 2.);
+  std::uniform_real_distribution<double> rDist(0, R * 1.5);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  auto genPos = [&]() -> Acts::Vector3 {
+    const double z = zDist(rng), r = rDist(rng), phi = phiDist(rng);
+    return {r * std::cos(phi), r * std::sin(phi), z};
+  };
+
+  // Precision report: compare the single precision map to the double
+  // precision map, which isolates the storage error, and the double precision
+  // map to the analytical field, which shows the size of the interpolation
+  // error for reference.
+  {
+    std::cout << "Precision report (" << n_precision << " random positions)"
+              << std::endl;
+    double maxStorage = 0, sumStorage = 0;
+    double maxInterp = 0, sumInterp = 0;
+    for (std::size_t i = 0; i < n_precision; i++) {
+      const auto pos = genPos();
+      const Acts::Vector3 bDouble = bFieldMap.getField(pos).value();
+      const Acts::Vector3 bFloat = bFieldMapFloat.getField(pos).value();
+      const Acts::Vector3 bTrue = bSolenoidField.getField(pos);
+      const double storage = (bFloat - bDouble).norm();
+      maxStorage = std::max(maxStorage, storage);
+      sumStorage += storage;
+      const double interp = (bDouble - bTrue).norm();
+      maxInterp = std::max(maxInterp, interp);
+      sumInterp += interp;
+    }
+    std::cout << " - storage error (float vs double map): max "
+              << maxStorage / 1_T << " T, mean "
+              << sumStorage / n_precision / 1_T << " T" << std::endl;
+    // the maximum is dominated by positions close to the coils, where the
+    // analytical field varies rapidly
+    std::cout << " - interpolation error (double map vs analytical): max "
+              << maxInterp / 1_T << " T, mean "
+              << sumInterp / n_precision / 1_T << " T" << std::endl;
+
+    const std::size_t nValues = bFieldMap.getGrid().size();
+    std::cout << " - grid storage: "
+              << nValues * sizeof(decltype(bFieldMap)::FieldType) << " bytes"
+              << " (double), "
+              << nValues * sizeof(decltype(bFieldMapFloat)::FieldType)
+              << " bytes (float)" << std::endl;
+  }
+
+  std::ofstream os{"bfield_precision_bench.csv"};
+
+  auto csv = [&](const std::string& name, auto res) {
+    os << name << "," << res.run_timings.size() << "," << res.iters_per_run
+       << "," << res.totalTime().count() << "," << res.runTimeMedian().count()
+       << "," << 1.96 * res.runTimeError().count() << ","
+       << res.iterTimeAverage().count() << ","
+       << 1.96 * res.iterTimeError().count();
+
+    os << std::endl;
+  };
+
+  os << "name,runs,iters,total_time,run_time_median,run_time_error,iter_"
+        "time_average,iter_time_error"
+     << std::endl;
+
+  // Random positions, without cache: every lookup reads and converts the
+  // corner values from the grid storage, so this shows the conversion overhead
+  // as well as the effect of the smaller memory footprint.
+  std::vector<Acts::Vector3> randomPositions;
+  randomPositions.reserve(iters_map);
+  for (std::size_t i = 0; i < iters_map; i++) {
+    randomPositions.push_back(genPos());
+  }
+
+  std::cout << "Benchmarking random interpolated field lookup (double): "
+            << std::flush;
+  const auto rand_double = Acts::Test::microBenchmark(
+      [&](const auto& p) { return bFieldMap.getField(p); }, randomPositions);
+  std::cout << rand_double << std::endl;
+  csv("interp_nocache_random_double", rand_double);
+
+  std::cout << "Benchmarking random interpolated field lookup (float): "
+            << std::flush;
+  const auto rand_float = Acts::Test::microBenchmark(
+      [&](const auto& p) { return bFieldMapFloat.getField(p); },
+      randomPositions);
+  std::cout << rand_float << std::endl;
+  csv("interp_nocache_random_float", rand_float);
+
+  // Advancing along a straight line with cache: the conversion only happens
+  // when a new field cell is created, which is the typical access pattern
+  // during propagation.
+  Acts::Vector3 pos{0, 0, 0};
+  Acts::Vector3 dir{};
+  dir.setRandom();
+  double h = 1e-3;
+  std::vector<Acts::Vector3> steps;
+  steps.reserve(iters_map);
+  for (std::size_t i = 0; i < iters_map; i++) {
+    pos += dir * h;
+    double z = pos[Acts::eFreePos2];
+    if (Acts::VectorHelpers::perp(pos) > rMax || z >= zMax || z < zMin) {
+      break;
+    }
+    steps.push_back(pos);
+  }
+
+  {
+    std::cout << "Benchmarking cached advancing field lookup (double): "
+              << std::flush;
+    auto cache = bFieldMap.makeCache(mctx);
+    const auto adv_double = Acts::Test::microBenchmark(
+        [&](const auto& s) { return bFieldMap.getField(s, cache).value(); },
+        steps);
+    std::cout << adv_double << std::endl;
+    csv("interp_cache_adv_double", adv_double);
+  }
+
+  {
+    std::cout << "Benchmarking cached advancing field lookup (float): "
+              << std::flush;
+    auto cache = bFieldMapFloat.makeCache(mctx);
+    const auto adv_float = Acts::Test::microBenchmark(
+        [&](const auto& s) {
+          return bFieldMapFloat.getField(s, cache).value();
+        },
+        steps);
+    std::cout << adv_float << std::endl;
+    csv("interp_cache_adv_float", adv_float);
+  }
+}
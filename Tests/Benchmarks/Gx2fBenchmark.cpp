@@ -0,0 +1,169 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/TrackFitting/GlobalChiSquareFitter.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+
+namespace {
+
+struct SurfaceInput {
+  BoundMatrix jacobian;
+  BoundMatrix information;
+  BoundVector weightedResidual;
+  bool hasScattering = false;
+  Vector2 scatteringInformation;
+  Vector2 scatteringBVector;
+};
+
+/// A long track with a two dimensional measurement on every surface and
+/// material on a fraction of them, e.g. a muon through a calorimeter
+std::vector<SurfaceInput> makeTrack(std::size_t nSurfaces,
+                                    std::size_t materialStride) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> dist(-1, 1);
+
+  std::vector<SurfaceInput> track(nSurfaces);
+  for (std::size_t i = 0; i < nSurfaces; ++i) {
+    SurfaceInput& surface = track[i];
+    surface.jacobian = BoundMatrix::Identity();
+    for (int k = 0; k < surface.jacobian.size(); ++k) {
+      surface.jacobian(k) += 0.01 * dist(rng);
+    }
+    surface.information = BoundMatrix::Zero();
+    surface.information(eBoundLoc0, eBoundLoc0) = 1e4;
+    surface.information(eBoundLoc1, eBoundLoc1) = 1e2;
+    surface.weightedResidual = BoundVector::Zero();
+    surface.weightedResidual(eBoundLoc0) = 1e4 * 1e-3 * dist(rng);
+    surface.weightedResidual(eBoundLoc1) = 1e2 * 1e-2 * dist(rng);
+    surface.hasScattering = (i % materialStride) == 0;
+    surface.scatteringInformation = Vector2::Constant(1e6);
+    surface.scatteringBVector = Vector2::Zero();
+  }
+  return track;
+}
+
+/// The per-surface system, as built and solved by the fitter
+Experimental::Gx2fSystem::Solution solvePerSurface(
+    const std::vector<SurfaceInput>& track) {
+  Experimental::Gx2fSystem system;
+  for (const SurfaceInput& surface : track) {
+    system.addSurface(surface.jacobian);
+    system.addMeasurement(surface.information, surface.weightedResidual);
+    if (surface.hasScattering) {
+      system.addScattering(surface.scatteringInformation,
+                           surface.scatteringBVector);
+    }
+  }
+  return system.solve();
+}
+
+/// The dense system with the extended Jacobians, as it was built by the
+/// fitter before the per-surface system
+Eigen::VectorXd solveDense(const std::vector<SurfaceInput>& track) {
+  std::size_t nScatterers = 0;
+  for (const SurfaceInput& surface : track) {
+    nScatterers += surface.hasScattering ? 1 : 0;
+  }
+  const std::size_t dims = eBoundSize + 2 * nScatterers;
+
+  Eigen::MatrixXd aMatrix = Eigen::MatrixXd::Zero(dims, dims);
+  Eigen::VectorXd bVector = Eigen::VectorXd::Zero(dims);
+  std::vector<BoundMatrix> jacobianFromStart = {BoundMatrix::Identity()};
+  for (const SurfaceInput& surface : track) {
+    for (BoundMatrix& jac : jacobianFromStart) {
+      jac = surface.jacobian * jac;
+    }
+    Eigen::MatrixXd extendedJacobian = Eigen::MatrixXd::Zero(eBoundSize, dims);
+    extendedJacobian.leftCols<eBoundSize>() = jacobianFromStart[0];
+    for (std::size_t k = 1; k < jacobianFromStart.size(); ++k) {
+      extendedJacobian.block<eBoundSize, 2>(0, eBoundSize + 2 * (k - 1)) =
+          jacobianFromStart[k] * Experimental::Gx2fConstants::phiThetaProjector;
+    }
+    aMatrix +=
+        extendedJacobian.transpose() * surface.information * extendedJacobian;
+    bVector += extendedJacobian.transpose() * surface.weightedResidual;
+
+    if (surface.hasScattering) {
+      const std::size_t position =
+          eBoundSize + 2 * (jacobianFromStart.size() - 1);
+      aMatrix.block<2, 2>(position, position).diagonal() +=
+          surface.scatteringInformation;
+      bVector.segment<2>(position) += surface.scatteringBVector;
+      jacobianFromStart.emplace_back(BoundMatrix::Identity());
+    }
+  }
+
+  return aMatrix.colPivHouseholderQr().solve(bVector);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  unsigned int lvl = Logging::INFO;
+  unsigned int nSurfaces = 0;
+  unsigned int materialStride = 0;
+  unsigned int nRuns = 0;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("surfaces", po::value<unsigned int>(&nSurfaces)->default_value(200), "number of measurement surfaces")
+      ("material-stride", po::value<unsigned int>(&materialStride)->default_value(2), "every n-th surface has material")
+      ("runs", po::value<unsigned int>(&nRuns)->default_value(20), "number of benchmark runs")
+      ("verbose", po::value<unsigned int>(&lvl)->default_value(Logging::INFO), "logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.contains("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+    if (materialStride == 0) {
+      std::cerr << "error: the material stride has to be positive"
+                << std::endl;
+      return 1;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Gx2f", Logging::Level(lvl)));
+
+  for (unsigned int n = 25; n <= nSurfaces; n *= 2) {
+    const std::vector<SurfaceInput> track = makeTrack(n, materialStride);
+
+    const auto perSurface = Test::microBenchmark(
+        [&] { return solvePerSurface(track); }, 1, nRuns,
+        std::chrono::milliseconds(100));
+    const auto dense = Test::microBenchmark(
+        [&] { return solveDense(track); }, 1, nRuns,
+        std::chrono::milliseconds(100));
+
+    ACTS_INFO(n << " surfaces, per surface system: " << perSurface);
+    ACTS_INFO(n << " surfaces, dense system:       " << dense);
+  }
+
+  return 0;
+}
@@ -0,0 +1,170 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/PackedMeasurements.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+
+// Compares the measurement selection on the packed measurements with the
+// selection on calibrated track state candidates, as done by the default
+// track state creator of the combinatorial Kalman filter
+int main(int argc, char* argv[]) {
+  std::size_t nMeasurements = 4096;
+  std::size_t nRuns = 200;
+  if (argc >= 2) {
+    nMeasurements = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    nRuns = std::stoi(argv[2]);
+  }
+
+  auto logger = getDefaultLogger("PackedMeasurementsBenchmark", Logging::INFO);
+
+  std::mt19937 rng(1234);
+  std::normal_distribution<double> normal(0, 1);
+
+  BoundVector predicted = BoundVector::Zero();
+  BoundSquareMatrix predictedCovariance = BoundSquareMatrix::Identity() * 0.01;
+  predictedCovariance(eBoundLoc0, eBoundLoc1) = 0.002;
+  predictedCovariance(eBoundLoc1, eBoundLoc0) = 0.002;
+
+  MeasurementSelectorCuts cuts;
+  cuts.chi2CutOff = {15};
+  cuts.numMeasurementsCutOff = {3};
+  MeasurementSelector selector(cuts);
+
+  const std::array<std::uint8_t, 2> loc01 = {eBoundLoc0, eBoundLoc1};
+  const std::array<std::uint8_t, 1> loc0 = {eBoundLoc0};
+  const SquareMatrix2 covariance2 = Vector2(0.001, 0.01).asDiagonal();
+  const ActsSquareMatrix<1> covariance1(0.001);
+
+  // pixel surfaces only have two dimensional measurements, mixed surfaces
+  // have one dimensional ones in between
+  for (bool mixed : {false, true}) {
+    for (std::size_t perSurface : {1u, 4u, 16u, 64u}) {
+      const std::size_t nSurfaces = nMeasurements / perSurface;
+
+      PackedMeasurements packed;
+      std::vector<GeometryIdentifier> surfaces;
+      for (std::size_t s = 0; s < nSurfaces; ++s) {
+        const auto geoId =
+            GeometryIdentifier().setVolume(1).setSensitive(s + 1);
+        surfaces.push_back(geoId);
+        for (std::size_t m = 0; m < perSurface; ++m) {
+          if (mixed && m % 2 == 1) {
+            packed.add(geoId, loc0, ActsVector<1>(0.1 * normal(rng)),
+                       covariance1);
+          } else {
+            packed.add(geoId, loc01,
+                       Vector2(0.1 * normal(rng), 0.1 * normal(rng)),
+                       covariance2);
+          }
+        }
+      }
+
+      std::vector<const PackedMeasurements::SurfaceRange*> ranges;
+      for (const auto& geoId : surfaces) {
+        ranges.push_back(packed.find(geoId));
+      }
+
+      std::cout << (mixed ? "mixed" : "pixel") << " surfaces with "
+                << perSurface << " measurements" << std::endl;
+
+      std::vector<double> chi2(perSurface);
+      std::vector<std::size_t> selected(perSurface);
+      std::cout << "  packed chi2: " << std::flush;
+      const auto packedChi2 = Acts::Test::microBenchmark(
+          [&] {
+            std::size_t nSelected = 0;
+            for (const auto* range : ranges) {
+              packed.chi2(*range, predicted, predictedCovariance, chi2);
+              bool isOutlier = false;
+              nSelected += selector
+                               .selectByChi2(range->geometryId, 0, chi2,
+                                             selected, isOutlier, *logger)
+                               .value();
+            }
+            return nSelected;
+          },
+          1, nRuns);
+      std::cout << packedChi2 << std::endl;
+
+      auto surface =
+          Surface::makeShared<PlaneSurface>(Transform3::Identity());
+      VectorMultiTrajectory buffer;
+      std::vector<VectorMultiTrajectory::TrackStateProxy> candidates;
+      std::cout << "  calibrated candidates: " << std::flush;
+      const auto candidateChi2 = Acts::Test::microBenchmark(
+          [&] {
+            std::size_t nSelected = 0;
+            for (std::size_t s = 0; s < nSurfaces; ++s) {
+              buffer.clear();
+              candidates.clear();
+              for (std::size_t i = 0; i < perSurface; ++i) {
+                using PM = TrackStatePropMask;
+                auto trackState = buffer.makeTrackState(
+                    i == 0 ? PM::Predicted | PM::Calibrated : PM::Calibrated);
+                trackState.setReferenceSurface(surface);
+                if (i == 0) {
+                  trackState.predicted() = predicted;
+                  trackState.predictedCovariance() = predictedCovariance;
+                } else {
+                  trackState.shareFrom(candidates.front(), PM::Predicted);
+                }
+                // the values of the packed measurements are not exposed, but
+                // the chi2 only depends on their content, not on the values
+                if (mixed && i % 2 == 1) {
+                  trackState.allocateCalibrated(1);
+                  trackState.template calibrated<1>() = ActsVector<1>(0.05);
+                  trackState.template calibratedCovariance<1>() = covariance1;
+                  trackState.setSubspaceIndices(loc0);
+                } else {
+                  trackState.allocateCalibrated(2);
+                  trackState.template calibrated<2>() = Vector2(0.05, -0.05);
+                  trackState.template calibratedCovariance<2>() = covariance2;
+                  trackState.setSubspaceIndices(loc01);
+                }
+                candidates.push_back(trackState);
+              }
+              bool isOutlier = false;
+              auto result = selector.select<VectorMultiTrajectory>(
+                  candidates, isOutlier, *logger);
+              nSelected += result.value().second - result.value().first;
+            }
+            return nSelected;
+          },
+          1, nRuns);
+      std::cout << candidateChi2 << std::endl;
+      std::cout << "  speed-up: "
+                << candidateChi2.runTimeMedian().count() /
+                       packedChi2.runTimeMedian().count()
+                << std::endl;
+    }
+  }
+
+  return 0;
+}
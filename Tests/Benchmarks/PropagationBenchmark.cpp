@@ -0,0 +1,352 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Detector/Detector.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Navigation/DetectorNavigator.hpp"
+#include "Acts/Propagator/ActorList.hpp"
+#include "Acts/Propagator/AtlasStepper.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MaterialInteractor.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Propagator/SympyStepper.hpp"
+#include "Acts/Propagator/TryAllNavigator.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalDetector.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include "AllocationCounter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::Test;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+using Duration = std::chrono::duration<double, std::nano>;
+
+/// Navigator decorator which accumulates the time spent in the navigation
+///
+/// The clock is read around every navigator call, which adds a small
+/// constant overhead per step to the measured navigation time.
+template <typename navigator_t>
+class TimedNavigator : public navigator_t {
+ public:
+  TimedNavigator(navigator_t navigator, Duration* time)
+      : navigator_t(std::move(navigator)), m_time(time) {}
+
+  template <typename propagator_state_t, typename stepper_t>
+  void initialize(propagator_state_t& state, const stepper_t& stepper) const {
+    measure([&] { navigator_t::initialize(state, stepper); });
+  }
+
+  template <typename propagator_state_t, typename stepper_t>
+  void preStep(propagator_state_t& state, const stepper_t& stepper) const {
+    measure([&] { navigator_t::preStep(state, stepper); });
+  }
+
+  template <typename propagator_state_t, typename stepper_t>
+  void postStep(propagator_state_t& state, const stepper_t& stepper) const {
+    measure([&] { navigator_t::postStep(state, stepper); });
+  }
+
+ private:
+  template <typename call_t>
+  void measure(call_t&& call) const {
+    auto start = std::chrono::steady_clock::now();
+    call();
+    *m_time += std::chrono::steady_clock::now() - start;
+  }
+
+  Duration* m_time = nullptr;
+};
+
+struct BenchmarkConfig {
+  unsigned int toys = 1000;
+  std::vector<double> etas;
+  std::vector<double> pTs;
+  std::vector<std::string> steppers;
+  std::vector<std::string> navigators;
+  bool fieldMap = true;
+  double BzInT = 2;
+  double maxPathInM = 5;
+  bool withCov = true;
+  unsigned int batchSize = 0;
+  std::string csv;
+
+  bool selected(const std::vector<std::string>& names,
+                const std::string& name) const {
+    return std::ranges::find(names, name) != names.end();
+  }
+};
+
+struct Summary {
+  double tracksPerSecond = 0;
+  double stepsPerTrack = 0;
+  double navigationShare = 0;
+  double allocationsPerTrack = 0;
+  std::size_t failures = 0;
+};
+
+/// Propagate the tracks of every point of the eta/pT grid and print the
+/// throughput
+///
+/// If @p energyLoss is false only multiple scattering is applied in the
+/// material.
+template <typename stepper_t, typename navigator_t>
+void run(const BenchmarkConfig& cfg, const std::string& stepperName,
+         stepper_t stepper, const std::string& navigatorName,
+         navigator_t navigator, bool energyLoss, std::ostream* csv) {
+  using Navigator = TimedNavigator<navigator_t>;
+  using Propagator = Acts::Propagator<stepper_t, Navigator>;
+  using Actors = ActorList<MaterialInteractor, EndOfWorldReached>;
+  using Options = typename Propagator::template Options<Actors>;
+
+  GeometryContext geoCtx;
+  MagneticFieldContext magCtx;
+
+  Duration navigationTime{0};
+  Propagator propagator(std::move(stepper),
+                        Navigator(std::move(navigator), &navigationTime));
+
+  Options options(geoCtx, magCtx);
+  options.pathLimit = cfg.maxPathInM * 1_m;
+  options.actorList.template get<MaterialInteractor>().energyLoss = energyLoss;
+
+  BoundSquareMatrix cov = BoundSquareMatrix::Identity();
+  cov(eBoundQOverP, eBoundQOverP) = 1_e / 10_GeV;
+
+  for (double eta : cfg.etas) {
+    for (double pT : cfg.pTs) {
+      const double theta = 2 * std::atan(std::exp(-eta));
+      const double p = pT * 1_GeV / std::sin(theta);
+
+      // the same tracks for every stepper and navigator
+      std::mt19937 rng(4242);
+      std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+      std::vector<CurvilinearTrackParameters> starts;
+      starts.reserve(cfg.toys);
+      for (unsigned int i = 0; i < cfg.toys; ++i) {
+        const double q = (i % 2 == 0) ? 1 : -1;
+        starts.emplace_back(Vector4::Zero(), phiDist(rng), theta, q / p,
+                            cfg.withCov ? std::optional(cov) : std::nullopt,
+                            ParticleHypothesis::pion());
+      }
+
+      std::vector<std::vector<CurvilinearTrackParameters>> batches;
+      for (std::size_t i = 0; cfg.batchSize > 0 && i < starts.size();
+           i += cfg.batchSize) {
+        const std::size_t end =
+            std::min<std::size_t>(i + cfg.batchSize, starts.size());
+        batches.emplace_back(starts.begin() + i, starts.begin() + end);
+      }
+
+      // warm up caches and lazily initialized state
+      for (std::size_t i = 0; i < std::min<std::size_t>(10, starts.size());
+           ++i) {
+        (void)propagator.propagate(starts[i], options);
+      }
+
+      Summary summary;
+      std::size_t steps = 0;
+      navigationTime = Duration{0};
+      const AllocationCount allocationsBefore = allocationCount();
+      auto start = std::chrono::steady_clock::now();
+      auto count = [&](const auto& result) {
+        if (result.ok()) {
+          steps += result->steps;
+        } else {
+          ++summary.failures;
+        }
+      };
+      if (cfg.batchSize == 0) {
+        for (const auto& startParameters : starts) {
+          count(propagator.propagate(startParameters, options));
+        }
+      } else {
+        for (const auto& batch : batches) {
+          for (const auto& result : propagator.propagateBatch(batch, options)) {
+            count(result);
+          }
+        }
+      }
+      const Duration time = std::chrono::steady_clock::now() - start;
+      const AllocationCount allocations =
+          allocationCount() - allocationsBefore;
+
+      const double nTracks = starts.size();
+      summary.tracksPerSecond = nTracks / (time.count() * 1e-9);
+      summary.stepsPerTrack = steps / nTracks;
+      summary.navigationShare = navigationTime / time;
+      summary.allocationsPerTrack = allocations.allocations / nTracks;
+
+      std::cout << std::left << std::setw(14) << stepperName << std::setw(18)
+                << navigatorName << std::right << std::fixed
+                << std::setprecision(2) << std::setw(6) << eta
+                << std::setw(8) << pT << std::setprecision(0)
+                << std::setw(12) << summary.tracksPerSecond
+                << std::setprecision(1) << std::setw(12)
+                << summary.stepsPerTrack << std::setw(10)
+                << 100 * summary.navigationShare << std::setw(14)
+                << summary.allocationsPerTrack << std::setw(10)
+                << summary.failures << std::endl;
+
+      if (csv != nullptr) {
+        *csv << stepperName << "," << navigatorName << "," << eta << ","
+             << pT << "," << summary.tracksPerSecond << ","
+             << summary.stepsPerTrack << "," << summary.navigationShare << ","
+             << summary.allocationsPerTrack << "," << summary.failures
+             << std::endl;
+      }
+    }
+  }
+}
+
+/// Run one stepper with all selected navigators
+template <typename stepper_t>
+void runNavigators(
+    const BenchmarkConfig& cfg, const std::string& stepperName,
+    const stepper_t& stepper,
+    const std::shared_ptr<const TrackingGeometry>& trackingGeometry,
+    const Experimental::Detector& detector, std::ostream* csv) {
+  if (!cfg.selected(cfg.steppers, stepperName)) {
+    return;
+  }
+
+  if (cfg.selected(cfg.navigators, "Navigator")) {
+    Acts::Navigator::Config navCfg{trackingGeometry};
+    run(cfg, stepperName, stepper, "Navigator", Acts::Navigator(navCfg), true,
+        csv);
+  }
+  if (cfg.selected(cfg.navigators, "TryAllNavigator")) {
+    TryAllNavigator::Config navCfg{trackingGeometry};
+    run(cfg, stepperName, stepper, "TryAllNavigator", TryAllNavigator(navCfg),
+        true, csv);
+  }
+  if (cfg.selected(cfg.navigators, "DetectorNavigator")) {
+    Experimental::DetectorNavigator::Config navCfg;
+    navCfg.detector = &detector;
+    // the test detector carries placeholder material with an unphysical
+    // energy loss, which would stop every track in the first layers
+    run(cfg, stepperName, stepper, "DetectorNavigator",
+        Experimental::DetectorNavigator(navCfg), false, csv);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  BenchmarkConfig cfg;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("toys", po::value<unsigned int>(&cfg.toys)->default_value(1000), "number of tracks per grid point")
+      ("eta", po::value<std::vector<double>>(&cfg.etas)->multitoken()->default_value({0., 1., 2.}, "0 1 2"), "eta values of the grid")
+      ("pT", po::value<std::vector<double>>(&cfg.pTs)->multitoken()->default_value({0.5, 1., 10.}, "0.5 1 10"), "transverse momenta of the grid in GeV")
+      ("steppers", po::value<std::vector<std::string>>(&cfg.steppers)->multitoken()->default_value({"Eigen", "Atlas", "Sympy", "StraightLine"}, "Eigen Atlas Sympy StraightLine"), "steppers to run")
+      ("navigators", po::value<std::vector<std::string>>(&cfg.navigators)->multitoken()->default_value({"Navigator", "TryAllNavigator", "DetectorNavigator"}, "Navigator TryAllNavigator DetectorNavigator"), "navigators to run")
+      ("field-map", po::value<bool>(&cfg.fieldMap)->default_value(true), "use an interpolated solenoid field map instead of a constant field")
+      ("B", po::value<double>(&cfg.BzInT)->default_value(2), "field strength in the center in T")
+      ("path", po::value<double>(&cfg.maxPathInM)->default_value(5), "maximum path length in m")
+      ("cov", po::value<bool>(&cfg.withCov)->default_value(true), "propagation with covariance matrix")
+      ("batch", po::value<unsigned int>(&cfg.batchSize)->default_value(0), "propagate bundles of this many tracks in lock-step, 0 propagates one track at a time")
+      ("csv", po::value<std::string>(&cfg.csv)->default_value(""), "write the results to this CSV file");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.contains("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  GeometryContext geoCtx;
+
+  // barrel geometry with material for the layer based navigators and a
+  // similar detector for the detector navigator
+  CylindricalTrackingGeometry cGeometry(geoCtx);
+  auto trackingGeometry = cGeometry();
+  auto detector = buildCylindricalDetector(geoCtx);
+
+  std::shared_ptr<const MagneticFieldProvider> field;
+  if (cfg.fieldMap) {
+    // solenoid roughly like the one of the ATLAS inner detector
+    const double length = 5.8_m;
+    const double radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+    SolenoidBField solenoid({radius, length, 1154, cfg.BzInT * 1_T});
+    std::cout << "Building interpolated field map" << std::endl;
+    auto fieldMap = solenoidFieldMap({0, 2 * radius}, {-length, length},
+                                     {150, 200}, solenoid);
+    field = std::make_shared<decltype(fieldMap)>(std::move(fieldMap));
+  } else {
+    field = std::make_shared<ConstantBField>(Vector3(0, 0, cfg.BzInT * 1_T));
+  }
+
+  std::ofstream csvFile;
+  std::ostream* csv = nullptr;
+  if (!cfg.csv.empty()) {
+    csvFile.open(cfg.csv);
+    csvFile << "stepper,navigator,eta,pT,tracks_per_second,steps_per_track,"
+               "navigation_share,allocations_per_track,failures"
+            << std::endl;
+    csv = &csvFile;
+  }
+
+  std::cout << "Propagating " << cfg.toys << " tracks per grid point"
+            << std::endl;
+  std::cout << std::left << std::setw(14) << "stepper" << std::setw(18)
+            << "navigator" << std::right << std::setw(6) << "eta"
+            << std::setw(8) << "pT" << std::setw(12) << "tracks/s"
+            << std::setw(12) << "steps/track" << std::setw(10) << "nav[%]"
+            << std::setw(14) << "allocs/track" << std::setw(10) << "failures"
+            << std::endl;
+
+  runNavigators(cfg, "Eigen", EigenStepper<>(field), trackingGeometry,
+                *detector, csv);
+  runNavigators(cfg, "Atlas", AtlasStepper(field), trackingGeometry,
+                *detector, csv);
+  runNavigators(cfg, "Sympy", SympyStepper(field), trackingGeometry,
+                *detector, csv);
+  runNavigators(cfg, "StraightLine", StraightLineStepper(), trackingGeometry,
+                *detector, csv);
+
+  return 0;
+}
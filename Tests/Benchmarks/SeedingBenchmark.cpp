@@ -0,0 +1,291 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/Seed.hpp"
+#include "Acts/EventData/SpacePointContainer.hpp"
+#include "Acts/Seeding/BinnedGroup.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Seeding/SeedFinder.hpp"
+#include "Acts/Seeding/SeedFinderConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Utilities/GridBinFinder.hpp"
+#include "Acts/Utilities/Holders.hpp"
+
+#include <any>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+struct BenchmarkConfig {
+  unsigned int events = 10;
+  unsigned int tracks = 1000;
+  unsigned int noise = 2000;
+  double BzInT = 2;
+  bool interactionPointCut = false;
+};
+
+struct SpacePoint {
+  float x = 0;
+  float y = 0;
+  float z = 0;
+  float varianceR = 0;
+  float varianceZ = 0;
+};
+
+/// Minimal space point backend for the seeding space point container
+class SpacePointCollection {
+ public:
+  using ValueType = SpacePoint;
+
+  explicit SpacePointCollection(const std::vector<SpacePoint>& spacePoints)
+      : m_spacePoints(&spacePoints) {}
+
+  std::size_t size_impl() const { return m_spacePoints->size(); }
+  float x_impl(std::size_t i) const { return (*m_spacePoints)[i].x; }
+  float y_impl(std::size_t i) const { return (*m_spacePoints)[i].y; }
+  float z_impl(std::size_t i) const { return (*m_spacePoints)[i].z; }
+  float varianceR_impl(std::size_t i) const {
+    return (*m_spacePoints)[i].varianceR;
+  }
+  float varianceZ_impl(std::size_t i) const {
+    return (*m_spacePoints)[i].varianceZ;
+  }
+  const SpacePoint& get_impl(std::size_t i) const {
+    return (*m_spacePoints)[i];
+  }
+  std::any component_impl(HashedString /*key*/, std::size_t /*i*/) const {
+    throw std::runtime_error("no strip space points in this benchmark");
+  }
+
+ private:
+  const std::vector<SpacePoint>* m_spacePoints;
+};
+
+using SpacePoints =
+    Acts::SpacePointContainer<SpacePointCollection, detail::RefHolder>;
+using Proxy = SpacePoints::SpacePointProxyType;
+using SeedingGrid = CylindricalSpacePointGrid<Proxy>;
+using Finder = SeedFinder<Proxy, SeedingGrid>;
+
+/// Hits of helices from the beam line on barrel pixel layers, and random
+/// noise hits in the same volume
+std::vector<SpacePoint> generateEvent(const BenchmarkConfig& cfg,
+                                      std::mt19937& rng) {
+  constexpr std::array<float, 7> layers = {33, 50, 72, 99, 122, 155, 180};
+  constexpr float zMax = 1000;
+  constexpr float sigmaRPhi = 0.015;
+  constexpr float sigmaZ = 0.05;
+
+  std::uniform_real_distribution<float> phiDist(-std::numbers::pi,
+                                                std::numbers::pi);
+  std::uniform_real_distribution<float> etaDist(-2.5, 2.5);
+  std::uniform_real_distribution<float> invPtDist(1 / 10., 1 / 0.5);
+  std::uniform_real_distribution<float> zDist(-zMax, zMax);
+  std::uniform_int_distribution<std::size_t> layerDist(0, layers.size() - 1);
+  std::normal_distribution<float> z0Dist(0, 50);
+  std::normal_distribution<float> unitDist(0, 1);
+
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(cfg.tracks * layers.size() + cfg.noise);
+
+  // helix radius in mm for pT in GeV
+  const float radiusPerPt = 1000 / (0.3 * cfg.BzInT);
+  for (unsigned int i = 0; i < cfg.tracks; ++i) {
+    const float phi0 = phiDist(rng);
+    const float cotTheta = std::sinh(etaDist(rng));
+    const float z0 = z0Dist(rng);
+    const float radius = radiusPerPt / invPtDist(rng);
+    const float charge = (i % 2 == 0) ? 1 : -1;
+    for (float r : layers) {
+      if (r > 2 * radius) {
+        break;
+      }
+      // the helix crosses the layer after this turning angle
+      const float halfAngle = std::asin(r / (2 * radius));
+      const float z = z0 + 2 * radius * halfAngle * cotTheta;
+      if (std::abs(z) > zMax) {
+        break;
+      }
+      const float phi =
+          phi0 - charge * halfAngle + sigmaRPhi * unitDist(rng) / r;
+      spacePoints.push_back({r * std::cos(phi), r * std::sin(phi),
+                             z + sigmaZ * unitDist(rng), sigmaRPhi * sigmaRPhi,
+                             sigmaZ * sigmaZ});
+    }
+  }
+  for (unsigned int i = 0; i < cfg.noise; ++i) {
+    const float r = layers[layerDist(rng)];
+    const float phi = phiDist(rng);
+    spacePoints.push_back({r * std::cos(phi), r * std::sin(phi), zDist(rng),
+                           sigmaRPhi * sigmaRPhi, sigmaZ * sigmaZ});
+  }
+  return spacePoints;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  BenchmarkConfig cfg;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("events", po::value<unsigned int>(&cfg.events)->default_value(10), "number of events")
+      ("tracks", po::value<unsigned int>(&cfg.tracks)->default_value(1000), "number of tracks per event")
+      ("noise", po::value<unsigned int>(&cfg.noise)->default_value(2000), "number of noise hits per event")
+      ("B", po::value<double>(&cfg.BzInT)->default_value(2), "field strength in T")
+      ("ip-cut", po::value<bool>(&cfg.interactionPointCut)->default_value(false), "apply the curvature cut of the doublets with respect to the interaction point");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.contains("help")) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  // pixel seeding configuration similar to the one of the Open Data Detector
+  SeedFilterConfig filterCfg;
+  filterCfg.maxSeedsPerSpM = 1;
+  filterCfg.deltaRMin = 1_mm;
+  filterCfg = filterCfg.toInternalUnits();
+
+  SeedFinderConfig<Proxy> finderCfg;
+  finderCfg.rMin = 0_mm;
+  finderCfg.rMax = 200_mm;
+  finderCfg.deltaRMin = 1_mm;
+  finderCfg.deltaRMax = 60_mm;
+  finderCfg.deltaRMinTopSP = finderCfg.deltaRMin;
+  finderCfg.deltaRMinBottomSP = finderCfg.deltaRMin;
+  finderCfg.deltaRMaxTopSP = finderCfg.deltaRMax;
+  finderCfg.deltaRMaxBottomSP = finderCfg.deltaRMax;
+  finderCfg.collisionRegionMin = -250_mm;
+  finderCfg.collisionRegionMax = 250_mm;
+  finderCfg.zMin = -2000_mm;
+  finderCfg.zMax = 2000_mm;
+  finderCfg.maxSeedsPerSpM = filterCfg.maxSeedsPerSpM;
+  finderCfg.cotThetaMax = 7.40627;
+  finderCfg.sigmaScattering = 5;
+  finderCfg.radLengthPerSeed = 0.1;
+  finderCfg.minPt = 500_MeV;
+  finderCfg.impactMax = 3_mm;
+  finderCfg.useVariableMiddleSPRange = false;
+  finderCfg.interactionPointCut = cfg.interactionPointCut;
+
+  CylindricalSpacePointGridConfig gridCfg;
+  gridCfg.minPt = finderCfg.minPt;
+  gridCfg.rMax = finderCfg.rMax;
+  gridCfg.zMax = finderCfg.zMax;
+  gridCfg.zMin = finderCfg.zMin;
+  gridCfg.deltaRMax = finderCfg.deltaRMax;
+  gridCfg.cotThetaMax = finderCfg.cotThetaMax;
+  gridCfg = gridCfg.toInternalUnits();
+  CylindricalSpacePointGridOptions gridOptions;
+  gridOptions.bFieldInZ = cfg.BzInT * 1_T;
+  gridOptions = gridOptions.toInternalUnits();
+
+  finderCfg.seedFilter = std::make_shared<SeedFilter<Proxy>>(filterCfg);
+  finderCfg = finderCfg.toInternalUnits().calculateDerivedQuantities();
+
+  SeedFinderOptions finderOptions;
+  finderOptions.bFieldInZ = cfg.BzInT * 1_T;
+  finderOptions =
+      finderOptions.toInternalUnits().calculateDerivedQuantities(finderCfg);
+
+  GridBinFinder<3ul> bottomBinFinder(1, std::vector<std::pair<int, int>>(), 0);
+  GridBinFinder<3ul> topBinFinder(1, std::vector<std::pair<int, int>>(), 0);
+
+  Finder finder(finderCfg);
+  Finder::SeedingState state;
+  const Range1D<float> rMiddleSPRange;
+
+  std::mt19937 rng(42);
+  std::vector<std::vector<SpacePoint>> events;
+  for (unsigned int i = 0; i < cfg.events; ++i) {
+    events.push_back(generateEvent(cfg, rng));
+  }
+
+  std::size_t nSpacePoints = 0;
+  std::size_t nSeeds = 0;
+  // order dependent hash of the seeds to compare the output of different
+  // versions of the seed finder
+  std::uint64_t checksum = 0;
+  std::chrono::duration<double, std::milli> time{0};
+  for (const auto& event : events) {
+    SpacePointCollection collection(event);
+    SpacePoints spContainer(SpacePointContainerConfig(),
+                            SpacePointContainerOptions(), collection);
+    nSpacePoints += spContainer.size();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    SeedingGrid grid = CylindricalSpacePointGridCreator::createGrid<Proxy>(
+        gridCfg, gridOptions);
+    CylindricalSpacePointGridCreator::fillGrid(finderCfg, finderOptions, grid,
+                                               spContainer.begin(),
+                                               spContainer.end());
+    CylindricalBinnedGroup<Proxy> groups(std::move(grid), bottomBinFinder,
+                                         topBinFinder);
+
+    std::vector<Seed<Proxy>> seeds;
+    state.spacePointMutableData.resize(spContainer.size());
+    for (const auto [bottom, middle, top] : groups) {
+      finder.createSeedsForGroup(finderOptions, state, groups.grid(), seeds,
+                                 bottom, middle, top, rMiddleSPRange);
+    }
+
+    time += std::chrono::steady_clock::now() - start;
+
+    nSeeds += seeds.size();
+    for (const auto& seed : seeds) {
+      for (const auto* sp : seed.sp()) {
+        checksum = checksum * 31 + sp->index();
+      }
+      checksum = checksum * 31 + std::bit_cast<std::uint32_t>(seed.z());
+      checksum =
+          checksum * 31 + std::bit_cast<std::uint32_t>(seed.seedQuality());
+    }
+  }
+
+  std::cout << "Seeded " << cfg.events << " events with "
+            << nSpacePoints / cfg.events << " space points each" << std::endl;
+  std::cout << "seeds/event: " << nSeeds / cfg.events << std::endl;
+  std::cout << "time/event: " << time.count() / cfg.events << " ms"
+            << std::endl;
+  std::cout << "checksum: " << std::hex << checksum << std::dec << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,115 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/ContainerPool.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace Acts;
+
+BOOST_AUTO_TEST_SUITE(EventDataContainerPool)
+
+BOOST_AUTO_TEST_CASE(ReuseTrackStateContainer) {
+  ContainerPool<VectorMultiTrajectory> pool;
+  BOOST_CHECK_EQUAL(pool.size(), 0u);
+
+  const VectorMultiTrajectory* first = nullptr;
+  {
+    auto mtj = pool.acquire();
+    first = mtj.get();
+    mtj->addColumn<int>("col");
+    for (std::size_t i = 0; i < 10; ++i) {
+      auto ts = mtj->makeTrackState(TrackStatePropMask::All);
+      ts.template component<int>("col") = static_cast<int>(i);
+    }
+    BOOST_CHECK_EQUAL(mtj->size(), 10u);
+  }
+  BOOST_CHECK_EQUAL(pool.size(), 1u);
+
+  auto mtj = pool.acquire();
+  BOOST_CHECK_EQUAL(pool.size(), 0u);
+  BOOST_CHECK_EQUAL(mtj.get(), first);
+  BOOST_CHECK_EQUAL(mtj->size(), 0u);
+  // dynamic columns survive the reuse
+  BOOST_CHECK(mtj->hasColumn(hashString("col")));
+
+  // a second container is created if the pool is empty
+  auto other = pool.acquire();
+  BOOST_CHECK_NE(other.get(), mtj.get());
+}
+
+BOOST_AUTO_TEST_CASE(MakeConstReturnsStorage) {
+  ContainerPool<VectorTrackContainer> trackPool;
+  ContainerPool<VectorMultiTrajectory> statePool;
+
+  const VectorMultiTrajectory* first = nullptr;
+  {
+    auto vtc = trackPool.acquire();
+    auto mtj = statePool.acquire();
+    first = mtj.get();
+
+    TrackContainer tc{vtc, mtj};
+    auto track = tc.makeTrack();
+    for (std::size_t i = 0; i < 5; ++i) {
+      track.appendTrackState();
+    }
+    BOOST_CHECK_EQUAL(track.nTrackStates(), 5u);
+
+    auto constVtc =
+        ContainerPool<VectorTrackContainer>::makeConst<
+            ConstVectorTrackContainer>(vtc);
+    auto constMtj =
+        ContainerPool<VectorMultiTrajectory>::makeConst<
+            ConstVectorMultiTrajectory>(mtj);
+
+    TrackContainer constTc{constVtc, constMtj};
+    BOOST_CHECK_EQUAL(constTc.size(), 1u);
+    BOOST_CHECK_EQUAL(constTc.getTrack(0).nTrackStates(), 5u);
+    BOOST_CHECK_EQUAL(mtj->size(), 0u);
+
+    // still referenced by the read-only containers
+    tc = TrackContainer{trackPool.acquire(), statePool.acquire()};
+    vtc.reset();
+    mtj.reset();
+    BOOST_CHECK_EQUAL(statePool.size(), 0u);
+  }
+  // the temporary containers and the ones used for the read-only containers
+  BOOST_CHECK_EQUAL(trackPool.size(), 2u);
+  BOOST_CHECK_EQUAL(statePool.size(), 2u);
+
+  std::vector<std::shared_ptr<VectorMultiTrajectory>> reused;
+  reused.push_back(statePool.acquire());
+  reused.push_back(statePool.acquire());
+  BOOST_CHECK_EQUAL(statePool.size(), 0u);
+  bool found = false;
+  for (const auto& mtj : reused) {
+    BOOST_CHECK_EQUAL(mtj->size(), 0u);
+    found |= (mtj.get() == first);
+  }
+  BOOST_CHECK(found);
+}
+
+BOOST_AUTO_TEST_CASE(PoolDestroyedFirst) {
+  std::shared_ptr<VectorMultiTrajectory> mtj;
+  {
+    ContainerPool<VectorMultiTrajectory> pool;
+    mtj = pool.acquire();
+  }
+  mtj->makeTrackState(TrackStatePropMask::All);
+  // releasing the container after the pool is gone deletes it
+  mtj.reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,7 @@
 
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/ProxyAccessor.hpp"
+#include "Acts/EventData/TrackSelectionView.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
 #include "Acts/Surfaces/CurvilinearSurface.hpp"
@@ -18,6 +19,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <vector>
 
 using namespace Acts;
 using namespace Acts::HashedStringLiteral;
@@ -467,4 +469,154 @@ BOOST_AUTO_TEST_CASE(CopyTrackProxyCalibrated) {
   BOOST_CHECK_EQUAL(ts.calibratedSize(), tsCopy.calibratedSize());
 }
 
+namespace {
+
+/// Append a track state with distinct content, optionally sharing the
+/// predicted parameters of another state
+template <typename track_proxy_t>
+auto appendFilledState(track_proxy_t& track, double value,
+                       std::optional<IndexType> sharePredicted = {}) {
+  auto mask = TrackStatePropMask::Filtered | TrackStatePropMask::Calibrated;
+  if (!sharePredicted.has_value()) {
+    mask |= TrackStatePropMask::Predicted;
+  }
+  auto ts = track.appendTrackState(mask);
+  if (sharePredicted.has_value()) {
+    ts.shareFrom(track.container().trackStateContainer().getTrackState(
+                     *sharePredicted),
+                 TrackStatePropMask::Predicted);
+  } else {
+    ts.predicted() = BoundVector::Constant(value);
+  }
+  ts.filtered() = BoundVector::Constant(value + 0.5);
+  ts.allocateCalibrated(2);
+  ts.template calibrated<2>() = Vector2::Constant(value);
+  ts.template calibratedCovariance<2>() = SquareMatrix2::Identity() * value;
+  ts.setSubspaceIndices(std::array{eBoundLoc0, eBoundLoc1});
+  ts.chi2() = value;
+  ts.template component<int, "stateTag"_hash>() = static_cast<int>(value);
+  return ts;
+}
+
+/// Summary of the content of the track states of a track
+template <typename track_proxy_t>
+std::vector<double> trackContent(const track_proxy_t& track) {
+  std::vector<double> content;
+  for (const auto ts : track.trackStatesReversed()) {
+    content.push_back(ts.predicted()[0]);
+    content.push_back(ts.filtered()[0]);
+    content.push_back(ts.template calibrated<2>()[1]);
+    content.push_back(ts.template calibratedCovariance<2>()(1, 1));
+    content.push_back(ts.chi2());
+    content.push_back(ts.template component<int, "stateTag"_hash>());
+  }
+  content.push_back(track.template component<int, "trackTag"_hash>());
+  return content;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(CompactTracks) {
+  VectorTrackContainer vtc{};
+  VectorMultiTrajectory mtj{};
+  TrackContainer tc{vtc, mtj};
+  tc.addColumn<int>("trackTag");
+  mtj.addColumn<int>("stateTag");
+
+  // a trunk with two branches, like in the combinatorial Kalman filter, and
+  // an unrelated track in between
+  auto trunk = tc.makeTrack();
+  trunk.component<int, "trackTag"_hash>() = 1;
+  appendFilledState(trunk, 1);
+  auto fork = appendFilledState(trunk, 2);
+
+  auto rejected = tc.makeTrack();
+  rejected.component<int, "trackTag"_hash>() = 2;
+  appendFilledState(rejected, 10);
+  appendFilledState(rejected, 11);
+
+  auto branch0 = tc.makeTrack();
+  branch0.component<int, "trackTag"_hash>() = 3;
+  branch0.tipIndex() = fork.index();
+  auto first = appendFilledState(branch0, 3);
+
+  auto branch1 = tc.makeTrack();
+  branch1.component<int, "trackTag"_hash>() = 4;
+  branch1.tipIndex() = fork.index();
+  appendFilledState(branch1, 4, first.index());
+
+  // a state which does not belong to any track
+  mtj.addTrackState(TrackStatePropMask::All);
+
+  // the unbranched trunk is not a result either
+  trunk.tipIndex() = MultiTrajectoryTraits::kInvalid;
+
+  const std::vector<double> expected0 = trackContent(branch0);
+  const std::vector<double> expected1 = trackContent(branch1);
+  BOOST_CHECK_EQUAL(mtj.size(), 7u);
+
+  tc.compact([](const auto& track) {
+    return track.template component<int, "trackTag"_hash>() > 2;
+  });
+
+  // the trunk is kept once for both branches
+  BOOST_REQUIRE_EQUAL(tc.size(), 2u);
+  BOOST_CHECK_EQUAL(mtj.size(), 4u);
+  const std::vector<double> content0 = trackContent(tc.getTrack(0));
+  const std::vector<double> content1 = trackContent(tc.getTrack(1));
+  BOOST_CHECK_EQUAL_COLLECTIONS(content0.begin(), content0.end(),
+                                expected0.begin(), expected0.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(content1.begin(), content1.end(),
+                                expected1.begin(), expected1.end());
+
+  // the prediction is still shared between the branches
+  auto tip0 = tc.getTrack(0).outermostTrackState();
+  auto tip1 = tc.getTrack(1).outermostTrackState();
+  BOOST_CHECK_EQUAL(tip0.previous(), tip1.previous());
+  tip0.predicted()[0] = 42;
+  BOOST_CHECK_EQUAL(tip1.predicted()[0], 42);
+
+  // compacting again does not change anything
+  tc.compact();
+  BOOST_CHECK_EQUAL(tc.size(), 2u);
+  BOOST_CHECK_EQUAL(mtj.size(), 4u);
+
+  // new states can be added after the compaction
+  auto track = tc.getTrack(0);
+  appendFilledState(track, 5);
+  BOOST_CHECK_EQUAL(track.nTrackStates(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(SelectTracksWithoutCopy) {
+  VectorTrackContainer vtc{};
+  VectorMultiTrajectory mtj{};
+  TrackContainer tc{vtc, mtj};
+
+  for (int i = 0; i < 4; ++i) {
+    auto track = tc.makeTrack();
+    track.chi2() = i;
+  }
+
+  TrackSelectionView selection(tc, {2, 0});
+  selection.add(3);
+  BOOST_CHECK_EQUAL(selection.size(), 3u);
+  BOOST_CHECK(!selection.empty());
+  BOOST_CHECK_EQUAL(&selection.tracks(), &tc);
+
+  std::vector<float> chi2;
+  for (const auto& track : selection) {
+    chi2.push_back(track.chi2());
+  }
+  const std::vector<float> expected = {2, 0, 3};
+  BOOST_CHECK_EQUAL_COLLECTIONS(chi2.begin(), chi2.end(), expected.begin(),
+                                expected.end());
+
+  // the selected tracks are the tracks of the container
+  BOOST_CHECK_EQUAL(selection.getTrack(1).index(), 0u);
+  tc.getTrack(2).chi2() = 7;
+  BOOST_CHECK_EQUAL(selection.getTrack(0).chi2(), 7);
+
+  BOOST_CHECK(TrackSelectionView(tc).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -15,6 +15,7 @@
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <array>
 #include <utility>
 
 namespace bdata = boost::unit_test::data;
@@ -69,6 +70,23 @@ BOOST_DATA_TEST_CASE(
   BOOST_CHECK_EQUAL(Btrue, BField.getField(pos, bCache).value());
   BOOST_CHECK_EQUAL(Btrue, BField.getField(Vector3(0, 0, 0), bCache).value());
   BOOST_CHECK_EQUAL(Btrue, BField.getField(-2 * pos, bCache).value());
+
+  std::array<Vector3, 3> positions = {pos, Vector3(0, 0, 0), -2 * pos};
+  std::array<Vector3, 3> fields{};
+  BOOST_CHECK(BField.getFields(positions, fields, bCache).ok());
+  for (const Vector3& field : fields) {
+    BOOST_CHECK_EQUAL(Btrue, field);
+  }
+
+  auto bCache2 = BField.makeCache(mfContext);
+  auto bCache3 = BField.makeCache(mfContext);
+  std::array<MagneticFieldProvider::Cache*, 3> caches = {&bCache, &bCache2,
+                                                         &bCache3};
+  std::array<Vector3, 3> cachedFields{};
+  BOOST_CHECK(BField.getFields(positions, cachedFields, caches).ok());
+  for (const Vector3& field : cachedFields) {
+    BOOST_CHECK_EQUAL(Btrue, field);
+  }
 }
 
 /// @brief unit test for update of constant magnetic field
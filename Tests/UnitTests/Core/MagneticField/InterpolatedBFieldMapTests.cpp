@@ -9,6 +9,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Definitions/Algebra.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
@@ -21,6 +22,7 @@
 #include "Acts/Utilities/detail/grid_helper.hpp"
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <optional>
@@ -124,6 +126,20 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
 
   ActsMatrix<3, 3> deriv;
 
+  // the gradient is bilinear-exact as well, with d(r)/d(x,y) = (x,y)/r
+  {
+    Vector3 field = b.getFieldGradient(pos, deriv, bCacheAny).value();
+    CHECK_CLOSE_REL(field, BField::value({{perp(pos), pos.z()}}), 1e-6);
+    double rr = perp(pos);
+    Vector3 dBdr(pos.z(), 3., 0.);
+    Vector3 dBdz(rr, 0., -2.);
+    ActsMatrix<3, 3> expected;
+    expected.col(0) = dBdr * pos.x() / rr;
+    expected.col(1) = dBdr * pos.y() / rr;
+    expected.col(2) = dBdz;
+    CHECK_CLOSE_ABS(deriv, expected, 1e-6);
+  }
+
   pos << 1, 1, -5.5;  // this position is outside the grid
   BOOST_CHECK(!b.isInside(pos));
   BOOST_CHECK(!b.getField(pos, bCacheAny).ok());
@@ -166,4 +182,248 @@ BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz) {
   BOOST_CHECK(c.isInside(transformPos((pos << 0, 2, -4.7).finished())));
   BOOST_CHECK(!c.isInside(transformPos((pos << 5, 2, 14.).finished())));
 }
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_xyz_gradient) {
+  // trilinear field, so interpolation and its derivative should be exact
+  auto value = [](const std::array<double, 3>& xyz) {
+    double x = xyz.at(0);
+    double y = xyz.at(1);
+    double z = xyz.at(2);
+    return Vector3(x * y, y * z - x, x * y * z + 2 * z);
+  };
+
+  auto transformPos = [](const Vector3& pos) { return pos; };
+  auto transformBField = [](const Vector3& field, const Vector3&) {
+    return field;
+  };
+  auto transformPosJacobian = [](const Vector3&) {
+    return ActsMatrix<3, 3>::Identity().eval();
+  };
+
+  Axis x(-4.0, 4.0, 4u);
+  Axis y(-3.0, 5.0, 4u);
+  Axis z(-5.0, 7.0, 6u);
+
+  Grid g(Type<Vector3>, std::move(x), std::move(y), std::move(z));
+
+  using Grid_t = decltype(g);
+  using BField_t = InterpolatedBFieldMap<Grid_t>;
+
+  for (std::size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (std::size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      for (std::size_t k = 1; k <= g.numLocalBins().at(2) + 1; ++k) {
+        Grid_t::index_t indices = {{i, j, k}};
+        g.atLocalBins(indices) = value(g.lowerLeftBinEdge(indices));
+      }
+    }
+  }
+
+  BField_t b{{transformPos, transformBField, std::move(g), 1.,
+              transformPosJacobian}};
+  auto bCacheAny = b.makeCache(mfContext);
+
+  for (const Vector3& pos :
+       {Vector3(-1.6, 2.5, 1.7), Vector3(0.3, -2.1, -4.2),
+        Vector3(1.9, 2.9, 4.9), Vector3(-3.5, 0., 0.)}) {
+    BOOST_CHECK(b.isInside(pos));
+
+    ActsMatrix<3, 3> deriv;
+    Vector3 field = b.getFieldGradient(pos, deriv, bCacheAny).value();
+    CHECK_CLOSE_ABS(field, value({pos.x(), pos.y(), pos.z()}), 1e-9);
+    CHECK_CLOSE_ABS(field, b.getField(pos, bCacheAny).value(), 1e-9);
+
+    ActsMatrix<3, 3> expected;
+    expected << pos.y(), pos.x(), 0,  //
+        -1, pos.z(), pos.y(),         //
+        pos.y() * pos.z(), pos.x() * pos.z(), pos.x() * pos.y() + 2;
+    CHECK_CLOSE_ABS(deriv, expected, 1e-9);
+  }
+
+  ActsMatrix<3, 3> deriv;
+  BOOST_CHECK(!b.getFieldGradient({0, 0, 8}, deriv, bCacheAny).ok());
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_rz_gradient) {
+  // same transformations as in fieldMapRZ, i.e. the field in (r,z) is rotated
+  // by phi into global coordinates
+  auto transformPos = [](const Vector3& pos) {
+    return Vector2(perp(pos), pos.z());
+  };
+  auto transformBField = [](const Vector2& field, const Vector3& pos) {
+    const double r = perp(pos);
+    return Vector3(field.x() * pos.x() / r, field.x() * pos.y() / r,
+                   field.y());
+  };
+
+  Axis r(0.0, 4.0, 4u);
+  Axis z(-5.0, 7.0, 6u);
+
+  Grid g(Type<Vector2>, std::move(r), std::move(z));
+
+  using Grid_t = decltype(g);
+  using BField_t = InterpolatedBFieldMap<Grid_t>;
+
+  for (std::size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (std::size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      Grid_t::index_t indices = {{i, j}};
+      const auto& llCorner = g.lowerLeftBinEdge(indices);
+      g.atLocalBins(indices) = Vector2(llCorner[0] * llCorner[1] + 0.5,
+                                       llCorner[0] - 2 * llCorner[1]);
+    }
+  }
+
+  // with the analytic jacobians, and with the finite difference fallback
+  BField_t analytic{{transformPos, transformBField, g, 1.,
+                     transformPosJacobianRZ, transformBFieldJacobianRZ}};
+  BField_t numeric{{transformPos, transformBField, std::move(g)}};
+
+  // central finite differences of the field, within one grid cell
+  auto finiteDifferences = [](const BField_t& b, const Vector3& pos) {
+    constexpr double h = 1e-6;
+    ActsMatrix<3, 3> deriv;
+    for (int j = 0; j < 3; ++j) {
+      Vector3 delta = Vector3::Zero();
+      delta[j] = h;
+      deriv.col(j) =
+          (b.getField(pos + delta).value() - b.getField(pos - delta).value()) /
+          (2 * h);
+    }
+    return deriv;
+  };
+
+  for (const Vector3& pos :
+       {Vector3(1.3, 2.1, 1.7), Vector3(-0.7, 1.9, -4.2),
+        Vector3(-2.1, -1.2, 4.9), Vector3(0.4, -0.9, 0.3)}) {
+    BOOST_TEST_CONTEXT("position " << pos.transpose()) {
+      const ActsMatrix<3, 3> expected = finiteDifferences(analytic, pos);
+      // the rotation by phi contributes off the x-z plane
+      BOOST_CHECK_GT(expected.block(0, 0, 2, 2).norm(), 1e-3);
+
+      for (const BField_t* b : {&analytic, &numeric}) {
+        auto bCacheAny = b->makeCache(mfContext);
+        ActsMatrix<3, 3> deriv;
+        Vector3 field = b->getFieldGradient(pos, deriv, bCacheAny).value();
+        CHECK_CLOSE_ABS(field, b->getField(pos).value(), 1e-12);
+        CHECK_CLOSE_ABS(deriv, expected, 1e-5);
+
+        // the gradient is interpolated from the cached field cell, which is
+        // reused for a second position in the same cell
+        const auto& bCache = bCacheAny.as<BField_t::Cache>();
+        BOOST_REQUIRE(bCache.fieldCell.has_value());
+        const Vector3 shifted = pos - Vector3(0, 0, 0.05);
+        BOOST_CHECK((*bCache.fieldCell).isInside(Vector2(perp(shifted),
+                                                         shifted.z())));
+        field = b->getFieldGradient(shifted, deriv, bCacheAny).value();
+        CHECK_CLOSE_ABS(field, b->getField(shifted).value(), 1e-12);
+        CHECK_CLOSE_ABS(deriv, finiteDifferences(*b, shifted), 1e-5);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_batch) {
+  auto transformPos = [](const Vector3& pos) {
+    return Vector2(perp(pos), pos.z());
+  };
+  auto transformBField = [](const Vector3& field, const Vector3&) {
+    return field;
+  };
+
+  Axis r(0.0, 4.0, 4u);
+  Axis z(-5, 7, 6u);
+
+  Grid g(Type<Vector3>, std::move(r), std::move(z));
+
+  using Grid_t = decltype(g);
+  using BField_t = InterpolatedBFieldMap<Grid_t>;
+
+  for (std::size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (std::size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      Grid_t::index_t indices = {{i, j}};
+      const auto& llCorner = g.lowerLeftBinEdge(indices);
+      g.atLocalBins(indices) =
+          Vector3(llCorner[0] * llCorner[1], 3 * llCorner[0], -llCorner[1]);
+    }
+  }
+
+  BField_t b{{transformPos, transformBField, std::move(g)}};
+  auto bCacheAny = b.makeCache(mfContext);
+  auto refCacheAny = b.makeCache(mfContext);
+
+  std::vector<Vector3> positions = {{-1.6, 2.5, 1.7},
+                                    {-1.5, 2.4, 1.8},
+                                    {0, 1.5, -2.5},
+                                    {2, 2.2, -4}};
+  std::vector<Vector3> fields(positions.size());
+  BOOST_CHECK(b.getFields(positions, fields, bCacheAny).ok());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    CHECK_CLOSE_REL(fields[i], b.getField(positions[i], refCacheAny).value(),
+                    1e-12);
+  }
+
+  // a single position outside of the map fails the whole batch
+  positions.emplace_back(1, 1, -5.5);
+  fields.resize(positions.size());
+  BOOST_CHECK(!b.getFields(positions, fields, bCacheAny).ok());
+}
+
+BOOST_AUTO_TEST_CASE(InterpolatedBFieldMap_batch_rz) {
+  auto transformPos = [](const Vector3& pos) {
+    return Vector2(perp(pos), pos.z());
+  };
+  auto transformBField = [](const Vector2& field, const Vector3& pos) {
+    const double r = perp(pos);
+    return Vector3(field.x() * pos.x() / r, field.x() * pos.y() / r,
+                   field.y());
+  };
+
+  Axis r(0.0, 4.0, 4u);
+  Axis z(-5.0, 7.0, 6u);
+
+  Grid g(Type<Vector2>, std::move(r), std::move(z));
+
+  using Grid_t = decltype(g);
+  using BField_t = InterpolatedBFieldMap<Grid_t>;
+
+  for (std::size_t i = 1; i <= g.numLocalBins().at(0) + 1; ++i) {
+    for (std::size_t j = 1; j <= g.numLocalBins().at(1) + 1; ++j) {
+      Grid_t::index_t indices = {{i, j}};
+      const auto& llCorner = g.lowerLeftBinEdge(indices);
+      g.atLocalBins(indices) = Vector2(llCorner[0] * llCorner[1] + 0.5,
+                                       llCorner[0] - 2 * llCorner[1]);
+    }
+  }
+
+  BField_t b{{transformPos, transformBField, std::move(g)}};
+  auto bCacheAny = b.makeCache(mfContext);
+  auto refCacheAny = b.makeCache(mfContext);
+
+  // positions in the same (r,z) cell at different phi share the field cell of
+  // the cache, exactly as in a sequence of single lookups
+  std::vector<Vector3> positions;
+  for (double phi : {0.1, 1.2, 2.5, -2.9, -0.4}) {
+    positions.emplace_back(2.3 * std::cos(phi), 2.3 * std::sin(phi), 1.7);
+  }
+  positions.emplace_back(-0.7, 1.9, -4.2);
+  std::vector<Vector3> fields(positions.size());
+  BOOST_CHECK(b.getFields(positions, fields, bCacheAny).ok());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    BOOST_CHECK_EQUAL(fields[i], b.getField(positions[i], refCacheAny).value());
+  }
+
+  // with one cache per position, each position gets its own field cell and
+  // the field is rotated to its own phi
+  std::vector<MagneticFieldProvider::Cache> caches;
+  std::vector<MagneticFieldProvider::Cache*> cachePtrs;
+  caches.reserve(positions.size());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    cachePtrs.push_back(&caches.emplace_back(b.makeCache(mfContext)));
+  }
+  std::vector<Vector3> cachedFields(positions.size());
+  BOOST_CHECK(b.getFields(positions, cachedFields, cachePtrs).ok());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    CHECK_CLOSE_REL(cachedFields[i], b.getField(positions[i]).value(), 1e-12);
+  }
+}
+
 }  // namespace Acts::Test
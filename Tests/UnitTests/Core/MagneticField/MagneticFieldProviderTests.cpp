@@ -10,6 +10,11 @@
 
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/MagneticField/NullBField.hpp"
+
+#include <array>
+#include <span>
+#include <stdexcept>
 
 namespace Acts::Test {
 
@@ -51,4 +56,29 @@ BOOST_AUTO_TEST_CASE(TypeErasedCacheType) {
   BOOST_CHECK(destructor_called);
 }
 
+BOOST_AUTO_TEST_CASE(DefaultBatchedLookup) {
+  // NullBField does not override the batched lookup
+  NullBField field;
+  auto cache = field.makeCache(mfContext);
+
+  std::array<Vector3, 2> positions = {Vector3(1, 2, 3), Vector3(-4, 5, 6)};
+  std::array<Vector3, 2> fields = {Vector3::Ones(), Vector3::Ones()};
+  BOOST_CHECK(field.getFields(positions, fields, cache).ok());
+  BOOST_CHECK_EQUAL(fields[0], Vector3::Zero());
+  BOOST_CHECK_EQUAL(fields[1], Vector3::Zero());
+
+  // one cache per position
+  auto otherCache = field.makeCache(mfContext);
+  std::array<MagneticFieldProvider::Cache*, 2> caches = {&cache, &otherCache};
+  fields = {Vector3::Ones(), Vector3::Ones()};
+  BOOST_CHECK(field.getFields(positions, fields, caches).ok());
+  BOOST_CHECK_EQUAL(fields[0], Vector3::Zero());
+  BOOST_CHECK_EQUAL(fields[1], Vector3::Zero());
+  BOOST_CHECK_THROW(
+      field.getFields(positions, fields,
+                      std::span<MagneticFieldProvider::Cache* const>(
+                          caches.data(), 1)),
+      std::invalid_argument);
+}
+
 }  // namespace Acts::Test
@@ -17,6 +17,8 @@
 
 #include <cstddef>
 #include <fstream>
+#include <stdexcept>
+#include <vector>
 
 using namespace Acts::UnitLiterals;
 
@@ -107,4 +109,48 @@ BOOST_AUTO_TEST_CASE(TestSolenoidBField) {
   // outf.close();
 }
 
+BOOST_AUTO_TEST_CASE(TestSolenoidBFieldBatch) {
+  MagneticFieldContext mfContext = MagneticFieldContext();
+
+  SolenoidBField::Config cfg{};
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField bField(cfg);
+
+  auto cache = bField.makeCache(mfContext);
+
+  std::vector<Vector3> positions;
+  for (std::size_t i = 0; i < 10; i++) {
+    positions.emplace_back(0.2_m * i, -0.1_m * i, 0.5_m * i - 2_m);
+  }
+  std::vector<Vector3> fields(positions.size());
+  BOOST_CHECK(bField.getFields(positions, fields, cache).ok());
+  for (std::size_t i = 0; i < positions.size(); i++) {
+    CHECK_CLOSE_ABS(fields[i], bField.getField(positions[i], cache).value(),
+                    1e-12_T);
+  }
+
+  // one cache per position
+  std::vector<MagneticFieldProvider::Cache> caches;
+  std::vector<MagneticFieldProvider::Cache*> cachePtrs;
+  caches.reserve(positions.size());
+  for (std::size_t i = 0; i < positions.size(); i++) {
+    cachePtrs.push_back(&caches.emplace_back(bField.makeCache(mfContext)));
+  }
+  std::vector<Vector3> cachedFields(positions.size());
+  BOOST_CHECK(bField.getFields(positions, cachedFields, cachePtrs).ok());
+  for (std::size_t i = 0; i < positions.size(); i++) {
+    BOOST_CHECK_EQUAL(cachedFields[i], fields[i]);
+  }
+
+  fields.pop_back();
+  BOOST_CHECK_THROW(bField.getFields(positions, fields, cache),
+                    std::invalid_argument);
+  cachePtrs.pop_back();
+  BOOST_CHECK_THROW(bField.getFields(positions, cachedFields, cachePtrs),
+                    std::invalid_argument);
+}
+
 }  // namespace Acts::Test
@@ -23,10 +23,13 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingGeometryBuilder.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
 #include "Acts/Material/HomogeneousVolumeMaterial.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
@@ -46,6 +49,8 @@
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
+#include "Acts/Utilities/Axis.hpp"
+#include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/UnitVectors.hpp"
@@ -55,6 +60,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -540,6 +546,130 @@ BOOST_AUTO_TEST_CASE(eigen_stepper_test) {
   BOOST_CHECK_EQUAL(res.error(), EigenStepperError::StepSizeAdjustmentFailed);
 }
 
+// Stepping several states at once in SIMD lanes gives the same result as
+// stepping them one by one
+BOOST_AUTO_TEST_CASE(eigen_stepper_batch_test) {
+  using StepperState = EigenStepper<>::State;
+
+  auto bField = std::make_shared<ConstantBField>(Vector3(0.1_T, 0.2_T, 2_T));
+  EigenStepper<> es(bField);
+
+  // Tracks with different momenta, directions, step sizes and options, which
+  // do not fit into a single batch of lanes
+  std::vector<PropState<StepperState>> single;
+  std::vector<PropState<StepperState>> batch;
+  for (int i = 0; i < 7; ++i) {
+    const Direction navDir =
+        (i % 3 == 0) ? Direction::Backward : Direction::Forward;
+    const double stepSize = (10. + 40. * i) * 1_mm;
+    const Vector3 dir = Vector3(1., 0.3 * i - 1., 0.1 * i).normalized();
+    const double charge = (i % 2 == 0) ? 1. : -1.;
+    const double absMom = (0.1 + 0.4 * i) * 1_GeV;
+    std::optional<Covariance> cov;
+    if (i != 4) {
+      cov = Covariance::Identity();
+    }
+    CurvilinearTrackParameters cp(Vector4(1. * i, 2., 3., 4.), dir,
+                                  charge / absMom, cov,
+                                  ParticleHypothesis::pion());
+
+    for (auto* states : {&single, &batch}) {
+      states->emplace_back(navDir,
+                           StepperState(tgContext, bField->makeCache(mfContext),
+                                        cp, stepSize));
+      auto& options = states->back().options.stepping;
+      options.stepTolerance = (i == 5) ? 1e-6 : 1e-4;
+      // a failing state must not affect the others
+      if (i == 2) {
+        options.stepTolerance = 1e-21;
+        options.maxRungeKuttaStepTrials = 0;
+      }
+    }
+  }
+
+  std::vector<Result<double>> singleResults;
+  for (auto& ps : single) {
+    singleResults.push_back(es.step(ps, mockNavigator));
+  }
+
+  std::vector<PropState<StepperState>*> batchStates;
+  std::vector<Result<double>> batchResults;
+  for (auto& ps : batch) {
+    batchStates.push_back(&ps);
+    batchResults.push_back(Result<double>::success(0.));
+  }
+  es.stepBatch(std::span<PropState<StepperState>* const>(batchStates),
+               mockNavigator, std::span(batchResults));
+
+  BOOST_CHECK(!singleResults[2].ok());
+  for (std::size_t i = 0; i < single.size(); ++i) {
+    BOOST_TEST_CONTEXT("state " << i) {
+      BOOST_REQUIRE_EQUAL(batchResults[i].ok(), singleResults[i].ok());
+      if (!singleResults[i].ok()) {
+        BOOST_CHECK_EQUAL(batchResults[i].error(), singleResults[i].error());
+        continue;
+      }
+      BOOST_CHECK_EQUAL(*batchResults[i], *singleResults[i]);
+
+      const StepperState& expected = single[i].stepping;
+      const StepperState& actual = batch[i].stepping;
+      BOOST_CHECK_EQUAL(actual.pars, expected.pars);
+      BOOST_CHECK_EQUAL(actual.jacTransport, expected.jacTransport);
+      BOOST_CHECK_EQUAL(actual.derivative, expected.derivative);
+      BOOST_CHECK_EQUAL(actual.pathAccumulated, expected.pathAccumulated);
+      BOOST_CHECK_EQUAL(actual.nSteps, expected.nSteps);
+      BOOST_CHECK_EQUAL(actual.nStepTrials, expected.nStepTrials);
+      BOOST_CHECK_EQUAL(actual.stepSize.accuracy(),
+                        expected.stepSize.accuracy());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(eigen_stepper_batch_field_map_test) {
+  // an interpolated (r,z) map, whose field has to be rotated in phi, and
+  // whose cached field cells are shared by consecutive steps
+  const double length = 5.8_m;
+  const double radius = 1.25_m;
+  auto bField = std::make_shared<InterpolatedBFieldMap<
+      Grid<Vector2, Axis<AxisType::Equidistant>,
+           Axis<AxisType::Equidistant>>>>(
+      solenoidFieldMap({0, 2 * radius}, {-length, length}, {150, 200},
+                       SolenoidBField({radius, length, 1154, 2_T})));
+
+  using Stepper = EigenStepper<>;
+  Propagator<Stepper> propagator{Stepper(bField)};
+  Propagator<Stepper>::Options<> options(tgContext, mfContext);
+  options.pathLimit = 1_m;
+
+  // tracks with different momenta take a different number of steps
+  std::vector<CurvilinearTrackParameters> starts;
+  for (int i = 0; i < 8; ++i) {
+    const double q = (i % 2 == 0) ? 1 : -1;
+    const double p = (0.5 + 1.3 * i) * 1_GeV;
+    const double phi = -M_PI + 0.8 * i;
+    const double theta = M_PI / 4 + 0.2 * i;
+    starts.emplace_back(Vector4::Zero(), phi, theta, q / p,
+                        Covariance::Identity(), ParticleHypothesis::pion());
+  }
+
+  auto batchResults = propagator.propagateBatch(starts, options);
+  BOOST_REQUIRE_EQUAL(batchResults.size(), starts.size());
+
+  for (std::size_t i = 0; i < starts.size(); ++i) {
+    BOOST_TEST_CONTEXT("track " << i) {
+      auto result = propagator.propagate(starts[i], options);
+      BOOST_REQUIRE(result.ok());
+      BOOST_REQUIRE(batchResults[i].ok());
+      BOOST_CHECK_EQUAL(batchResults[i]->steps, result->steps);
+      BOOST_CHECK_EQUAL(batchResults[i]->pathLength, result->pathLength);
+      BOOST_CHECK_EQUAL(batchResults[i]->endParameters->parameters(),
+                        result->endParameters->parameters());
+      BOOST_CHECK_EQUAL(*batchResults[i]->endParameters->covariance(),
+                        *result->endParameters->covariance());
+    }
+  }
+}
+
 /// @brief This function tests the EigenStepper with the EigenStepperDefaultExtension and
 /// the EigenStepperDenseExtension. The focus of this tests lies in
 /// the choosing of the right extension for the individual use case. This is
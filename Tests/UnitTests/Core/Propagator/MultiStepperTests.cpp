@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Direction.hpp"
 #include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/Charge.hpp"
 #include "Acts/EventData/GenericBoundTrackParameters.hpp"
 #include "Acts/EventData/MultiComponentTrackParameters.hpp"
@@ -18,20 +19,26 @@
 #include "Acts/EventData/detail/CorrectedTransformationFreeToBound.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/MagneticField/NullBField.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/EigenStepperDefaultExtension.hpp"
 #include "Acts/Propagator/MultiEigenStepperLoop.hpp"
+#include "Acts/Propagator/MultiEigenStepperSIMD.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Surfaces/CurvilinearSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Axis.hpp"
+#include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Intersection.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
 
 #include <algorithm>
 #include <array>
@@ -64,6 +71,7 @@ const MagneticFieldContext magCtx;
 const GeometryContext geoCtx;
 
 using MultiStepperLoop = MultiEigenStepperLoop<EigenStepperDefaultExtension>;
+using MultiStepperSIMD = MultiEigenStepperSIMD<>;
 using SingleStepper = EigenStepper<EigenStepperDefaultExtension>;
 
 const double defaultStepSize = 123.;
@@ -238,6 +246,10 @@ BOOST_AUTO_TEST_CASE(multi_stepper_state_no_cov) {
   test_multi_stepper_state<MultiStepperLoop, false>();
 }
 
+BOOST_AUTO_TEST_CASE(multi_stepper_state_no_cov_simd) {
+  test_multi_stepper_state<MultiStepperSIMD, false>();
+}
+
 template <typename multi_stepper_t>
 void test_multi_stepper_state_invalid() {
   using MultiState = typename multi_stepper_t::State;
@@ -254,6 +266,10 @@ BOOST_AUTO_TEST_CASE(multi_eigen_stepper_state_invalid) {
   test_multi_stepper_state_invalid<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(multi_eigen_stepper_state_invalid_simd) {
+  test_multi_stepper_state_invalid<MultiStepperSIMD>();
+}
+
 ////////////////////////////////////////////////////////////////////////
 // Compare the Multi-Stepper against the Eigen-Stepper for consistency
 ////////////////////////////////////////////////////////////////////////
@@ -321,6 +337,184 @@ BOOST_AUTO_TEST_CASE(multi_eigen_vs_single_eigen) {
   test_multi_stepper_vs_eigen_stepper<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(multi_eigen_vs_single_eigen_simd) {
+  test_multi_stepper_vs_eigen_stepper<MultiStepperSIMD>();
+}
+
+////////////////////////////////////////////////////////////////////
+// Compare the SIMD Multi-Stepper against the Loop Multi-Stepper for
+// components with different parameters
+////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(multi_eigen_simd_vs_loop) {
+  // Not a multiple of the number of lanes, so that one batch is partially
+  // filled
+  const std::size_t n = 7;
+  std::vector<std::tuple<double, BoundVector, std::optional<BoundSquareMatrix>>>
+      cmps;
+  for (std::size_t i = 0; i < n; ++i) {
+    BoundVector pars = BoundVector::Ones();
+    pars[eBoundPhi] = 0.1 * i;
+    pars[eBoundQOverP] = 1. / (1. + i);
+    cmps.push_back({1. / n, pars, BoundSquareMatrix::Identity()});
+  }
+
+  auto surface =
+      Acts::CurvilinearSurface(Vector3::Zero(), Vector3::Ones().normalized())
+          .planeSurface();
+
+  MultiComponentBoundTrackParameters multi_pars(surface, cmps,
+                                                particleHypothesis);
+
+  MultiStepperLoop::State loop_state(geoCtx, magCtx, defaultBField, multi_pars,
+                                     defaultStepSize);
+  MultiStepperSIMD::State simd_state(geoCtx, magCtx, defaultBField, multi_pars,
+                                     defaultStepSize);
+
+  MultiStepperLoop loop_stepper(defaultBField);
+  MultiStepperSIMD simd_stepper(defaultBField);
+
+  for (auto cmp : loop_stepper.componentIterable(loop_state)) {
+    cmp.status() = Acts::Intersection3D::Status::reachable;
+  }
+  for (auto cmp : simd_stepper.componentIterable(simd_state)) {
+    cmp.status() = Acts::Intersection3D::Status::reachable;
+  }
+
+  // Components on a surface are not stepped
+  loop_state.components[2].status = Acts::Intersection3D::Status::onSurface;
+  simd_state.components[2].status = Acts::Intersection3D::Status::onSurface;
+
+  // The large initial step size forces different numbers of step trials for
+  // the components
+  for (int i = 0; i < 10; ++i) {
+    auto loop_prop_state = DummyPropState(defaultNDir, loop_state);
+    auto loop_result = loop_stepper.step(loop_prop_state, mockNavigator);
+
+    auto simd_prop_state = DummyPropState(defaultNDir, simd_state);
+    auto simd_result = simd_stepper.step(simd_prop_state, mockNavigator);
+
+    BOOST_REQUIRE(loop_result.ok());
+    BOOST_REQUIRE(simd_result.ok());
+    BOOST_CHECK_EQUAL(*loop_result, *simd_result);
+    BOOST_CHECK_EQUAL(loop_state.pathAccumulated, simd_state.pathAccumulated);
+
+    BOOST_REQUIRE_EQUAL(loop_state.components.size(),
+                        simd_state.components.size());
+    for (std::size_t j = 0; j < n; ++j) {
+      const auto& loop_cmp = loop_state.components[j].state;
+      const auto& simd_cmp = simd_state.components[j].state;
+      BOOST_CHECK_EQUAL(loop_cmp.pars, simd_cmp.pars);
+      BOOST_CHECK_EQUAL(loop_cmp.jacTransport, simd_cmp.jacTransport);
+      BOOST_CHECK_EQUAL(loop_cmp.derivative, simd_cmp.derivative);
+      BOOST_CHECK_EQUAL(loop_cmp.pathAccumulated, simd_cmp.pathAccumulated);
+      BOOST_CHECK_EQUAL(loop_cmp.nStepTrials, simd_cmp.nStepTrials);
+      BOOST_CHECK_EQUAL(loop_cmp.stepSize.accuracy(),
+                        simd_cmp.stepSize.accuracy());
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+// Compare the SIMD Multi-Stepper in an interpolated (r,z) field map
+// against the Loop Multi-Stepper, which both use the cached field cells
+////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE(multi_eigen_simd_interpolated_rz) {
+  using namespace Acts::UnitLiterals;
+
+  // same transformations as in fieldMapRZ
+  auto transformPos = [](const Vector3 &pos) {
+    return Vector2(perp(pos), pos.z());
+  };
+  auto transformBField = [](const Vector2 &field, const Vector3 &pos) {
+    const double r = perp(pos);
+    return Vector3(field.x() * pos.x() / r, field.x() * pos.y() / r,
+                   field.y());
+  };
+
+  Grid grid(Type<Vector2>, Axis(0., 4_m, 40u), Axis(-4_m, 4_m, 80u));
+  using Grid_t = decltype(grid);
+  using BField_t = InterpolatedBFieldMap<Grid_t>;
+
+  // a solenoid-like field with a sizeable radial component
+  for (std::size_t i = 1; i <= grid.numLocalBins().at(0) + 1; ++i) {
+    for (std::size_t j = 1; j <= grid.numLocalBins().at(1) + 1; ++j) {
+      Grid_t::index_t indices = {{i, j}};
+      const auto &llCorner = grid.lowerLeftBinEdge(indices);
+      const double r = llCorner[0] / 1_m;
+      const double z = llCorner[1] / 1_m;
+      grid.atLocalBins(indices) =
+          Vector2(0.2_T * r * z, 2_T - 0.1_T * r - 0.05_T * z * z);
+    }
+  }
+
+  auto fieldMap = std::make_shared<const BField_t>(
+      BField_t::Config{transformPos, transformBField, std::move(grid)});
+
+  // Not a multiple of the number of lanes, and the components are spread in
+  // phi, so that the lanes are rotated differently in the same (r,z) cell
+  const std::size_t n = 7;
+  std::vector<std::tuple<double, BoundVector, std::optional<BoundSquareMatrix>>>
+      cmps;
+  for (std::size_t i = 0; i < n; ++i) {
+    BoundVector pars = BoundVector::Ones();
+    pars[eBoundPhi] = -1.5 + 0.5 * i;
+    pars[eBoundQOverP] = 1_e / ((1. + i) * 1_GeV);
+    cmps.push_back({1. / n, pars, BoundSquareMatrix::Identity()});
+  }
+
+  auto surface = Acts::CurvilinearSurface(Vector3(1_m, 0.5_m, 0.2_m),
+                                          Vector3::Ones().normalized())
+                     .planeSurface();
+
+  MultiComponentBoundTrackParameters multi_pars(surface, cmps,
+                                                particleHypothesis);
+
+  MultiStepperLoop::State loop_state(geoCtx, magCtx, fieldMap, multi_pars,
+                                     defaultStepSize);
+  MultiStepperSIMD::State simd_state(geoCtx, magCtx, fieldMap, multi_pars,
+                                     defaultStepSize);
+
+  MultiStepperLoop loop_stepper(fieldMap);
+  MultiStepperSIMD simd_stepper(fieldMap);
+
+  for (auto cmp : loop_stepper.componentIterable(loop_state)) {
+    cmp.status() = Acts::Intersection3D::Status::reachable;
+  }
+  for (auto cmp : simd_stepper.componentIterable(simd_state)) {
+    cmp.status() = Acts::Intersection3D::Status::reachable;
+  }
+
+  for (int i = 0; i < 10; ++i) {
+    auto loop_prop_state = DummyPropState(defaultNDir, loop_state);
+    auto loop_result = loop_stepper.step(loop_prop_state, mockNavigator);
+
+    auto simd_prop_state = DummyPropState(defaultNDir, simd_state);
+    auto simd_result = simd_stepper.step(simd_prop_state, mockNavigator);
+
+    BOOST_REQUIRE(loop_result.ok());
+    BOOST_REQUIRE(simd_result.ok());
+    BOOST_CHECK_EQUAL(*loop_result, *simd_result);
+
+    BOOST_REQUIRE_EQUAL(loop_state.components.size(),
+                        simd_state.components.size());
+    for (std::size_t j = 0; j < n; ++j) {
+      const auto &loop_cmp = loop_state.components[j].state;
+      const auto &simd_cmp = simd_state.components[j].state;
+      BOOST_CHECK_EQUAL(loop_cmp.pars, simd_cmp.pars);
+      BOOST_CHECK_EQUAL(loop_cmp.jacTransport, simd_cmp.jacTransport);
+      BOOST_CHECK_EQUAL(loop_cmp.stepData.B_last, simd_cmp.stepData.B_last);
+      BOOST_CHECK_EQUAL(loop_cmp.nStepTrials, simd_cmp.nStepTrials);
+    }
+  }
+
+  // the components have moved through the field map
+  for (const auto &cmp : simd_state.components) {
+    BOOST_CHECK_NE(cmp.state.pathAccumulated, 0.);
+    BOOST_CHECK_GT(cmp.state.stepData.B_last.head<2>().norm(), 0.);
+  }
+}
+
 /////////////////////////////
 // Test stepsize accessors
 /////////////////////////////
@@ -411,6 +605,10 @@ BOOST_AUTO_TEST_CASE(multi_eigen_component_iterable_with_modification) {
   test_components_modifying_accessors<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(multi_eigen_component_iterable_with_modification_simd) {
+  test_components_modifying_accessors<MultiStepperSIMD>();
+}
+
 /////////////////////////////////////////////
 // Test if the surface status update works
 /////////////////////////////////////////////
@@ -522,6 +720,10 @@ BOOST_AUTO_TEST_CASE(test_surface_status_and_cmpwise_bound_state) {
   test_multi_stepper_surface_status_update<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(test_surface_status_and_cmpwise_bound_state_simd) {
+  test_multi_stepper_surface_status_update<MultiStepperSIMD>();
+}
+
 //////////////////////////////////
 // Test Bound state computations
 //////////////////////////////////
@@ -605,6 +807,10 @@ BOOST_AUTO_TEST_CASE(test_component_wise_bound_state) {
   test_component_bound_state<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(test_component_wise_bound_state_simd) {
+  test_component_bound_state<MultiStepperSIMD>();
+}
+
 template <typename multi_stepper_t>
 void test_combined_bound_state_function() {
   using MultiState = typename multi_stepper_t::State;
@@ -648,6 +854,10 @@ BOOST_AUTO_TEST_CASE(test_combined_bound_state) {
   test_combined_bound_state_function<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(test_combined_bound_state_simd) {
+  test_combined_bound_state_function<MultiStepperSIMD>();
+}
+
 //////////////////////////////////////////////////
 // Test the combined curvilinear state function
 //////////////////////////////////////////////////
@@ -694,6 +904,10 @@ BOOST_AUTO_TEST_CASE(test_curvilinear_state) {
   test_combined_curvilinear_state_function<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(test_curvilinear_state_simd) {
+  test_combined_curvilinear_state_function<MultiStepperSIMD>();
+}
+
 ////////////////////////////////////
 // Test single component interface
 ////////////////////////////////////
@@ -750,6 +964,10 @@ BOOST_AUTO_TEST_CASE(test_single_component_interface) {
   test_single_component_interface_function<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(test_single_component_interface_simd) {
+  test_single_component_interface_function<MultiStepperSIMD>();
+}
+
 //////////////////////////////
 // Remove and add components
 //////////////////////////////
@@ -785,6 +1003,10 @@ BOOST_AUTO_TEST_CASE(remove_add_components_test) {
   remove_add_components_function<MultiStepperLoop>();
 }
 
+BOOST_AUTO_TEST_CASE(remove_add_components_test_simd) {
+  remove_add_components_function<MultiStepperSIMD>();
+}
+
 //////////////////////////////////////////////////
 // Instantiate a Propagator with the MultiStepper
 //////////////////////////////////////////////////
@@ -826,3 +1048,7 @@ void propagator_instatiation_test_function() {
 BOOST_AUTO_TEST_CASE(propagator_instatiation_test) {
   propagator_instatiation_test_function<MultiStepperLoop>();
 }
+
+BOOST_AUTO_TEST_CASE(propagator_instatiation_test_simd) {
+  propagator_instatiation_test_function<MultiStepperSIMD>();
+}
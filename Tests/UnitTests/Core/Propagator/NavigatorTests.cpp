@@ -21,10 +21,14 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/Propagator/ActorList.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StepperConcept.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Propagator/SurfaceCollector.hpp"
 #include "Acts/Surfaces/BoundaryTolerance.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
@@ -34,14 +38,17 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <string>
 #include <system_error>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 namespace Acts {
 class Layer;
@@ -635,4 +642,98 @@ BOOST_AUTO_TEST_CASE(Navigator_target_methods) {
             << toString(state.stepping.pos4));
 }
 
+BOOST_AUTO_TEST_CASE(Navigator_candidate_cache) {
+  using StraightPropagator = Propagator<StraightLineStepper, Navigator>;
+  using Collector = SurfaceCollector<SurfaceSelector>;
+
+  auto makePropagator = [](bool cacheCandidates) {
+    Navigator::Config navCfg;
+    navCfg.trackingGeometry = tGeometry;
+    navCfg.cacheCandidates = cacheCandidates;
+    return StraightPropagator(StraightLineStepper(), Navigator(navCfg));
+  };
+  StraightPropagator propagator = makePropagator(false);
+  StraightPropagator cachedPropagator = makePropagator(true);
+
+  // propagate with and without the cache and accumulate the cache statistics
+  Navigator::Statistics statistics;
+  auto checkTrack = [&](const Vector4& position, double phi, double theta,
+                        double pathLimit) {
+    BOOST_TEST_CONTEXT("position " << position.transpose() << " phi " << phi
+                                   << " theta " << theta << " path limit "
+                                   << pathLimit) {
+      CurvilinearTrackParameters start(position, phi, theta, 1 / 1_GeV,
+                                       std::nullopt,
+                                       ParticleHypothesis::pion());
+
+      StraightPropagator::Options<ActorList<Collector>> options(tgContext,
+                                                                mfContext);
+      options.pathLimit = pathLimit;
+
+      auto result = propagator.propagate(start, options);
+      BOOST_REQUIRE(result.ok());
+      const auto& expected = result->get<Collector::result_type>().collected;
+
+      auto state = cachedPropagator.makeState(start, options);
+      BOOST_REQUIRE(cachedPropagator.propagate(state).ok());
+      const auto& collected = state.get<Collector::result_type>().collected;
+
+      // the cache must not change the navigation
+      BOOST_REQUIRE_EQUAL(collected.size(), expected.size());
+      for (std::size_t j = 0; j < collected.size(); ++j) {
+        BOOST_CHECK_EQUAL(collected[j].surface, expected[j].surface);
+      }
+
+      statistics.nCandidateCacheHits +=
+          state.navigation.statistics.nCandidateCacheHits;
+      statistics.nCandidateCacheMisses +=
+          state.navigation.statistics.nCandidateCacheMisses;
+      return expected.size();
+    }
+    return std::size_t{0};
+  };
+
+  // tracks from the origin in a narrow cone share the cached candidates
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> phiDist(0.1, 0.12);
+  std::uniform_real_distribution<double> thetaDist(1.5, 1.52);
+  for (std::size_t i = 0; i < 20; ++i) {
+    BOOST_CHECK_GT(checkTrack(Vector4::Zero(), phiDist(rng), thetaDist(rng),
+                              2_m),
+                   0u);
+  }
+
+  // the first track fills the cache, the others reuse it
+  BOOST_CHECK_GT(statistics.nCandidateCacheMisses, 0u);
+  BOOST_CHECK_GT(statistics.nCandidateCacheHits, 0u);
+  BOOST_CHECK_GT(statistics.candidateCacheHitRate(), 0.5);
+
+  // a short track must not limit the candidates of a longer one in the same
+  // direction and vice versa
+  const std::size_t nShort = checkTrack(Vector4::Zero(), 0.11, 1.51, 100_mm);
+  const std::size_t nLong = checkTrack(Vector4::Zero(), 0.11, 1.51, 2_m);
+  BOOST_CHECK_LT(nShort, nLong);
+  BOOST_CHECK_EQUAL(checkTrack(Vector4::Zero(), 0.11, 1.51, 100_mm), nShort);
+
+  // displaced tracks in the same direction as the tracks from the origin
+  std::uniform_real_distribution<double> displacementDist(-50_mm, 50_mm);
+  for (std::size_t i = 0; i < 20; ++i) {
+    const Vector4 position(displacementDist(rng), displacementDist(rng),
+                           10 * displacementDist(rng), 0.);
+    checkTrack(position, phiDist(rng), thetaDist(rng), 2_m);
+  }
+
+  // tracks starting between the layers in all directions
+  std::uniform_real_distribution<double> radiusDist(30_mm, 150_mm);
+  std::uniform_real_distribution<double> anglePhiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> angleThetaDist(0.3, M_PI - 0.3);
+  for (std::size_t i = 0; i < 50; ++i) {
+    const double r = radiusDist(rng);
+    const double posPhi = anglePhiDist(rng);
+    const Vector4 position(r * std::cos(posPhi), r * std::sin(posPhi),
+                           10 * displacementDist(rng), 0.);
+    checkTrack(position, anglePhiDist(rng), angleThetaDist(rng), 2_m);
+  }
+}
+
 }  // namespace Acts::Test
@@ -0,0 +1,149 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ActorList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/PropagationProfiler.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <sstream>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts::Test {
+
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+CylindricalTrackingGeometry cGeometry(tgContext);
+auto tGeometry = cGeometry();
+
+using ProfiledPropagator = Propagator<EigenStepper<>, Navigator>;
+using ProfiledOptions = ProfiledPropagator::Options<
+    ActorList<PropagationProfiler, EndOfWorldReached>>;
+
+ProfiledPropagator makePropagator() {
+  auto bField = std::make_shared<ConstantBField>(Vector3(0, 0, 2_T));
+  return ProfiledPropagator(EigenStepper<>(bField), Navigator({tGeometry}));
+}
+
+CurvilinearTrackParameters makeStart(std::size_t i) {
+  const double phi = -M_PI + 0.3 * i;
+  const double theta = M_PI / 2 - 0.05 * i;
+  const double q = (i % 2 == 0) ? 1 : -1;
+  return CurvilinearTrackParameters(Vector4::Zero(), phi, theta, q / 1_GeV,
+                                    std::nullopt, ParticleHypothesis::pion());
+}
+
+BOOST_AUTO_TEST_SUITE(PropagationProfilerTests)
+
+BOOST_AUTO_TEST_CASE(ProfileSteps) {
+  ProfiledPropagator propagator = makePropagator();
+
+  PropagationProfile profile;
+  ProfiledOptions options(tgContext, mfContext);
+  options.actorList.get<PropagationProfiler>().profile = &profile;
+  options.stepping.maxStepSize = 10_cm;
+
+  const std::size_t nTracks = 20;
+  std::size_t steps = 0;
+  for (std::size_t i = 0; i < nTracks; ++i) {
+    auto result = propagator.propagate(makeStart(i), options);
+    BOOST_REQUIRE(result.ok());
+    steps += result->steps;
+  }
+
+  BOOST_CHECK_EQUAL(profile.propagations(), nTracks);
+
+  // the aborting step of each propagation is not counted in the result
+  const PropagationProfile::VolumeCost total = profile.total();
+  BOOST_CHECK_EQUAL(total.steps, steps + nTracks);
+  BOOST_CHECK_EQUAL(
+      std::accumulate(total.limits.begin(), total.limits.end(), 0u),
+      total.steps);
+  BOOST_CHECK_GT(total.pathLength, 0);
+  BOOST_CHECK_GT(total.time.count(), 0);
+  BOOST_CHECK_LE(total.retargets,
+                 total.limit(PropagationProfile::StepLimit::actor));
+
+  // the navigation limits steps and the tracks cross several volumes
+  BOOST_CHECK_GT(total.limit(PropagationProfile::StepLimit::actor), 0u);
+  auto volumes = profile.volumes();
+  BOOST_CHECK_GT(volumes.size(), 1u);
+  for (std::size_t i = 1; i < volumes.size(); ++i) {
+    BOOST_CHECK_GE(volumes[i - 1].second.time, volumes[i].second.time);
+  }
+
+  std::stringstream table;
+  table << profile;
+  BOOST_CHECK_NE(table.str().find("total"), std::string::npos);
+
+  profile.clear();
+  BOOST_CHECK_EQUAL(profile.propagations(), 0u);
+  BOOST_CHECK_EQUAL(profile.total().steps, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(ProfileStepLimit) {
+  ProfiledPropagator propagator = makePropagator();
+
+  PropagationProfile profile;
+  ProfiledOptions options(tgContext, mfContext);
+  options.actorList.get<PropagationProfiler>().profile = &profile;
+  options.maxSteps = 3;
+
+  // propagations which run into the step limit are still profiled
+  auto result = propagator.propagate(makeStart(0), options);
+  BOOST_CHECK(!result.ok());
+  BOOST_CHECK_EQUAL(profile.propagations(), 1u);
+  BOOST_CHECK_EQUAL(profile.total().steps, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(ProfileUser) {
+  ProfiledPropagator propagator = makePropagator();
+
+  PropagationProfile profile;
+  ProfiledOptions options(tgContext, mfContext);
+  options.actorList.get<PropagationProfiler>().profile = &profile;
+  options.stepping.maxStepSize = 1_mm;
+  options.pathLimit = 5_cm;
+
+  // small user steps limit most steps, the path limit only the last one
+  auto result = propagator.propagate(makeStart(0), options);
+  BOOST_REQUIRE(result.ok());
+  const PropagationProfile::VolumeCost total = profile.total();
+  BOOST_CHECK_GT(total.limit(PropagationProfile::StepLimit::user),
+                 total.steps / 2);
+  BOOST_CHECK_EQUAL(total.limit(PropagationProfile::StepLimit::aborter), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ProfilerWithoutProfile) {
+  ProfiledPropagator propagator = makePropagator();
+
+  ProfiledOptions options(tgContext, mfContext);
+  auto result = propagator.propagate(makeStart(0), options);
+  BOOST_REQUIRE(result.ok());
+  BOOST_CHECK(result->get<PropagationProfiler::result_type>().volumes.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
@@ -26,6 +26,7 @@
 #include "Acts/Propagator/EigenStepperDenseExtension.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
 #include "Acts/Propagator/StandardAborters.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Surfaces/CurvilinearSurface.hpp"
@@ -48,6 +49,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace Acts {
 class Logger;
@@ -383,6 +385,55 @@ BOOST_DATA_TEST_CASE(
   }
 }
 
+BOOST_AUTO_TEST_CASE(BatchPropagation) {
+  using OptionsType = EigenPropagatorType::Options<>;
+  OptionsType options(tgContext, mfContext);
+  options.pathLimit = 25_cm;
+  options.stepping.maxStepSize = 1_cm;
+
+  // tracks with different momenta take a different number of steps
+  std::vector<CurvilinearTrackParameters> starts;
+  for (int i = 0; i < 10; ++i) {
+    const double q = (i % 2 == 0) ? 1 : -1;
+    const double p = (0.2 + 0.5 * i) * 1_GeV;
+    const double phi = -M_PI + 0.6 * i;
+    Covariance cov = Covariance::Identity();
+    starts.emplace_back(Vector4::Zero(), phi, M_PI / 2 - 0.1 * i, q / p, cov,
+                        ParticleHypothesis::pion());
+  }
+
+  auto batchResults = epropagator.propagateBatch(starts, options);
+  BOOST_REQUIRE_EQUAL(batchResults.size(), starts.size());
+
+  for (std::size_t i = 0; i < starts.size(); ++i) {
+    auto result = epropagator.propagate(starts[i], options);
+    BOOST_REQUIRE(result.ok());
+    BOOST_REQUIRE(batchResults[i].ok());
+    BOOST_CHECK_EQUAL(batchResults[i]->steps, result->steps);
+    BOOST_CHECK_EQUAL(batchResults[i]->pathLength, result->pathLength);
+    BOOST_CHECK_EQUAL(batchResults[i]->endParameters->parameters(),
+                      result->endParameters->parameters());
+    BOOST_CHECK_EQUAL(*batchResults[i]->endParameters->covariance(),
+                      *result->endParameters->covariance());
+  }
+
+  // states which fail drop out without affecting the others
+  OptionsType limitedOptions = options;
+  limitedOptions.maxSteps = 3;
+  std::vector states = {epropagator.makeState(starts[0], options),
+                        epropagator.makeState(starts[1], limitedOptions),
+                        epropagator.makeState(starts[2], options)};
+  auto propagationResults = epropagator.propagateBatch(states);
+  BOOST_REQUIRE_EQUAL(propagationResults.size(), 3u);
+  BOOST_CHECK(propagationResults[0].ok());
+  BOOST_CHECK(!propagationResults[1].ok());
+  BOOST_CHECK_EQUAL(propagationResults[1].error(),
+                    PropagatorError::StepCountLimitReached);
+  BOOST_CHECK_EQUAL(states[1].steps, 3u);
+  BOOST_CHECK(propagationResults[2].ok());
+  BOOST_CHECK_EQUAL(states[2].steps, batchResults[2]->steps);
+}
+
 BOOST_AUTO_TEST_CASE(BasicPropagatorInterface) {
   auto field = std::make_shared<ConstantBField>(Vector3{0, 0, 2_T});
   EigenStepper<> eigenStepper{field};
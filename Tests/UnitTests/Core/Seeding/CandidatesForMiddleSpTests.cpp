@@ -175,4 +175,45 @@ BOOST_AUTO_TEST_CASE(CandidatesForMiddleSpObject) {
   BOOST_CHECK_EQUAL(container.nHighQualityCandidates(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(CandidatesForMiddleSpReusedStorage) {
+  using UnitTestSpacePoint = ::SpacePoint;
+  using value_t =
+      typename Acts::CandidatesForMiddleSp<UnitTestSpacePoint>::value_type;
+  UnitTestSpacePoint spacePoint;
+
+  Acts::CandidatesForMiddleSp<UnitTestSpacePoint> container;
+  container.setMaxElements(5, 3);
+
+  auto fill = [&]() {
+    for (int i(0); i < 7; ++i) {
+      container.push(spacePoint, spacePoint, spacePoint, 0.3f * i, 2.1, false);
+      container.push(spacePoint, spacePoint, spacePoint, 0.5f + i, 2.1, true);
+    }
+  };
+
+  fill();
+  std::vector<value_t> expected = container.storage();
+
+  std::vector<value_t> output;
+  fill();
+  container.storage(output);
+  BOOST_CHECK_EQUAL(container.nLowQualityCandidates(), 0);
+  BOOST_CHECK_EQUAL(container.nHighQualityCandidates(), 0);
+  BOOST_REQUIRE_EQUAL(output.size(), expected.size());
+  for (std::size_t i(0); i < output.size(); ++i) {
+    BOOST_CHECK_EQUAL(output[i].weight, expected[i].weight);
+    BOOST_CHECK_EQUAL(output[i].isQuality, expected[i].isQuality);
+  }
+
+  // the previous content is overwritten and the memory is reused
+  const value_t* data = output.data();
+  fill();
+  container.storage(output);
+  BOOST_CHECK_EQUAL(output.size(), expected.size());
+  BOOST_CHECK_EQUAL(output.data(), data);
+
+  container.storage(output);
+  BOOST_CHECK(output.empty());
+}
+
 }  // namespace Acts::Test
@@ -0,0 +1,258 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/Seed.hpp"
+#include "Acts/EventData/SpacePointContainer.hpp"
+#include "Acts/Seeding/BinnedGroup.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Seeding/SeedFinder.hpp"
+#include "Acts/Seeding/SeedFinderConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Utilities/GridBinFinder.hpp"
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <numbers>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "SpacePoint.hpp"
+#include "SpacePointContainer.hpp"
+
+// Count all heap allocations of this test by replacing the global allocation
+// functions
+
+namespace {
+std::atomic<std::size_t> nAllocations{0};
+}  // namespace
+
+void* operator new(std::size_t size) {
+  nAllocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+// GCC does not see that the memory of inlined new expressions comes from
+// malloc
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+#pragma GCC diagnostic pop
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts::Test {
+
+using SpacePointBackend =
+    ActsExamples::SpacePointContainer<std::vector<const ::SpacePoint*>>;
+using SpacePoints =
+    Acts::SpacePointContainer<SpacePointBackend, Acts::detail::RefHolder>;
+using Proxy = SpacePoints::SpacePointProxyType;
+using Grid = CylindricalSpacePointGrid<Proxy>;
+using Finder = SeedFinder<Proxy, Grid>;
+
+/// Hits of helices from the beam line on barrel layers and noise hits
+std::vector<::SpacePoint> makeSpacePoints() {
+  constexpr std::array<float, 7> layers = {33, 50, 72, 99, 122, 155, 180};
+  const float radiusPerPt = 1000 / (0.3 * 2);
+
+  std::mt19937 rng(4242);
+  std::uniform_real_distribution<float> phiDist(-std::numbers::pi,
+                                                std::numbers::pi);
+  std::uniform_real_distribution<float> cotThetaDist(-3, 3);
+  std::uniform_real_distribution<float> ptDist(0.5, 10);
+  std::uniform_real_distribution<float> zDist(-600, 600);
+  std::normal_distribution<float> z0Dist(0, 30);
+
+  std::vector<::SpacePoint> spacePoints;
+  auto add = [&](float r, float phi, float z) {
+    ::SpacePoint& sp = spacePoints.emplace_back();
+    sp.m_x = r * std::cos(phi);
+    sp.m_y = r * std::sin(phi);
+    sp.m_z = z;
+    sp.m_r = r;
+    sp.varianceR = 0.01;
+    sp.varianceZ = 0.01;
+  };
+
+  for (int i = 0; i < 300; ++i) {
+    const float phi0 = phiDist(rng);
+    const float cotTheta = cotThetaDist(rng);
+    const float z0 = z0Dist(rng);
+    const float radius = radiusPerPt * ptDist(rng);
+    const float charge = (i % 2 == 0) ? 1 : -1;
+    for (float r : layers) {
+      const float halfAngle = std::asin(r / (2 * radius));
+      add(r, phi0 - charge * halfAngle,
+          z0 + 2 * radius * halfAngle * cotTheta);
+    }
+  }
+  for (int i = 0; i < 500; ++i) {
+    add(layers[i % layers.size()], phiDist(rng), zDist(rng));
+  }
+  return spacePoints;
+}
+
+/// Seed the space points twice with the same state
+///
+/// @return the number of seeds and the number of allocations of the second
+///         iteration, and whether both iterations found the same seeds
+std::tuple<std::size_t, std::size_t, bool> seedTwice(bool seedConfirmation) {
+  std::vector<::SpacePoint> spacePoints = makeSpacePoints();
+  std::vector<const ::SpacePoint*> spacePointPtrs;
+  for (const ::SpacePoint& sp : spacePoints) {
+    spacePointPtrs.push_back(&sp);
+  }
+  SpacePointBackend backend(spacePointPtrs);
+  SpacePoints spContainer(SpacePointContainerConfig(),
+                          SpacePointContainerOptions(), backend);
+
+  SeedConfirmationRangeConfig confirmationRange;
+  confirmationRange.zMinSeedConf = -250_mm;
+  confirmationRange.zMaxSeedConf = 250_mm;
+  confirmationRange.rMaxSeedConf = 140_mm;
+  confirmationRange.nTopForLargeR = 1;
+  confirmationRange.nTopForSmallR = 2;
+
+  SeedFilterConfig filterCfg;
+  filterCfg.maxSeedsPerSpM = 2;
+  filterCfg.deltaRMin = 1_mm;
+  filterCfg.seedConfirmation = seedConfirmation;
+  filterCfg.centralSeedConfirmationRange = confirmationRange;
+  filterCfg.forwardSeedConfirmationRange = confirmationRange;
+  filterCfg.maxSeedsPerSpMConf = 5;
+  filterCfg.maxQualitySeedsPerSpMConf = 5;
+  filterCfg = filterCfg.toInternalUnits();
+
+  SeedFinderConfig<Proxy> finderCfg;
+  finderCfg.rMin = 0_mm;
+  finderCfg.rMax = 200_mm;
+  finderCfg.deltaRMin = 1_mm;
+  finderCfg.deltaRMax = 60_mm;
+  finderCfg.deltaRMinTopSP = finderCfg.deltaRMin;
+  finderCfg.deltaRMinBottomSP = finderCfg.deltaRMin;
+  finderCfg.deltaRMaxTopSP = finderCfg.deltaRMax;
+  finderCfg.deltaRMaxBottomSP = finderCfg.deltaRMax;
+  finderCfg.collisionRegionMin = -250_mm;
+  finderCfg.collisionRegionMax = 250_mm;
+  finderCfg.zMin = -2000_mm;
+  finderCfg.zMax = 2000_mm;
+  finderCfg.maxSeedsPerSpM = filterCfg.maxSeedsPerSpM;
+  finderCfg.cotThetaMax = 7.40627;
+  finderCfg.sigmaScattering = 5;
+  finderCfg.radLengthPerSeed = 0.1;
+  finderCfg.minPt = 500_MeV;
+  finderCfg.impactMax = 3_mm;
+  finderCfg.seedConfirmation = seedConfirmation;
+  finderCfg.centralSeedConfirmationRange = confirmationRange;
+  finderCfg.forwardSeedConfirmationRange = confirmationRange;
+
+  CylindricalSpacePointGridConfig gridCfg;
+  gridCfg.minPt = finderCfg.minPt;
+  gridCfg.rMax = finderCfg.rMax;
+  gridCfg.zMax = finderCfg.zMax;
+  gridCfg.zMin = finderCfg.zMin;
+  gridCfg.deltaRMax = finderCfg.deltaRMax;
+  gridCfg.cotThetaMax = finderCfg.cotThetaMax;
+  gridCfg = gridCfg.toInternalUnits();
+  CylindricalSpacePointGridOptions gridOptions;
+  gridOptions.bFieldInZ = 2_T;
+  gridOptions = gridOptions.toInternalUnits();
+
+  finderCfg.seedFilter = std::make_shared<SeedFilter<Proxy>>(filterCfg);
+  finderCfg = finderCfg.toInternalUnits().calculateDerivedQuantities();
+
+  SeedFinderOptions finderOptions;
+  finderOptions.bFieldInZ = 2_T;
+  finderOptions =
+      finderOptions.toInternalUnits().calculateDerivedQuantities(finderCfg);
+
+  GridBinFinder<3ul> bottomBinFinder(1, std::vector<std::pair<int, int>>(), 0);
+  GridBinFinder<3ul> topBinFinder(1, std::vector<std::pair<int, int>>(), 0);
+
+  Grid grid =
+      CylindricalSpacePointGridCreator::createGrid<Proxy>(gridCfg, gridOptions);
+  CylindricalSpacePointGridCreator::fillGrid(finderCfg, finderOptions, grid,
+                                             spContainer.begin(),
+                                             spContainer.end());
+  CylindricalBinnedGroup<Proxy> groups(std::move(grid), bottomBinFinder,
+                                       topBinFinder);
+
+  Finder finder(finderCfg);
+  Finder::SeedingState state;
+  const Range1D<float> rMiddleSPRange;
+
+  std::vector<Seed<Proxy>> seeds;
+  std::vector<const Proxy*> firstSeeds;
+  std::size_t allocations = 0;
+  for (int iteration = 0; iteration < 2; ++iteration) {
+    seeds.clear();
+    state.spacePointMutableData.resize(spContainer.size());
+    for (const auto [bottom, middle, top] : groups) {
+      const std::size_t before = nAllocations.load();
+      finder.createSeedsForGroup(finderOptions, state, groups.grid(), seeds,
+                                 bottom, middle, top, rMiddleSPRange);
+      allocations += nAllocations.load() - before;
+    }
+
+    if (iteration == 0) {
+      allocations = 0;
+      for (const Seed<Proxy>& seed : seeds) {
+        firstSeeds.insert(firstSeeds.end(), seed.sp().begin(),
+                          seed.sp().end());
+      }
+    }
+  }
+
+  bool sameSeeds = firstSeeds.size() == 3 * seeds.size();
+  for (std::size_t i = 0; sameSeeds && i < seeds.size(); ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      sameSeeds = sameSeeds && seeds[i].sp()[j] == firstSeeds[3 * i + j];
+    }
+  }
+  return {seeds.size(), allocations, sameSeeds};
+}
+
+BOOST_AUTO_TEST_SUITE(SeedFinderAllocation)
+
+BOOST_AUTO_TEST_CASE(NoAllocationsAfterWarmUp) {
+  const auto [nSeeds, allocations, sameSeeds] = seedTwice(false);
+  BOOST_CHECK_GT(nSeeds, 100u);
+  BOOST_CHECK(sameSeeds);
+  BOOST_CHECK_EQUAL(allocations, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(NoAllocationsAfterWarmUpWithSeedConfirmation) {
+  const auto [nSeeds, allocations, sameSeeds] = seedTwice(true);
+  BOOST_CHECK_GT(nSeeds, 100u);
+  BOOST_CHECK(sameSeeds);
+  BOOST_CHECK_EQUAL(allocations, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
@@ -20,11 +20,14 @@
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackProxy.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/EventData/TrackStateType.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
 #include "Acts/EventData/VectorTrackContainer.hpp"
 #include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Geometry/ApproachDescriptor.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/Layer.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
@@ -39,6 +42,8 @@
 #include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
 #include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/PackedMeasurements.hpp"
+#include "Acts/TrackFinding/PackedTrackStateCreator.hpp"
 #include "Acts/TrackFitting/GainMatrixSmoother.hpp"
 #include "Acts/TrackFitting/GainMatrixUpdater.hpp"
 #include "Acts/TrackFitting/KalmanFitter.hpp"
@@ -50,6 +55,7 @@
 #include "Acts/Utilities/Result.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
@@ -61,6 +67,7 @@
 #include <random>
 #include <string>
 #include <system_error>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -414,4 +421,310 @@ BOOST_AUTO_TEST_CASE(ZeroFieldBackward) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(OptionalJacobians) {
+  Fixture f(0_T);
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  auto countJacobians = [&](Acts::TrackStatePropMask optionalComponents) {
+    auto options = f.makeCkfOptions();
+    options.optionalTrackStateComponents = optionalComponents;
+    options.sourceLinkAccessor
+        .connect<&Fixture::TestSourceLinkAccessor::range>(&slAccessor);
+
+    TrackContainer tc{Acts::VectorTrackContainer{},
+                      Acts::VectorMultiTrajectory{}};
+    for (const auto& start : f.startParameters) {
+      auto res = f.ckf.findTracks(start, options, tc);
+      BOOST_REQUIRE(res.ok());
+    }
+    BOOST_CHECK_EQUAL(tc.size(), 3u);
+
+    std::size_t nStates = 0u;
+    std::size_t nJacobians = 0u;
+    for (const auto track : tc) {
+      BOOST_CHECK_EQUAL(track.nTrackStates(), f.detector.numMeasurements);
+      for (const auto trackState : track.trackStatesReversed()) {
+        nStates++;
+        nJacobians += trackState.hasJacobian() ? 1u : 0u;
+      }
+    }
+    BOOST_CHECK_GT(nStates, 0u);
+    return std::make_pair(nStates, nJacobians);
+  };
+
+  // by default every found track state keeps its Jacobian for the smoothing
+  auto [nStates, nJacobians] =
+      countJacobians(Acts::TrackStatePropMask::Jacobian);
+  BOOST_CHECK_EQUAL(nJacobians, nStates);
+
+  // without the optional components the Jacobians are not stored at all
+  std::tie(nStates, nJacobians) =
+      countJacobians(Acts::TrackStatePropMask::None);
+  BOOST_CHECK_EQUAL(nJacobians, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(BreadthFirstSingleBranch) {
+  Fixture f(0_T);
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  auto findTracks = [&](bool breadthFirst) {
+    auto options = f.makeCkfOptions();
+    options.breadthFirst = breadthFirst;
+    options.sourceLinkAccessor
+        .connect<&Fixture::TestSourceLinkAccessor::range>(&slAccessor);
+
+    TrackContainer tc{Acts::VectorTrackContainer{},
+                      Acts::VectorMultiTrajectory{}};
+    for (const auto& start : f.startParameters) {
+      auto res = f.ckf.findTracks(start, options, tc);
+      BOOST_REQUIRE(res.ok());
+    }
+    return tc;
+  };
+
+  // without branching both modes process the same single branch
+  const TrackContainer depthFirst = findTracks(false);
+  const TrackContainer breadthFirst = findTracks(true);
+  BOOST_REQUIRE_EQUAL(breadthFirst.size(), depthFirst.size());
+  for (std::size_t i = 0; i < depthFirst.size(); ++i) {
+    const auto expected = depthFirst.getTrack(i);
+    const auto track = breadthFirst.getTrack(i);
+    BOOST_CHECK_EQUAL(track.nMeasurements(), expected.nMeasurements());
+    BOOST_CHECK_EQUAL(track.nHoles(), expected.nHoles());
+    BOOST_CHECK_CLOSE(track.chi2(), expected.chi2(), 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BreadthFirstBranching) {
+  Fixture f(0_T);
+  // keep up to three measurements per surface, which creates many branches
+  f.measSel = Acts::MeasurementSelector(Acts::MeasurementSelector::Config{
+      {Acts::GeometryIdentifier(),
+       {{}, {std::numeric_limits<double>::max()}, {3u}}},
+  });
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  auto findTracks = [&](TrackContainer& tc, bool breadthFirst,
+                        std::size_t beamWidth, double maxChi2Difference,
+                        Acts::CombinatorialKalmanFilterStatistics& statistics) {
+    auto options = f.makeCkfOptions();
+    options.breadthFirst = breadthFirst;
+    options.beamWidth = beamWidth;
+    options.maxBranchChi2Difference = maxChi2Difference;
+    options.statistics = &statistics;
+    // depth-first propagates every branch through the whole detector
+    options.propagatorPlainOptions.maxSteps = 100000;
+    options.sourceLinkAccessor
+        .connect<&Fixture::TestSourceLinkAccessor::range>(&slAccessor);
+
+    auto res = f.ckf.findTracks(f.startParameters.at(0), options, tc);
+    BOOST_REQUIRE(res.ok());
+    return std::move(*res);
+  };
+
+  const double noCut = std::numeric_limits<double>::infinity();
+
+  TrackContainer tc{Acts::VectorTrackContainer{},
+                    Acts::VectorMultiTrajectory{}};
+
+  Acts::CombinatorialKalmanFilterStatistics depthFirstStatistics;
+  const auto depthFirst =
+      findTracks(tc, false, 5, noCut, depthFirstStatistics);
+  BOOST_CHECK_GT(depthFirst.size(), 5u);
+  BOOST_CHECK_EQUAL(depthFirstStatistics.savedSteps, 0u);
+
+  Acts::CombinatorialKalmanFilterStatistics statistics;
+  const auto tracks = findTracks(tc, true, 5, noCut, statistics);
+  BOOST_REQUIRE(!tracks.empty());
+  BOOST_CHECK_LE(tracks.size(), 5u);
+  BOOST_CHECK_LT(statistics.steps, depthFirstStatistics.steps);
+  BOOST_CHECK_GT(statistics.savedSteps, 0u);
+  BOOST_CHECK_GT(statistics.prunedBranches, 0u);
+
+  // the best branch is stored first and only has hits of the true track
+  const auto& best = tracks.front();
+  BOOST_CHECK_EQUAL(best.nMeasurements(), f.detector.numMeasurements);
+  for (const auto trackState : best.trackStatesReversed()) {
+    auto sl =
+        trackState.getUncalibratedSourceLink().template get<TestSourceLink>();
+    BOOST_CHECK_EQUAL(sl.sourceId, 0u);
+  }
+  for (const auto& track : tracks) {
+    BOOST_CHECK_GE(track.chi2(), best.chi2());
+  }
+
+  // a tight chi2 pruning keeps fewer branches
+  Acts::CombinatorialKalmanFilterStatistics prunedStatistics;
+  const auto pruned = findTracks(tc, true, 5, 1., prunedStatistics);
+  BOOST_REQUIRE(!pruned.empty());
+  BOOST_CHECK_LT(pruned.size(), tracks.size());
+  BOOST_CHECK_CLOSE(pruned.front().chi2(), best.chi2(), 1e-6);
+  BOOST_CHECK_LE(prunedStatistics.steps, statistics.steps);
+}
+
+BOOST_AUTO_TEST_CASE(BreadthFirstHolesAndMaterial) {
+  Fixture f(0_T);
+
+  // put material on an approach surface of the second layer, which is then
+  // visited without measurements and creates a material state
+  const Acts::Layer* layer =
+      f.detector.store.detectorStore.at(1)->surface().associatedLayer();
+  BOOST_REQUIRE(layer != nullptr && layer->approachDescriptor() != nullptr);
+  auto approachSurface = const_cast<Acts::Surface*>(
+      layer->approachDescriptor()->containedSurfaces().front());
+  approachSurface->assignSurfaceMaterial(f.detector.store.surfaceMaterial);
+
+  // keep the measurements of the first track only and remove one of them to
+  // create a hole
+  Fixture::TestSourceLinkContainer sourceLinks;
+  const auto holeId = Acts::GeometryIdentifier().setVolume(3).setLayer(4);
+  for (const auto& [geoId, sl] : f.sourceLinks) {
+    if (sl.sourceId == 0u && geoId.volume() == holeId.volume() &&
+        geoId.layer() == holeId.layer()) {
+      continue;
+    }
+    if (sl.sourceId == 0u) {
+      sourceLinks.emplace(geoId, sl);
+    }
+  }
+  BOOST_REQUIRE_EQUAL(sourceLinks.size(), f.detector.numMeasurements - 1);
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &sourceLinks;
+
+  auto findTracks = [&](bool breadthFirst) {
+    auto options = f.makeCkfOptions();
+    options.breadthFirst = breadthFirst;
+    options.sourceLinkAccessor
+        .connect<&Fixture::TestSourceLinkAccessor::range>(&slAccessor);
+
+    TrackContainer tc{Acts::VectorTrackContainer{},
+                      Acts::VectorMultiTrajectory{}};
+    auto res = f.ckf.findTracks(f.startParameters.at(0), options, tc);
+    BOOST_REQUIRE(res.ok());
+    BOOST_REQUIRE_EQUAL(tc.size(), 1u);
+    return tc;
+  };
+
+  const TrackContainer depthFirst = findTracks(false);
+  const TrackContainer breadthFirst = findTracks(true);
+
+  const auto expected = depthFirst.getTrack(0);
+  const auto track = breadthFirst.getTrack(0);
+  BOOST_CHECK_EQUAL(track.nMeasurements(), f.detector.numMeasurements - 1);
+  BOOST_CHECK_EQUAL(track.nHoles(), 1u);
+  BOOST_CHECK_EQUAL(track.nMeasurements(), expected.nMeasurements());
+  BOOST_CHECK_EQUAL(track.nHoles(), expected.nHoles());
+  BOOST_CHECK_CLOSE(track.chi2(), expected.chi2(), 1e-6);
+
+  // the hole and the material state only have predicted parameters, which
+  // are shared with the filtered ones
+  std::size_t nHoleStates = 0u;
+  std::size_t nMaterialStates = 0u;
+  for (const auto trackState : track.trackStatesReversed()) {
+    if (trackState.hasCalibrated()) {
+      continue;
+    }
+    BOOST_REQUIRE(trackState.hasPredicted());
+    BOOST_CHECK_EQUAL(trackState.parameters(), trackState.predicted());
+    if (trackState.typeFlags().test(Acts::TrackStateFlag::HoleFlag)) {
+      nHoleStates++;
+    } else if (trackState.typeFlags().test(
+                   Acts::TrackStateFlag::MaterialFlag)) {
+      nMaterialStates++;
+    }
+  }
+  BOOST_CHECK_EQUAL(nHoleStates, 1u);
+  BOOST_CHECK_GE(nMaterialStates, 1u);
+
+  // the filtered parameters after the hole and the material agree with the
+  // ones of the depth-first search
+  auto expectedState = expected.outermostTrackState();
+  auto trackState = track.outermostTrackState();
+  BOOST_REQUIRE(trackState.hasFiltered() && expectedState.hasFiltered());
+  BOOST_CHECK(trackState.filtered().isApprox(expectedState.filtered(), 1e-6));
+}
+
+BOOST_AUTO_TEST_CASE(PackedMeasurementSelection) {
+  Fixture f(0_T);
+  // keep up to two measurements per surface to compare the branching as well
+  f.measSel = Acts::MeasurementSelector(Acts::MeasurementSelector::Config{
+      {Acts::GeometryIdentifier(),
+       {{}, {std::numeric_limits<double>::max()}, {2u}}},
+  });
+
+  Fixture::TestSourceLinkAccessor slAccessor;
+  slAccessor.container = &f.sourceLinks;
+
+  // pack the measurements ordered by surface and in the order of the accessor
+  std::vector<Acts::GeometryIdentifier> surfaces;
+  for (const auto& [geoId, sl] : f.sourceLinks) {
+    surfaces.push_back(geoId);
+  }
+  std::sort(surfaces.begin(), surfaces.end());
+  surfaces.erase(std::unique(surfaces.begin(), surfaces.end()),
+                 surfaces.end());
+  Acts::PackedMeasurements packed;
+  for (const auto geoId : surfaces) {
+    auto [begin, end] = f.sourceLinks.equal_range(geoId);
+    for (auto it = begin; it != end; ++it) {
+      const TestSourceLink& sl = it->second;
+      const std::size_t size = (sl.indices[1] == Acts::eBoundSize) ? 1 : 2;
+      const std::array<std::uint8_t, 2> indices = {
+          static_cast<std::uint8_t>(sl.indices[0]),
+          static_cast<std::uint8_t>(sl.indices[1])};
+      packed.add(geoId, size, indices.data(), sl.parameters.data(),
+                 sl.covariance.data());
+    }
+  }
+  BOOST_CHECK_EQUAL(packed.size(), f.sourceLinks.size());
+
+  using PackedCreator =
+      Acts::PackedTrackStateCreator<Fixture::TestSourceLinkAccessor::Iterator,
+                                    TrackContainer>;
+  PackedCreator packedCreator;
+  packedCreator.calibrator.connect<
+      &testSourceLinkCalibrator<TrackStateContainerBackend>>();
+  packedCreator.measurementSelector = &f.measSel;
+  packedCreator.measurements = &packed;
+
+  auto findTracks = [&](bool usePacked) {
+    auto options = f.makeCkfOptions();
+    options.sourceLinkAccessor
+        .connect<&Fixture::TestSourceLinkAccessor::range>(&slAccessor);
+    if (usePacked) {
+      options.trackStateCandidateCreator
+          .connect<&PackedCreator::createSourceLinkTrackStates>(
+              &packedCreator);
+    }
+
+    TrackContainer tc{Acts::VectorTrackContainer{},
+                      Acts::VectorMultiTrajectory{}};
+    for (const auto& start : f.startParameters) {
+      auto res = f.ckf.findTracks(start, options, tc);
+      BOOST_REQUIRE(res.ok());
+    }
+    return tc;
+  };
+
+  // both candidate creators select the same measurements
+  const TrackContainer expected = findTracks(false);
+  const TrackContainer tracks = findTracks(true);
+  BOOST_CHECK_GT(expected.size(), f.startParameters.size());
+  BOOST_REQUIRE_EQUAL(tracks.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    const auto expectedTrack = expected.getTrack(i);
+    const auto track = tracks.getTrack(i);
+    BOOST_CHECK_EQUAL(track.nMeasurements(), expectedTrack.nMeasurements());
+    BOOST_CHECK_EQUAL(track.nOutliers(), expectedTrack.nOutliers());
+    BOOST_CHECK_CLOSE(track.chi2(), expectedTrack.chi2(), 1e-6);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,184 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/PackedMeasurements.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace Acts::Test {
+
+namespace {
+
+const auto surface0 = GeometryIdentifier().setVolume(1).setSensitive(1);
+const auto surface1 = GeometryIdentifier().setVolume(1).setSensitive(2);
+
+/// Reference chi2 with the full bound parameters and a projection matrix
+double referenceChi2(const std::vector<std::uint8_t>& indices,
+                     const ActsDynamicVector& value,
+                     const ActsDynamicMatrix& covariance,
+                     const BoundVector& predicted,
+                     const BoundSquareMatrix& predictedCovariance) {
+  ActsDynamicMatrix projector =
+      ActsDynamicMatrix::Zero(indices.size(), eBoundSize);
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    projector(i, indices[i]) = 1;
+  }
+  const ActsDynamicVector residual = value - projector * predicted;
+  const ActsDynamicMatrix s =
+      covariance + projector * predictedCovariance * projector.transpose();
+  return residual.dot(s.inverse() * residual);
+}
+
+BoundSquareMatrix randomCovariance(std::mt19937& rng) {
+  std::uniform_real_distribution<double> dist(-1, 1);
+  BoundSquareMatrix a;
+  for (std::size_t i = 0; i < eBoundSize * eBoundSize; ++i) {
+    a(i) = dist(rng);
+  }
+  return a * a.transpose() + BoundSquareMatrix::Identity();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PackedMeasurementsTests)
+
+BOOST_AUTO_TEST_CASE(Chi2MatchesProjection) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> dist(-1, 1);
+
+  PackedMeasurements packed;
+  std::vector<std::vector<std::uint8_t>> indices = {
+      {eBoundLoc0}, {eBoundLoc0, eBoundLoc1}, {eBoundLoc1},
+      {eBoundLoc0, eBoundLoc1, eBoundTime}, {eBoundTime, eBoundLoc1},
+      {eBoundLoc0, eBoundLoc1, eBoundPhi, eBoundTheta, eBoundQOverP,
+       eBoundTime}};
+  std::vector<ActsDynamicVector> values;
+  std::vector<ActsDynamicMatrix> covariances;
+  for (const auto& measured : indices) {
+    const std::size_t size = measured.size();
+    ActsDynamicVector value = ActsDynamicVector::Zero(size);
+    ActsDynamicMatrix a = ActsDynamicMatrix::Zero(size, size);
+    for (std::size_t i = 0; i < size; ++i) {
+      value(i) = dist(rng);
+      for (std::size_t j = 0; j < size; ++j) {
+        a(i, j) = dist(rng);
+      }
+    }
+    ActsDynamicMatrix covariance =
+        a * a.transpose() + ActsDynamicMatrix::Identity(size, size);
+    packed.add(surface0, measured, value, covariance);
+    values.push_back(value);
+    covariances.push_back(covariance);
+  }
+  BOOST_CHECK_EQUAL(packed.size(), indices.size());
+  BOOST_CHECK_EQUAL(packed.surfaces(), 1u);
+
+  const PackedMeasurements::SurfaceRange* range = packed.find(surface0);
+  BOOST_REQUIRE(range != nullptr);
+  BOOST_CHECK_EQUAL(range->size, indices.size());
+  BOOST_CHECK(packed.find(surface1) == nullptr);
+
+  for (int trial = 0; trial < 10; ++trial) {
+    BoundVector predicted;
+    for (std::size_t i = 0; i < eBoundSize; ++i) {
+      predicted(i) = dist(rng);
+    }
+    const BoundSquareMatrix predictedCovariance = randomCovariance(rng);
+
+    std::vector<double> chi2(range->size);
+    packed.chi2(*range, predicted, predictedCovariance, chi2);
+
+    // the chi2 is returned in the order of insertion
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+      BOOST_CHECK_CLOSE(chi2[i],
+                        referenceChi2(indices[i], values[i], covariances[i],
+                                      predicted, predictedCovariance),
+                        1e-8);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SurfaceOrdering) {
+  PackedMeasurements packed;
+  const ActsVector<1> value(0.5);
+  const ActsSquareMatrix<1> covariance(1.);
+  const std::array<std::uint8_t, 1> loc0 = {eBoundLoc0};
+
+  packed.add(surface0, loc0, value, covariance);
+  packed.add(surface1, loc0, value, covariance);
+  packed.add(surface1, loc0, value, covariance);
+  BOOST_CHECK_THROW(packed.add(surface0, loc0, value, covariance),
+                    std::invalid_argument);
+
+  BOOST_CHECK_EQUAL(packed.surfaces(), 2u);
+  BOOST_CHECK_EQUAL(packed.find(surface0)->size, 1u);
+  BOOST_CHECK_EQUAL(packed.find(surface1)->size, 2u);
+
+  packed.clear();
+  BOOST_CHECK_EQUAL(packed.size(), 0u);
+  BOOST_CHECK(packed.find(surface0) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(SelectByChi2) {
+  auto logger = getDefaultLogger("PackedMeasurementsTests", Logging::INFO);
+
+  MeasurementSelectorCuts cuts;
+  cuts.chi2CutOff = {10};
+  cuts.numMeasurementsCutOff = {2};
+  cuts.chi2CutOffOutlier = {20};
+  MeasurementSelector selector(cuts);
+
+  std::vector<std::size_t> selected(4);
+  bool isOutlier = true;
+
+  // the passing candidates are ordered by chi2 and the number is limited
+  std::vector<double> chi2 = {8, 12, 2, 5};
+  auto result =
+      selector.selectByChi2(surface0, 1., chi2, selected, isOutlier, *logger);
+  BOOST_REQUIRE(result.ok());
+  BOOST_CHECK_EQUAL(*result, 2u);
+  BOOST_CHECK(!isOutlier);
+  BOOST_CHECK_EQUAL(selected[0], 2u);
+  BOOST_CHECK_EQUAL(selected[1], 3u);
+
+  // the best candidate is an outlier if none passes the cut
+  chi2 = {30, 15, 12, 25};
+  result =
+      selector.selectByChi2(surface0, 1., chi2, selected, isOutlier, *logger);
+  BOOST_REQUIRE(result.ok());
+  BOOST_CHECK_EQUAL(*result, 1u);
+  BOOST_CHECK(isOutlier);
+  BOOST_CHECK_EQUAL(selected[0], 2u);
+
+  // nothing is selected if even the best candidate is no outlier
+  chi2 = {30, 25, 22, 40};
+  result =
+      selector.selectByChi2(surface0, 1., chi2, selected, isOutlier, *logger);
+  BOOST_REQUIRE(result.ok());
+  BOOST_CHECK_EQUAL(*result, 0u);
+  BOOST_CHECK(!isOutlier);
+
+  result = selector.selectByChi2(surface0, 1., {}, {}, isOutlier, *logger);
+  BOOST_CHECK(!result.ok());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Acts::Test
@@ -0,0 +1,122 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+using namespace Acts;
+
+namespace {
+
+using Approx = AtlasBetheHeitlerApprox<6, 5>;
+
+struct Deviation {
+  double weight = 0;
+  double mean = 0;
+  double var = 0;
+};
+
+/// Largest deviation of the tabulated from the polynomial mixture, relative
+/// for the variance which spans several orders of magnitude
+Deviation maxDeviation(const Approx &polynomial, const Approx &tabulated) {
+  Deviation deviation;
+  for (double x = 0; x < 0.25; x += 1e-5) {
+    const auto expected = polynomial.mixture(x);
+    const auto mixture = tabulated.mixture(x);
+    BOOST_REQUIRE_EQUAL(mixture.size(), expected.size());
+
+    double weightSum = 0;
+    for (std::size_t i = 0; i < mixture.size(); ++i) {
+      deviation.weight = std::max(
+          deviation.weight, std::abs(mixture[i].weight - expected[i].weight));
+      deviation.mean = std::max(deviation.mean,
+                                std::abs(mixture[i].mean - expected[i].mean));
+      if (expected[i].var != 0) {
+        deviation.var = std::max(
+            deviation.var,
+            std::abs(mixture[i].var - expected[i].var) / expected[i].var);
+      }
+      weightSum += mixture[i].weight;
+    }
+    BOOST_CHECK_SMALL(weightSum - 1, 1e-12);
+  }
+  return deviation;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(BetheHeitlerApproxTests)
+
+BOOST_AUTO_TEST_CASE(TabulatedLinear) {
+  const Approx polynomial = makeDefaultBetheHeitlerApprox();
+  Approx tabulated = polynomial;
+  BOOST_CHECK(!tabulated.isTabulated());
+
+  tabulated.tabulate(1000, Approx::Interpolation::Linear);
+  BOOST_CHECK(tabulated.isTabulated());
+
+  const Deviation deviation = maxDeviation(polynomial, tabulated);
+  BOOST_TEST_MESSAGE("Linear: weight " << deviation.weight << ", mean "
+                                       << deviation.mean << ", var "
+                                       << deviation.var);
+  BOOST_CHECK_LT(deviation.weight, 1e-6);
+  BOOST_CHECK_LT(deviation.mean, 1e-6);
+  BOOST_CHECK_LT(deviation.var, 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedCubic) {
+  const Approx polynomial = makeDefaultBetheHeitlerApprox();
+  Approx tabulated = polynomial;
+  tabulated.tabulate(1000, Approx::Interpolation::Cubic);
+
+  const Deviation deviation = maxDeviation(polynomial, tabulated);
+  BOOST_TEST_MESSAGE("Cubic: weight " << deviation.weight << ", mean "
+                                      << deviation.mean << ", var "
+                                      << deviation.var);
+  BOOST_CHECK_LT(deviation.weight, 1e-6);
+  BOOST_CHECK_LT(deviation.mean, 1e-6);
+  BOOST_CHECK_LT(deviation.var, 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedCubicNoOvershoot) {
+  // few points make the spline overshoot between them
+  for (std::size_t nPoints : {4u, 5u, 10u, 20u}) {
+    BOOST_TEST_CONTEXT("nPoints " << nPoints) {
+      Approx tabulated = makeDefaultBetheHeitlerApprox();
+      tabulated.tabulate(nPoints, Approx::Interpolation::Cubic);
+
+      for (double x = 0.002; x < 0.2; x += 1e-5) {
+        const auto mixture = tabulated.mixture(x);
+        double weightSum = 0;
+        for (const auto &cmp : mixture) {
+          BOOST_CHECK_GE(cmp.weight, 0.);
+          BOOST_CHECK_GT(cmp.var, 0.);
+          weightSum += cmp.weight;
+        }
+        BOOST_CHECK_SMALL(weightSum - 1, 1e-12);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedInvalid) {
+  Approx approx = makeDefaultBetheHeitlerApprox();
+  BOOST_CHECK_THROW(approx.tabulate(1, Approx::Interpolation::Linear),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(approx.tabulate(3, Approx::Interpolation::Cubic),
+                    std::invalid_argument);
+  BOOST_CHECK(!approx.isTabulated());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -12,14 +12,18 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/Surfaces/CurvilinearSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/TrackFitting/GsfMixtureReduction.hpp"
 #include "Acts/TrackFitting/detail/SymmetricKlDistanceMatrix.hpp"
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -101,6 +105,73 @@ BOOST_AUTO_TEST_CASE(test_distance_matrix_recompute_distance) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_distance_matrix_incremental_min_distance) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> qopDist(-1., 1.);
+  std::uniform_real_distribution<double> varDist(0.1, 2.);
+
+  std::vector<GsfComponent> cmps(60);
+  for (auto &cmp : cmps) {
+    cmp.weight = 1. / cmps.size();
+    cmp.boundPars = BoundVector::Zero();
+    // use few values to produce equal distances
+    cmp.boundPars[eBoundQOverP] = std::round(10. * qopDist(rng)) / 10.;
+    cmp.boundCov = BoundSquareMatrix::Identity();
+    cmp.boundCov(eBoundQOverP, eBoundQOverP) = varDist(rng);
+  }
+
+  const auto proj = [](auto &a) -> decltype(auto) { return a; };
+  detail::SymmetricKLDistanceMatrix mat(cmps, proj);
+  std::vector<bool> active(cmps.size(), true);
+
+  // the first pair with the minimal distance in the lower triangle
+  auto bruteForceMinDistancePair = [&]() {
+    double min = std::numeric_limits<double>::max();
+    std::pair<std::size_t, std::size_t> pair;
+    for (std::size_t i = 1; i < cmps.size(); ++i) {
+      for (std::size_t j = 0; j < i; ++j) {
+        const double d =
+            detail::computeSymmetricKlDivergence(cmps[i], cmps[j], proj);
+        if (active[i] && active[j] && d < min) {
+          min = d;
+          pair = {i, j};
+        }
+      }
+    }
+    return pair;
+  };
+
+  for (std::size_t remaining = cmps.size(); remaining > 1; --remaining) {
+    const auto [i, j] = mat.minDistancePair();
+    const auto [expectedI, expectedJ] = bruteForceMinDistancePair();
+    BOOST_CHECK_EQUAL(i, expectedI);
+    BOOST_CHECK_EQUAL(j, expectedJ);
+    const double expectedDistance =
+        detail::computeSymmetricKlDivergence(cmps[i], cmps[j], proj);
+    CHECK_CLOSE_REL(mat.at(i, j), expectedDistance, 1e-12);
+
+    cmps[i].boundPars[eBoundQOverP] =
+        0.5 * (cmps[i].boundPars[eBoundQOverP] +
+               cmps[j].boundPars[eBoundQOverP]);
+    cmps[i].boundCov(eBoundQOverP, eBoundQOverP) += 0.1;
+    mat.recomputeAssociatedDistances(i, cmps, proj);
+
+    active[j] = false;
+    mat.maskAssociatedDistances(j);
+  }
+
+  // reuse the storage for a smaller mixture
+  cmps.resize(4);
+  for (std::size_t k = 0; k < cmps.size(); ++k) {
+    cmps[k].boundPars[eBoundQOverP] = std::array{-2., 0., 1., 4.}[k];
+    cmps[k].boundCov(eBoundQOverP, eBoundQOverP) = 1.;
+  }
+  mat.reset(cmps, proj);
+  const auto [i, j] = mat.minDistancePair();
+  BOOST_CHECK_EQUAL(i, 2);
+  BOOST_CHECK_EQUAL(j, 1);
+}
+
 BOOST_AUTO_TEST_CASE(test_mixture_reduction) {
   auto meanAndSumOfWeights = [](const auto &cmps) {
     const auto mean = std::accumulate(
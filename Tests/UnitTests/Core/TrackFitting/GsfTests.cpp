@@ -26,13 +26,16 @@
 #include "Acts/EventData/VectorTrackContainer.hpp"
 #include "Acts/EventData/detail/TestSourceLink.hpp"
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
 #include "Acts/Propagator/MultiEigenStepperLoop.hpp"
+#include "Acts/Propagator/MultiEigenStepperSIMD.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Surfaces/CurvilinearSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/LineSurfaceStub.hpp"
 #include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
 #include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
@@ -40,10 +43,13 @@
 #include "Acts/TrackFitting/GaussianSumFitter.hpp"
 #include "Acts/TrackFitting/GsfMixtureReduction.hpp"
 #include "Acts/TrackFitting/GsfOptions.hpp"
+#include "Acts/Utilities/Axis.hpp"
 #include "Acts/Utilities/Delegate.hpp"
+#include "Acts/Utilities/Grid.hpp"
 #include "Acts/Utilities/Holders.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/UnitVectors.hpp"
+#include "Acts/Utilities/VectorHelpers.hpp"
 #include "Acts/Utilities/Zip.hpp"
 
 #include <algorithm>
@@ -254,4 +260,80 @@ BOOST_AUTO_TEST_CASE(WithFinalMultiComponentState) {
                   .has_value());
 }
 
+BOOST_AUTO_TEST_CASE(InterpolatedFieldSimdStepper) {
+  // same transformations as in fieldMapRZ
+  auto transformPos = [](const Vector3 &pos) {
+    return Vector2(VectorHelpers::perp(pos), pos.z());
+  };
+  auto transformBField = [](const Vector2 &field, const Vector3 &pos) {
+    const double r = VectorHelpers::perp(pos);
+    return Vector3(field.x() * pos.x() / r, field.x() * pos.y() / r,
+                   field.y());
+  };
+
+  Grid grid(Type<Vector2>, Axis(0., 4_m, 40u), Axis(-4_m, 4_m, 80u));
+  using Grid_t = decltype(grid);
+  using BField_t = InterpolatedBFieldMap<Grid_t>;
+
+  // a weak solenoid-like field with a radial component
+  for (std::size_t i = 1; i <= grid.numLocalBins().at(0) + 1; ++i) {
+    for (std::size_t j = 1; j <= grid.numLocalBins().at(1) + 1; ++j) {
+      Grid_t::index_t indices = {{i, j}};
+      const auto &llCorner = grid.lowerLeftBinEdge(indices);
+      const double r = llCorner[0] / 1_m;
+      const double z = llCorner[1] / 1_m;
+      grid.atLocalBins(indices) =
+          Vector2(0.01_T * r * z, 0.05_T - 0.005_T * r);
+    }
+  }
+  auto field = std::make_shared<const BField_t>(
+      BField_t::Config{transformPos, transformBField, std::move(grid)});
+
+  auto makePropagator = [&](auto stepper) {
+    Navigator::Config cfg{tester.geometry};
+    cfg.resolvePassive = false;
+    cfg.resolveMaterial = true;
+    cfg.resolveSensitive = true;
+    return Acts::Propagator<decltype(stepper), Navigator>(std::move(stepper),
+                                                          Navigator(cfg));
+  };
+
+  using SimdStepper = Acts::MultiEigenStepperSIMD<>;
+  using SimdGSF = GaussianSumFitter<Acts::Propagator<SimdStepper, Navigator>,
+                                    BetheHeitlerApprox, VectorMultiTrajectory>;
+  const GSF gsfLoop(makePropagator(Stepper(field)),
+                    makeDefaultBetheHeitlerApprox());
+  const SimdGSF gsfSimd(makePropagator(SimdStepper(field)),
+                        makeDefaultBetheHeitlerApprox());
+
+  auto multi_pars = makeParameters();
+  auto measurements =
+      createMeasurements(tester.simPropagator, tester.geoCtx, tester.magCtx,
+                         multi_pars, tester.resolutions, rng);
+  auto sourceLinks = tester.prepareSourceLinks(measurements.sourceLinks);
+  auto options = makeDefaultGsfOptions();
+  options.referenceSurface = &multi_pars.referenceSurface();
+
+  Acts::TrackContainer loopTracks{Acts::VectorTrackContainer{},
+                                  Acts::VectorMultiTrajectory{}};
+  Acts::TrackContainer simdTracks{Acts::VectorTrackContainer{},
+                                  Acts::VectorMultiTrajectory{}};
+  auto loopRes = gsfLoop.fit(sourceLinks.begin(), sourceLinks.end(),
+                             multi_pars, options, loopTracks);
+  auto simdRes = gsfSimd.fit(sourceLinks.begin(), sourceLinks.end(),
+                             multi_pars, options, simdTracks);
+  BOOST_REQUIRE(loopRes.ok());
+  BOOST_REQUIRE(simdRes.ok());
+
+  // both steppers look up the field of a component through its cached field
+  // cell, so the fits are identical
+  const auto &loopTrack = *loopRes;
+  const auto &simdTrack = *simdRes;
+  BOOST_CHECK_EQUAL(simdTrack.nMeasurements(), loopTrack.nMeasurements());
+  BOOST_CHECK_EQUAL(simdTrack.nMeasurements(), tester.nMeasurements);
+  BOOST_REQUIRE(simdTrack.hasReferenceSurface());
+  BOOST_CHECK_EQUAL(simdTrack.parameters(), loopTrack.parameters());
+  BOOST_CHECK_EQUAL(simdTrack.covariance(), loopTrack.covariance());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -33,6 +33,7 @@
 #include "Acts/Visualization/GeometryView3D.hpp"
 #include "Acts/Visualization/ObjVisualization3D.hpp"
 
+#include <random>
 #include <vector>
 
 #include "FitterTestsCommon.hpp"
@@ -1120,5 +1121,111 @@ BOOST_AUTO_TEST_CASE(Material) {
 
   ACTS_INFO("*** Test: Material -- Finish");
 }
+
+BOOST_AUTO_TEST_CASE(LinearSystemMatchesDense) {
+  ACTS_INFO("*** Test: LinearSystemMatchesDense -- Start");
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(-1, 1);
+  auto random = [&](auto matrix) {
+    for (int i = 0; i < matrix.size(); ++i) {
+      matrix(i) = dist(rng);
+    }
+    return matrix;
+  };
+
+  const std::size_t nSurfaces = 40;
+  Experimental::Gx2fSystem system;
+
+  // the dense system, assembled with the extended Jacobians
+  std::vector<BoundMatrix> jacobians;
+  std::vector<BoundMatrix> informations;
+  std::vector<BoundVector> weightedResiduals;
+  std::vector<std::pair<Vector2, Vector2>> scatterings;
+  std::vector<int> scatteringSurface;
+
+  for (std::size_t i = 0; i < nSurfaces; ++i) {
+    const BoundMatrix jacobian =
+        BoundMatrix::Identity() + 0.1 * random(BoundMatrix{});
+    system.addSurface(jacobian);
+    jacobians.push_back(jacobian);
+
+    // measure all parameters on some surfaces, and loc0 and loc1 otherwise
+    const ActsMatrix<eBoundSize, eBoundSize> sqrtInformation =
+        random(BoundMatrix{});
+    BoundMatrix information = sqrtInformation * sqrtInformation.transpose();
+    if (i % 5 != 0) {
+      information.bottomRightCorner<4, 4>().setZero();
+      information.topRightCorner<2, 4>().setZero();
+      information.bottomLeftCorner<4, 2>().setZero();
+    }
+    const BoundVector weightedResidual = information * random(BoundVector{});
+    system.addMeasurement(information, weightedResidual);
+    informations.push_back(information);
+    weightedResiduals.push_back(weightedResidual);
+
+    if (i % 2 == 0) {
+      const Vector2 scatteringInformation =
+          random(Vector2{}).cwiseAbs() + Vector2::Constant(0.5);
+      const Vector2 bVector = random(Vector2{});
+      system.addScattering(scatteringInformation, bVector);
+      scatterings.emplace_back(scatteringInformation, bVector);
+      scatteringSurface.push_back(i);
+    }
+  }
+  BOOST_CHECK_EQUAL(system.nScatterers(), scatterings.size());
+
+  const std::size_t dims = eBoundSize + 2 * scatterings.size();
+  Eigen::MatrixXd aMatrix = Eigen::MatrixXd::Zero(dims, dims);
+  Eigen::VectorXd bVector = Eigen::VectorXd::Zero(dims);
+  std::vector<BoundMatrix> jacobianFromStart = {BoundMatrix::Identity()};
+  std::size_t iScattering = 0;
+  for (std::size_t i = 0; i < nSurfaces; ++i) {
+    for (auto& jac : jacobianFromStart) {
+      jac = jacobians[i] * jac;
+    }
+    Eigen::MatrixXd extendedJacobian = Eigen::MatrixXd::Zero(eBoundSize, dims);
+    extendedJacobian.leftCols<eBoundSize>() = jacobianFromStart[0];
+    for (std::size_t k = 1; k < jacobianFromStart.size(); ++k) {
+      extendedJacobian.block<eBoundSize, 2>(0, eBoundSize + 2 * (k - 1)) =
+          jacobianFromStart[k] * Experimental::Gx2fConstants::phiThetaProjector;
+    }
+    aMatrix += extendedJacobian.transpose() * informations[i] *
+               extendedJacobian;
+    bVector += extendedJacobian.transpose() * weightedResiduals[i];
+
+    if (iScattering < scatteringSurface.size() &&
+        scatteringSurface[iScattering] == static_cast<int>(i)) {
+      const std::size_t position = eBoundSize + 2 * iScattering;
+      aMatrix.block<2, 2>(position, position).diagonal() +=
+          scatterings[iScattering].first;
+      bVector.segment<2>(position) += scatterings[iScattering].second;
+      jacobianFromStart.emplace_back(BoundMatrix::Identity());
+      ++iScattering;
+    }
+  }
+
+  const Eigen::VectorXd expected = aMatrix.colPivHouseholderQr().solve(bVector);
+  const BoundMatrix expectedAMatrix = aMatrix.topLeftCorner<6, 6>();
+  const BoundVector expectedBVector = bVector.head<6>();
+  const BoundMatrix expectedCovariance =
+      aMatrix.inverse().topLeftCorner<6, 6>();
+
+  const Experimental::Gx2fSystem::Solution solution = system.solve();
+
+  CHECK_CLOSE_ABS(system.aMatrix(), expectedAMatrix, 1e-8);
+  CHECK_CLOSE_ABS(system.bVector(), expectedBVector, 1e-8);
+  CHECK_CLOSE_ABS(solution.deltaParams, BoundVector(expected.head<6>()), 1e-6);
+  BOOST_REQUIRE_EQUAL(solution.deltaScatteringAngles.size(),
+                      scatterings.size());
+  for (std::size_t k = 0; k < scatterings.size(); ++k) {
+    const Vector2 expectedAngles = expected.segment<2>(eBoundSize + 2 * k);
+    CHECK_CLOSE_ABS(solution.deltaScatteringAngles[k], expectedAngles, 1e-6);
+  }
+  CHECK_CLOSE_ABS(BoundMatrix(solution.information.inverse()),
+                  expectedCovariance, 1e-6);
+
+  ACTS_INFO("*** Test: LinearSystemMatchesDense -- Finish");
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Acts::Test
@@ -12,6 +12,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/MagneticField/BFieldMapUtils.hpp"
 #include "Acts/MagneticField/InterpolatedBFieldMap.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/VectorHelpers.hpp"
@@ -367,4 +368,91 @@ BOOST_DATA_TEST_CASE(
   CHECK_CLOSE_REL(value0_xyz, value4_xyz, 1e-10);
 }
 
+BOOST_AUTO_TEST_CASE(bfield_single_precision) {
+  std::vector<double> xPos = {0., 1., 2., 3.};
+  std::vector<double> yPos = {0., 1., 2., 3.};
+  std::vector<double> zPos = {0., 1., 2., 3.};
+  std::vector<double> rPos = {0., 1., 2., 3.};
+
+  // field values which are not exactly representable in single precision
+  std::vector<Acts::Vector3> bField_xyz;
+  for (int i = 0; i < 64; i++) {
+    bField_xyz.push_back(Acts::Vector3(0.1 * i, 1. / (i + 3), -0.7 * i));
+  }
+  std::vector<Acts::Vector2> bField_rz;
+  for (int i = 0; i < 16; i++) {
+    bField_rz.push_back(Acts::Vector2(0.3 * i, 1. / (i + 7)));
+  }
+
+  auto map_xyz = Acts::fieldMapXYZ(
+      [](std::array<std::size_t, 3> binsXYZ,
+         std::array<std::size_t, 3> nBinsXYZ) {
+        return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+                binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+      },
+      xPos, yPos, zPos, bField_xyz, 1, 1, false);
+  auto map_rz = Acts::fieldMapRZ(
+      [](std::array<std::size_t, 2> binsRZ,
+         std::array<std::size_t, 2> nBinsRZ) {
+        return (binsRZ.at(1) * nBinsRZ.at(0) + binsRZ.at(0));
+      },
+      rPos, zPos, bField_rz, 1, 1, false);
+
+  auto floatMap_xyz = Acts::singlePrecisionFieldMap(map_xyz);
+  auto floatMap_rz = Acts::singlePrecisionFieldMap(map_rz);
+
+  static_assert(sizeof(decltype(floatMap_xyz)::FieldType) ==
+                sizeof(decltype(map_xyz)::FieldType) / 2);
+  static_assert(sizeof(decltype(floatMap_rz)::FieldType) ==
+                sizeof(decltype(map_rz)::FieldType) / 2);
+
+  BOOST_CHECK(floatMap_xyz.getNBins() == map_xyz.getNBins());
+  BOOST_CHECK(floatMap_xyz.getMin() == map_xyz.getMin());
+  BOOST_CHECK(floatMap_xyz.getMax() == map_xyz.getMax());
+
+  Acts::MagneticFieldContext mctx;
+  auto cache_xyz = floatMap_xyz.makeCache(mctx);
+  auto cache_rz = floatMap_rz.makeCache(mctx);
+  auto refCache_xyz = map_xyz.makeCache(mctx);
+  auto refCache_rz = map_rz.makeCache(mctx);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(0., 2.1);
+  for (int i = 0; i < 100; i++) {
+    Acts::Vector3 pos(dist(rng), dist(rng), dist(rng));
+
+    CHECK_CLOSE_ABS(floatMap_xyz.getField(pos).value(),
+                    map_xyz.getField(pos).value(), 1e-5);
+    CHECK_CLOSE_ABS(floatMap_xyz.getField(pos, cache_xyz).value(),
+                    map_xyz.getField(pos, refCache_xyz).value(), 1e-5);
+
+    CHECK_CLOSE_ABS(floatMap_rz.getField(pos).value(),
+                    map_rz.getField(pos).value(), 1e-5);
+    CHECK_CLOSE_ABS(floatMap_rz.getField(pos, cache_rz).value(),
+                    map_rz.getField(pos, refCache_rz).value(), 1e-5);
+  }
+
+  // with field values which are exactly representable in single precision,
+  // only the storage differs and the interpolation keeps double precision
+  std::vector<Acts::Vector3> exactField_xyz;
+  for (int i = 0; i < 64; i++) {
+    exactField_xyz.push_back(Acts::Vector3(i, 3 - i, 0.5 * i));
+  }
+  auto exactMap_xyz = Acts::fieldMapXYZ(
+      [](std::array<std::size_t, 3> binsXYZ,
+         std::array<std::size_t, 3> nBinsXYZ) {
+        return (binsXYZ.at(0) * (nBinsXYZ.at(1) * nBinsXYZ.at(2)) +
+                binsXYZ.at(1) * nBinsXYZ.at(2) + binsXYZ.at(2));
+      },
+      xPos, yPos, zPos, exactField_xyz, 1, 1, false);
+  auto exactFloatMap_xyz = Acts::singlePrecisionFieldMap(exactMap_xyz);
+  for (int i = 0; i < 100; i++) {
+    Acts::Vector3 pos(dist(rng), dist(rng), dist(rng));
+    CHECK_CLOSE_ABS(exactFloatMap_xyz.getField(pos).value(),
+                    exactMap_xyz.getField(pos).value(), 1e-12);
+    CHECK_CLOSE_ABS(exactFloatMap_xyz.getFieldUnchecked(pos),
+                    exactMap_xyz.getFieldUnchecked(pos), 1e-12);
+  }
+}
+
 }  // namespace Acts::Test
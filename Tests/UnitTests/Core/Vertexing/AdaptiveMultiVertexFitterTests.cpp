@@ -205,6 +205,10 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
 
   AdaptiveMultiVertexFitter::State state(*bField, magFieldContext);
 
+  for (auto& vtx : vtxPtrList) {
+    state.addVertex(*vtx, VertexInfo());
+  }
+
   for (unsigned int iTrack = 0; iTrack < nTracksPerVtx * vtxPosVec.size();
        iTrack++) {
     // Index of current vertex
@@ -212,25 +216,21 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
 
     InputTrack inputTrack{&allTracks[iTrack]};
 
-    state.vtxInfoMap[&(vtxList[vtxIdx])].trackLinks.push_back(inputTrack);
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(inputTrack, &(vtxList[vtxIdx])),
-                       TrackAtVertex(1., allTracks[iTrack], inputTrack)));
+    state.addTrack(vtxList[vtxIdx], inputTrack,
+                   TrackAtVertex(1., allTracks[iTrack], inputTrack));
 
     // Use first track also for second vertex to let vtx1 and vtx2
     // share this track
     if (iTrack == 0) {
-      state.vtxInfoMap[&(vtxList.at(1))].trackLinks.push_back(inputTrack);
-      state.tracksAtVerticesMap.insert(
-          std::make_pair(std::make_pair(inputTrack, &(vtxList.at(1))),
-                         TrackAtVertex(1., allTracks[iTrack], inputTrack)));
+      state.addTrack(vtxList.at(1), inputTrack,
+                     TrackAtVertex(1., allTracks[iTrack], inputTrack));
     }
   }
 
   for (auto& vtx : vtxPtrList) {
-    state.addVertexToMultiMap(*vtx);
+    state.linkVertexTracks(*vtx);
     ACTS_DEBUG("Vertex, with ptr: " << vtx);
-    for (auto& trk : state.vtxInfoMap[vtx].trackLinks) {
+    for (auto& trk : state.vertexInfo(*vtx).trackLinks) {
       ACTS_DEBUG("\t track ptr: " << trk);
     }
   }
@@ -238,12 +238,20 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   ACTS_DEBUG("Checking all vertices linked to a single track:");
   for (auto& trk : allTracks) {
     ACTS_DEBUG("Track with ptr: " << &trk);
-    auto range = state.trackToVerticesMultiMap.equal_range(InputTrack{&trk});
-    for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-      ACTS_DEBUG("\t used by vertex: " << vtxIter->second);
+    const auto& trkLinks =
+        state.trackToVertices.at(state.trackIndices.at(InputTrack{&trk}));
+    for (const auto& trkLink : trkLinks) {
+      ACTS_DEBUG("\t used by vertex: " << state.vertices[trkLink.vertex]);
     }
   }
 
+  // The first track is shared by the first two vertices
+  const auto& sharedTrkLinks = state.trackToVertices.at(
+      state.trackIndices.at(InputTrack{&allTracks[0]}));
+  BOOST_CHECK_EQUAL(sharedTrkLinks.size(), 2u);
+  BOOST_CHECK_EQUAL(state.vertices[sharedTrkLinks.at(0).vertex], vtxPtrList[0]);
+  BOOST_CHECK_EQUAL(state.vertices[sharedTrkLinks.at(1).vertex], vtxPtrList[1]);
+
   // Copy vertex seeds from state.vertexCollection to new
   // list in order to be able to compare later
   std::vector<Vertex> seedListCopy = vtxList;
@@ -254,7 +262,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   for (auto& vtx : vtxPtrList) {
     c++;
     ACTS_DEBUG(c << ". vertex, with ptr: " << vtx);
-    for (const auto& trk : state.vtxInfoMap[vtx].trackLinks) {
+    for (const auto& trk : state.vertexInfo(*vtx).trackLinks) {
       ACTS_DEBUG("\t track ptr: " << trk);
     }
   }
@@ -262,9 +270,10 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   ACTS_DEBUG("Checking all vertices linked to a single track AFTER fit:");
   for (auto& trk : allTracks) {
     ACTS_DEBUG("Track with ptr: " << &trk);
-    auto range = state.trackToVerticesMultiMap.equal_range(InputTrack{&trk});
-    for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-      ACTS_DEBUG("\t used by vertex: " << vtxIter->second);
+    const auto& trkLinks =
+        state.trackToVertices.at(state.trackIndices.at(InputTrack{&trk}));
+    for (const auto& trkLink : trkLinks) {
+      ACTS_DEBUG("\t used by vertex: " << state.vertices[trkLink.vertex]);
     }
   }
 
@@ -411,17 +420,15 @@ BOOST_AUTO_TEST_CASE(time_fitting) {
 
   // Prepare fitter state
   AdaptiveMultiVertexFitter::State state(*bField, magFieldContext);
+  state.addVertex(vtx, VertexInfo());
 
   for (const auto& trk : trks) {
     ACTS_DEBUG("Track parameters:\n" << trk);
-    // Index of current vertex
-    state.vtxInfoMap[&vtx].trackLinks.push_back(InputTrack{&trk});
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(InputTrack{&trk}, &vtx),
-                       TrackAtVertex(1., trk, InputTrack{&trk})));
+    state.addTrack(vtx, InputTrack{&trk},
+                   TrackAtVertex(1., trk, InputTrack{&trk}));
   }
 
-  state.addVertexToMultiMap(vtx);
+  state.linkVertexTracks(vtx);
 
   auto res = fitter.addVtxToFit(state, vtx, vertexingOptions);
 
@@ -587,9 +594,6 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   Vector3 vtxPos1(0.15_mm, 0.15_mm, 2.9_mm);
   Vertex vtx1(vtxPos1);
 
-  // Add to vertex list
-  state.vertexCollection.push_back(&vtx1);
-
   // The constraint vtx for vtx1
   Vertex vtx1Constr(vtxPos1);
   vtx1Constr.setFullCovariance(covConstr);
@@ -603,20 +607,18 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   vtxInfo1.constraint = std::move(vtx1Constr);
   vtxInfo1.oldPosition = vtxInfo1.linPoint;
 
+  // Add to vertex list
+  state.vertexCollection.push_back(state.addVertex(vtx1, std::move(vtxInfo1)));
+
   for (const auto& trk : params1) {
-    vtxInfo1.trackLinks.push_back(InputTrack{&trk});
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(InputTrack{&trk}, &vtx1),
-                       TrackAtVertex(1.5, trk, InputTrack{&trk})));
+    state.addTrack(vtx1, InputTrack{&trk},
+                   TrackAtVertex(1.5, trk, InputTrack{&trk}));
   }
 
   // Prepare second vertex
   Vector3 vtxPos2(0.3_mm, -0.2_mm, -4.8_mm);
   Vertex vtx2(vtxPos2);
 
-  // Add to vertex list
-  state.vertexCollection.push_back(&vtx2);
-
   // The constraint vtx for vtx2
   Vertex vtx2Constr(vtxPos2);
   vtx2Constr.setFullCovariance(covConstr);
@@ -630,40 +632,37 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   vtxInfo2.oldPosition = vtxInfo2.linPoint;
   vtxInfo2.seedPosition = vtxInfo2.linPoint;
 
+  // Add to vertex list
+  state.vertexCollection.push_back(state.addVertex(vtx2, std::move(vtxInfo2)));
+
   for (const auto& trk : params2) {
-    vtxInfo2.trackLinks.push_back(InputTrack{&trk});
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(InputTrack{&trk}, &vtx2),
-                       TrackAtVertex(1.5, trk, InputTrack{&trk})));
+    state.addTrack(vtx2, InputTrack{&trk},
+                   TrackAtVertex(1.5, trk, InputTrack{&trk}));
   }
 
-  state.vtxInfoMap[&vtx1] = std::move(vtxInfo1);
-  state.vtxInfoMap[&vtx2] = std::move(vtxInfo2);
-
-  state.addVertexToMultiMap(vtx1);
-  state.addVertexToMultiMap(vtx2);
+  state.linkVertexTracks(vtx1);
+  state.linkVertexTracks(vtx2);
 
   // Fit vertices
   fitter.fit(state, vertexingOptions);
 
-  auto vtx1Fitted = state.vertexCollection.at(0);
+  auto vtx1Fitted = state.vertices.at(state.vertexCollection.at(0));
   auto vtx1PosFitted = vtx1Fitted->position();
   auto vtx1CovFitted = vtx1Fitted->covariance();
-  auto trks1 = state.vtxInfoMap.at(vtx1Fitted).trackLinks;
+  auto trks1 = state.vertexInfo(*vtx1Fitted).trackLinks;
   auto vtx1FQ = vtx1Fitted->fitQuality();
 
-  auto vtx2Fitted = state.vertexCollection.at(1);
+  auto vtx2Fitted = state.vertices.at(state.vertexCollection.at(1));
   auto vtx2PosFitted = vtx2Fitted->position();
   auto vtx2CovFitted = vtx2Fitted->covariance();
-  auto trks2 = state.vtxInfoMap.at(vtx2Fitted).trackLinks;
+  auto trks2 = state.vertexInfo(*vtx2Fitted).trackLinks;
   auto vtx2FQ = vtx2Fitted->fitQuality();
 
   // Vertex 1
   ACTS_DEBUG("Vertex 1, position: " << vtx1PosFitted);
   ACTS_DEBUG("Vertex 1, covariance: " << vtx1CovFitted);
   for (const auto& trk : trks1) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtx1Fitted));
+    auto& trkAtVtx = state.trackAtVertex(*vtx1Fitted, trk);
     ACTS_DEBUG("\tTrack weight:" << trkAtVtx.trackWeight);
   }
   ACTS_DEBUG("Vertex 1, chi2: " << vtx1FQ.first);
@@ -673,8 +672,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   ACTS_DEBUG("Vertex 2, position: " << vtx2PosFitted);
   ACTS_DEBUG("Vertex 2, covariance: " << vtx2CovFitted);
   for (const auto& trk : trks2) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtx2Fitted));
+    auto& trkAtVtx = state.trackAtVertex(*vtx2Fitted, trk);
     ACTS_DEBUG("\tTrack weight:" << trkAtVtx.trackWeight);
   }
   ACTS_DEBUG("Vertex 2, chi2: " << vtx2FQ.first);
@@ -709,8 +707,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   CHECK_CLOSE_ABS(vtx1CovFitted, expVtx1Cov, 0.001_mm);
   int trkCount = 0;
   for (const auto& trk : trks1) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtx1Fitted));
+    auto& trkAtVtx = state.trackAtVertex(*vtx1Fitted, trk);
     CHECK_CLOSE_ABS(trkAtVtx.trackWeight, expVtx1TrkWeights[trkCount], 0.001);
     trkCount++;
   }
@@ -722,8 +719,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   CHECK_CLOSE_ABS(vtx2CovFitted, expVtx2Cov, 0.001_mm);
   trkCount = 0;
   for (const auto& trk : trks2) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtx2Fitted));
+    auto& trkAtVtx = state.trackAtVertex(*vtx2Fitted, trk);
     CHECK_CLOSE_ABS(trkAtVtx.trackWeight, expVtx2TrkWeights[trkCount], 0.001);
     trkCount++;
   }
@@ -0,0 +1,167 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/TrackFinding/SeedingAlgorithm.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+using namespace Acts::Test;
+using namespace ActsExamples;
+
+namespace {
+
+/// Space points of helices from the beam line in barrel layers, together with
+/// some noise, in a solenoid field of 2T
+SimSpacePointContainer makeSpacePoints(std::size_t nParticles) {
+  const std::vector<double> layerRadii = {30_mm, 50_mm, 70_mm, 90_mm,
+                                          110_mm, 130_mm, 150_mm};
+
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> cotThetaDist(-2, 2);
+  std::uniform_real_distribution<double> ptDist(0.5_GeV, 10_GeV);
+  std::uniform_real_distribution<double> z0Dist(-50_mm, 50_mm);
+  std::uniform_real_distribution<double> zDist(-500_mm, 500_mm);
+
+  SimSpacePointContainer spacePoints;
+  auto addSpacePoint = [&](double r, double phi, double z) {
+    spacePoints.emplace_back(
+        Acts::Vector3(r * std::cos(phi), r * std::sin(phi), z), std::nullopt,
+        0.01_mm * 0.01_mm, 0.1_mm * 0.1_mm, std::nullopt,
+        boost::container::static_vector<Acts::SourceLink, 2>{});
+  };
+
+  for (std::size_t i = 0; i < nParticles; ++i) {
+    const double q = (i % 2 == 0) ? 1 : -1;
+    const double phi0 = phiDist(rng);
+    const double cotTheta = cotThetaDist(rng);
+    const double z0 = z0Dist(rng);
+    // radius of the helix in the transverse plane
+    const double radius = ptDist(rng) / 2_T;
+    for (double r : layerRadii) {
+      const double halfAngle = std::asin(r / (2 * radius));
+      addSpacePoint(r, phi0 - q * halfAngle,
+                    z0 + cotTheta * 2 * radius * halfAngle);
+    }
+  }
+  for (std::size_t i = 0; i < nParticles; ++i) {
+    for (double r : layerRadii) {
+      addSpacePoint(r, phiDist(rng), zDist(rng));
+    }
+  }
+
+  return spacePoints;
+}
+
+/// Run the seeding on the space points on the white board, which own the space
+/// points of the seeds
+SimSeedContainer findSeeds(WhiteBoard& board, bool seedConfirmation,
+                           std::size_t numGroupsPerTask) {
+  SeedingAlgorithm::Config cfg;
+  cfg.inputSpacePoints = {"spacepoints"};
+  cfg.outputSeeds = "seeds" + std::to_string(numGroupsPerTask);
+
+  cfg.seedFinderConfig.rMin = 0_mm;
+  cfg.seedFinderConfig.rMax = 160_mm;
+  cfg.seedFinderConfig.deltaRMin = 5_mm;
+  cfg.seedFinderConfig.deltaRMax = 160_mm;
+  cfg.seedFinderConfig.collisionRegionMin = -250_mm;
+  cfg.seedFinderConfig.collisionRegionMax = 250_mm;
+  cfg.seedFinderConfig.zMin = -2000_mm;
+  cfg.seedFinderConfig.zMax = 2000_mm;
+  cfg.seedFinderConfig.maxSeedsPerSpM = 2;
+  cfg.seedFinderConfig.cotThetaMax = 7.40627;
+  cfg.seedFinderConfig.sigmaScattering = 5;
+  cfg.seedFinderConfig.minPt = 500_MeV;
+  cfg.seedFinderConfig.impactMax = 10_mm;
+  cfg.seedFinderConfig.seedConfirmation = seedConfirmation;
+  cfg.seedFinderConfig.centralSeedConfirmationRange.nTopForSmallR = 1;
+  cfg.seedFinderConfig.centralSeedConfirmationRange.nTopForLargeR = 1;
+  cfg.seedFinderConfig.forwardSeedConfirmationRange =
+      cfg.seedFinderConfig.centralSeedConfirmationRange;
+
+  cfg.seedFilterConfig.deltaRMin = cfg.seedFinderConfig.deltaRMin;
+  cfg.seedFilterConfig.maxSeedsPerSpM = cfg.seedFinderConfig.maxSeedsPerSpM;
+  cfg.seedFilterConfig.seedConfirmation = seedConfirmation;
+  cfg.seedFilterConfig.centralSeedConfirmationRange =
+      cfg.seedFinderConfig.centralSeedConfirmationRange;
+  cfg.seedFilterConfig.forwardSeedConfirmationRange =
+      cfg.seedFinderConfig.forwardSeedConfirmationRange;
+
+  cfg.gridConfig.minPt = cfg.seedFinderConfig.minPt;
+  cfg.gridConfig.rMax = cfg.seedFinderConfig.rMax;
+  cfg.gridConfig.zMin = cfg.seedFinderConfig.zMin;
+  cfg.gridConfig.zMax = cfg.seedFinderConfig.zMax;
+  cfg.gridConfig.deltaRMax = cfg.seedFinderConfig.deltaRMax;
+  cfg.gridConfig.cotThetaMax = cfg.seedFinderConfig.cotThetaMax;
+
+  cfg.seedFinderOptions.bFieldInZ = 2_T;
+  cfg.gridOptions.bFieldInZ = cfg.seedFinderOptions.bFieldInZ;
+
+  cfg.numGroupsPerTask = numGroupsPerTask;
+  SeedingAlgorithm algorithm(cfg, Acts::Logging::WARNING);
+
+  BOOST_REQUIRE(algorithm.execute(AlgorithmContext(0, 0, board)) ==
+                ProcessCode::SUCCESS);
+  return getFromWhiteBoard<SimSeedContainer>(cfg.outputSeeds, board);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingAlgorithmSuite)
+
+BOOST_AUTO_TEST_CASE(BlocksOfGroupsMatchSerialSeeding) {
+  const SimSpacePointContainer spacePoints = makeSpacePoints(200);
+
+  for (bool seedConfirmation : {false, true}) {
+    BOOST_TEST_CONTEXT("seedConfirmation " << seedConfirmation) {
+      WhiteBoard board;
+      addToWhiteBoard("spacepoints", spacePoints, board);
+      const SimSeedContainer reference = findSeeds(board, seedConfirmation, 0);
+      BOOST_CHECK_GT(reference.size(), 0u);
+
+      for (std::size_t numGroupsPerTask : {1u, 2u, 5u, 1000u}) {
+        BOOST_TEST_CONTEXT("numGroupsPerTask " << numGroupsPerTask) {
+          const SimSeedContainer seeds =
+              findSeeds(board, seedConfirmation, numGroupsPerTask);
+          BOOST_REQUIRE_EQUAL(seeds.size(), reference.size());
+
+          for (std::size_t i = 0; i < seeds.size(); ++i) {
+            BOOST_TEST_CONTEXT("seed " << i) {
+              BOOST_CHECK_EQUAL(seeds[i].z(), reference[i].z());
+              BOOST_CHECK_EQUAL(seeds[i].seedQuality(),
+                                reference[i].seedQuality());
+              for (std::size_t j = 0; j < 3; ++j) {
+                BOOST_CHECK_EQUAL(seeds[i].sp()[j], reference[i].sp()[j]);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,292 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/ProxyAccessor.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/EventData/TrackStateType.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/TrackFinding/TrackFindingAlgorithm.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Acts::UnitLiterals;
+using namespace Acts::Test;
+using namespace ActsExamples;
+
+namespace {
+
+const Acts::GeometryContext geoCtx;
+const Acts::MagneticFieldContext magCtx;
+
+CylindricalTrackingGeometry cGeometry(geoCtx);
+const std::shared_ptr<const Acts::TrackingGeometry> geometry = cGeometry();
+const auto field =
+    std::make_shared<Acts::ConstantBField>(Acts::Vector3(0, 0, 2_T));
+
+/// Input of the track finding for a single event
+struct Event {
+  MeasurementContainer measurements;
+  IndexSourceLinkContainer sourceLinks;
+  std::vector<SimSpacePoint> spacePoints;
+  SimSeedContainer seeds;
+  TrackParametersContainer initialParameters;
+};
+
+/// Simulate particles in the pixel barrel and create overlapping seeds.
+///
+/// Every particle has two seeds which cover each other. In addition there is
+/// a seed made from the hits of one particle but with the parameters of
+/// another one, which finds the tracks of the other particle. Depending on
+/// the block size, the seeds which it covers are therefore skipped in a block
+/// although the serial processing finds tracks for them.
+std::unique_ptr<Event> makeEvent(std::size_t nParticles) {
+  using Propagator = Acts::Propagator<Acts::EigenStepper<>, Acts::Navigator>;
+  Propagator propagator(
+      Acts::EigenStepper<>(field),
+      Acts::Navigator({geometry, true, true, false},
+                      Acts::getDefaultLogger("Navigator", Acts::Logging::INFO)),
+      Acts::getDefaultLogger("Propagator", Acts::Logging::INFO));
+
+  const MeasurementResolutionMap resolutions = {
+      {Acts::GeometryIdentifier(),
+       MeasurementResolution{MeasurementType::eLoc01, {25_um, 100_um}}}};
+
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> thetaDist(M_PI / 2 - 0.4,
+                                                   M_PI / 2 + 0.4);
+  std::uniform_real_distribution<double> pDist(1_GeV, 10_GeV);
+
+  auto perigee =
+      Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3::Zero());
+  Acts::BoundSquareMatrix cov = Acts::BoundSquareMatrix::Zero();
+  cov.diagonal() << 1_mm * 1_mm, 1_mm * 1_mm, 0.01, 0.01,
+      0.01 / (1_GeV * 1_GeV), 1_ns * 1_ns;
+
+  auto event = std::make_unique<Event>();
+  std::vector<std::vector<std::size_t>> hits;
+  std::vector<Acts::BoundTrackParameters> starts;
+  for (std::size_t i = 0; i < nParticles; ++i) {
+    const double q = (i % 2 == 0) ? 1 : -1;
+    Acts::BoundVector parameters = Acts::BoundVector::Zero();
+    parameters[Acts::eBoundPhi] = phiDist(rng);
+    parameters[Acts::eBoundTheta] = thetaDist(rng);
+    parameters[Acts::eBoundQOverP] = q / pDist(rng);
+    Acts::BoundTrackParameters start(perigee, parameters, cov,
+                                     Acts::ParticleHypothesis::pion());
+
+    auto created = createMeasurements(propagator, geoCtx, magCtx, start,
+                                      resolutions, rng);
+    if (created.sourceLinks.size() < 4) {
+      continue;
+    }
+
+    auto& particleHits = hits.emplace_back();
+    for (const auto& testSourceLink : created.sourceLinks) {
+      const std::size_t index = event->measurements.size();
+      IndexSourceLink sourceLink(testSourceLink.m_geometryId, index);
+      event->measurements.emplaceMeasurement<2>(
+          Acts::SourceLink{sourceLink},
+          std::array{Acts::eBoundLoc0, Acts::eBoundLoc1},
+          testSourceLink.parameters, testSourceLink.covariance);
+      event->sourceLinks.insert(sourceLink);
+      particleHits.push_back(index);
+    }
+    starts.push_back(start);
+  }
+  BOOST_REQUIRE_GE(hits.size(), 4u);
+
+  // one space point per measurement, only their source links matter
+  event->spacePoints.reserve(event->measurements.size());
+  for (const auto& measurement : event->measurements) {
+    const IndexSourceLink& sourceLink =
+        measurement.sourceLink().get<IndexSourceLink>();
+    const Acts::Surface* surface =
+        geometry->findSurface(sourceLink.geometryId());
+    event->spacePoints.emplace_back(
+        surface->center(geoCtx), std::nullopt, 1., 1., std::nullopt,
+        boost::container::static_vector<Acts::SourceLink, 2>{
+            measurement.sourceLink()});
+  }
+
+  auto addSeed = [&](std::size_t hitsOf, std::size_t first,
+                     std::size_t parametersOf) {
+    const auto& particleHits = hits.at(hitsOf);
+    const auto& spacePoints = event->spacePoints;
+    event->seeds.emplace_back(spacePoints.at(particleHits.at(first)),
+                              spacePoints.at(particleHits.at(first + 1)),
+                              spacePoints.at(particleHits.at(first + 2)));
+    event->initialParameters.push_back(starts.at(parametersOf));
+  };
+
+  // the tracks of seed 0 cover seed 2, whose tracks cover seed 3
+  addSeed(0, 0, 0);
+  addSeed(2, 0, 2);
+  addSeed(0, 1, 1);
+  addSeed(1, 0, 1);
+  for (std::size_t i = 2; i < hits.size(); ++i) {
+    addSeed(i, 1, i);
+    addSeed(i, 0, i);
+  }
+
+  return event;
+}
+
+ConstTrackContainer findTracks(const Event& event,
+                               std::size_t numSeedsPerTask) {
+  TrackFindingAlgorithm::Config cfg;
+  cfg.inputMeasurements = "measurements";
+  cfg.inputSourceLinks = "sourcelinks";
+  cfg.inputInitialTrackParameters = "parameters";
+  cfg.inputSeeds = "seeds";
+  cfg.outputTracks = "tracks";
+  cfg.trackingGeometry = geometry;
+  cfg.magneticField = field;
+  auto logger = Acts::getDefaultLogger("TrackFinding", Acts::Logging::WARNING);
+  cfg.findTracks = TrackFindingAlgorithm::makeTrackFinderFunction(
+      geometry, field, *logger);
+  cfg.measurementSelectorCfg = {
+      {Acts::GeometryIdentifier(), {{}, {15.}, {2u}}}};
+  cfg.seedDeduplication = true;
+  cfg.numSeedsPerTask = numSeedsPerTask;
+  TrackFindingAlgorithm algorithm(cfg, Acts::Logging::WARNING);
+
+  WhiteBoard board;
+  addToWhiteBoard("measurements", event.measurements, board);
+  addToWhiteBoard("sourcelinks", event.sourceLinks, board);
+  addToWhiteBoard("parameters", event.initialParameters, board);
+  addToWhiteBoard("seeds", event.seeds, board);
+
+  BOOST_REQUIRE(algorithm.execute(AlgorithmContext(0, 0, board)) ==
+                ProcessCode::SUCCESS);
+  return getFromWhiteBoard<ConstTrackContainer>("tracks", board);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TrackFindingAlgorithmSuite)
+
+BOOST_AUTO_TEST_CASE(BlocksOfSeedsMatchSerialProcessing) {
+  const auto event = makeEvent(20);
+  const ConstTrackContainer reference = findTracks(*event, 0);
+  BOOST_CHECK_GT(reference.size(), 0u);
+  // the deduplication drops some of the seeds
+  BOOST_CHECK_LT(reference.size(), event->seeds.size());
+
+  Acts::ConstProxyAccessor<unsigned int> trackGroup("trackGroup");
+
+  for (std::size_t numSeedsPerTask : {1u, 2u, 3u, 4u, 7u, 100u}) {
+    BOOST_TEST_CONTEXT("numSeedsPerTask " << numSeedsPerTask) {
+      const ConstTrackContainer tracks = findTracks(*event, numSeedsPerTask);
+      BOOST_REQUIRE_EQUAL(tracks.size(), reference.size());
+
+      // the output holds exactly the track states of the serial processing,
+      // in the same order
+      const auto& states = tracks.trackStateContainer();
+      const auto& expectedStates = reference.trackStateContainer();
+      BOOST_REQUIRE_EQUAL(states.size(), expectedStates.size());
+      for (std::size_t i = 0; i < states.size(); ++i) {
+        const auto state = states.getTrackState(i);
+        const auto expected = expectedStates.getTrackState(i);
+        BOOST_TEST_CONTEXT("track state " << i) {
+          BOOST_CHECK_EQUAL(state.previous(), expected.previous());
+          BOOST_CHECK_EQUAL(state.getMask(), expected.getMask());
+          for (std::size_t flag = 0;
+               flag < Acts::TrackStateFlag::NumTrackStateFlags; ++flag) {
+            BOOST_CHECK_EQUAL(state.typeFlags().test(flag),
+                              expected.typeFlags().test(flag));
+          }
+          BOOST_CHECK_EQUAL(state.pathLength(), expected.pathLength());
+          BOOST_CHECK_EQUAL(state.chi2(), expected.chi2());
+          BOOST_CHECK_EQUAL(&state.referenceSurface(),
+                            &expected.referenceSurface());
+          if (expected.hasPredicted()) {
+            BOOST_CHECK_EQUAL(state.predicted(), expected.predicted());
+          }
+          if (expected.hasFiltered()) {
+            BOOST_CHECK_EQUAL(state.filtered(), expected.filtered());
+            BOOST_CHECK_EQUAL(state.filteredCovariance(),
+                              expected.filteredCovariance());
+          }
+          if (expected.hasSmoothed()) {
+            BOOST_CHECK_EQUAL(state.smoothed(), expected.smoothed());
+          }
+        }
+      }
+
+      for (std::size_t i = 0; i < tracks.size(); ++i) {
+        const auto track = tracks.getTrack(i);
+        const auto expected = reference.getTrack(i);
+        BOOST_TEST_CONTEXT("track " << i) {
+          BOOST_CHECK_EQUAL(track.tipIndex(), expected.tipIndex());
+          BOOST_CHECK_EQUAL(track.stemIndex(), expected.stemIndex());
+          BOOST_CHECK_EQUAL(trackGroup(track), trackGroup(expected));
+          BOOST_CHECK_EQUAL(track.nMeasurements(), expected.nMeasurements());
+          BOOST_CHECK_EQUAL(track.nHoles(), expected.nHoles());
+          BOOST_CHECK_EQUAL(track.nOutliers(), expected.nOutliers());
+          BOOST_CHECK_EQUAL(track.chi2(), expected.chi2());
+          BOOST_CHECK_EQUAL(track.parameters(), expected.parameters());
+          BOOST_CHECK_EQUAL(track.covariance(), expected.covariance());
+
+          std::vector<Index> measurements;
+          std::vector<Index> expectedMeasurements;
+          for (const auto& trackState : track.trackStatesReversed()) {
+            if (trackState.hasUncalibratedSourceLink()) {
+              measurements.push_back(trackState.getUncalibratedSourceLink()
+                                         .get<IndexSourceLink>()
+                                         .index());
+            }
+          }
+          for (const auto& trackState : expected.trackStatesReversed()) {
+            if (trackState.hasUncalibratedSourceLink()) {
+              expectedMeasurements.push_back(
+                  trackState.getUncalibratedSourceLink()
+                      .get<IndexSourceLink>()
+                      .index());
+            }
+          }
+          BOOST_CHECK_EQUAL_COLLECTIONS(
+              measurements.begin(), measurements.end(),
+              expectedMeasurements.begin(), expectedMeasurements.end());
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
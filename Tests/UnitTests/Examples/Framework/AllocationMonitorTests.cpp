@@ -0,0 +1,108 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AllocationMonitor.hpp"
+
+#include <cstddef>
+#include <new>
+
+using namespace ActsExamples;
+
+BOOST_AUTO_TEST_SUITE(FrameworkAllocationMonitor)
+
+// The checks are done after the monitors went out of scope, so that the
+// allocations of the test framework are not recorded
+
+BOOST_AUTO_TEST_CASE(AllocationMonitorCounts) {
+  BOOST_CHECK_EQUAL(AllocationMonitor::current(), nullptr);
+
+  AllocationMonitor::Result afterAllocation;
+  AllocationMonitor::Result afterDeallocation;
+  const AllocationMonitor* current = nullptr;
+  {
+    AllocationMonitor monitor;
+    current = AllocationMonitor::current();
+
+    // explicit calls of the allocation functions cannot be elided
+    void* a = ::operator new(100);
+    void* b = ::operator new[](1000);
+    void* c = ::operator new(256, std::align_val_t{64});
+    ::operator delete(a);
+    afterAllocation = monitor.result();
+
+    ::operator delete[](b);
+    ::operator delete(c, std::align_val_t{64});
+    afterDeallocation = monitor.result();
+  }
+  BOOST_CHECK_NE(current, nullptr);
+  BOOST_CHECK_EQUAL(AllocationMonitor::current(), nullptr);
+
+#if defined(ACTS_EXAMPLES_ALLOCATION_HOOKS)
+  BOOST_CHECK(AllocationMonitor::hooksInstalled());
+
+  BOOST_CHECK_EQUAL(afterAllocation.allocations, 3u);
+  BOOST_CHECK_EQUAL(afterAllocation.deallocations, 1u);
+  // the allocator may round up the sizes
+  BOOST_CHECK_GE(afterAllocation.allocatedBytes, 1356u);
+  BOOST_CHECK_GE(afterAllocation.peakBytes, 1356u);
+  BOOST_CHECK_LE(afterAllocation.peakBytes, afterAllocation.allocatedBytes);
+
+  BOOST_CHECK_EQUAL(afterDeallocation.allocations, 3u);
+  BOOST_CHECK_EQUAL(afterDeallocation.deallocations, 3u);
+  BOOST_CHECK_EQUAL(afterDeallocation.allocatedBytes,
+                    afterAllocation.allocatedBytes);
+  BOOST_CHECK_EQUAL(afterDeallocation.peakBytes, afterAllocation.peakBytes);
+#else
+  // without the hooks library nothing is recorded
+  BOOST_CHECK(!AllocationMonitor::hooksInstalled());
+
+  BOOST_CHECK_EQUAL(afterAllocation.allocations, 0u);
+  BOOST_CHECK_EQUAL(afterDeallocation.allocations, 0u);
+  BOOST_CHECK_EQUAL(afterDeallocation.deallocations, 0u);
+  BOOST_CHECK_EQUAL(afterDeallocation.allocatedBytes, 0u);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(AllocationMonitorNested) {
+  AllocationMonitor::Result outerResult;
+  AllocationMonitor::Result innerResult;
+  {
+    AllocationMonitor outer;
+    void* a = ::operator new(100);
+    {
+      // only the innermost monitor records
+      AllocationMonitor inner;
+      void* b = ::operator new(200);
+      ::operator delete(a);
+      ::operator delete(b);
+      innerResult = inner.result();
+    }
+    outerResult = outer.result();
+  }
+
+#if defined(ACTS_EXAMPLES_ALLOCATION_HOOKS)
+  BOOST_CHECK_EQUAL(outerResult.allocations, 1u);
+  BOOST_CHECK_EQUAL(outerResult.deallocations, 0u);
+  BOOST_CHECK_EQUAL(innerResult.allocations, 1u);
+  BOOST_CHECK_EQUAL(innerResult.deallocations, 2u);
+#else
+  BOOST_CHECK_EQUAL(outerResult.allocations, 0u);
+  BOOST_CHECK_EQUAL(innerResult.allocations, 0u);
+#endif
+
+  AllocationMonitor::Result merged = outerResult;
+  merged.merge(innerResult);
+  BOOST_CHECK_EQUAL(merged.allocations,
+                    outerResult.allocations + innerResult.allocations);
+  BOOST_CHECK_EQUAL(merged.deallocations,
+                    outerResult.deallocations + innerResult.deallocations);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,264 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/IAlgorithm.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace {
+
+/// What the algorithms did in every event
+struct Recorder {
+  struct Execution {
+    std::uint64_t start = 0;
+    std::uint64_t end = 0;
+    std::uint64_t value = 0;
+  };
+
+  std::mutex mutex;
+  std::atomic<std::uint64_t> tick = 0;
+  /// Executions by event and algorithm name
+  std::map<std::pair<std::size_t, std::string>, Execution> executions;
+
+  std::map<std::pair<std::size_t, std::string>, std::uint64_t> values() {
+    std::lock_guard lock(mutex);
+    std::map<std::pair<std::size_t, std::string>, std::uint64_t> result;
+    for (const auto& [key, execution] : executions) {
+      result[key] = execution.value;
+    }
+    return result;
+  }
+};
+
+/// Combines its inputs and the event number into its output
+class CombineAlgorithm final : public IAlgorithm {
+ public:
+  CombineAlgorithm(const std::string& name,
+                   const std::vector<std::string>& inputs,
+                   const std::string& output,
+                   std::shared_ptr<Recorder> recorder)
+      : IAlgorithm(name), m_recorder(std::move(recorder)) {
+    for (const auto& input : inputs) {
+      m_inputs.push_back(std::make_unique<ReadDataHandle<std::uint64_t>>(
+          this, "Input" + std::to_string(m_inputs.size())));
+      m_inputs.back()->initialize(input);
+    }
+    m_output.initialize(output);
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    Recorder::Execution execution;
+    execution.start = ++m_recorder->tick;
+
+    std::uint64_t value = ctx.eventNumber + 1;
+    for (const auto& input : m_inputs) {
+      value = value * 31 + (*input)(ctx.eventStore);
+    }
+    // give the other algorithms a chance to run in the meantime
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    m_output(ctx.eventStore, std::uint64_t{value});
+
+    execution.end = ++m_recorder->tick;
+    execution.value = value;
+    std::lock_guard lock(m_recorder->mutex);
+    m_recorder->executions[{ctx.eventNumber, name()}] = execution;
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::shared_ptr<Recorder> m_recorder;
+  std::vector<std::unique_ptr<ReadDataHandle<std::uint64_t>>> m_inputs;
+  WriteDataHandle<std::uint64_t> m_output{this, "Output"};
+};
+
+/// Checks keys on the white board without declaring data handles, like a
+/// Python algorithm which accesses the event store directly
+class StoreCheckAlgorithm final : public IAlgorithm {
+ public:
+  StoreCheckAlgorithm(const std::string& name, std::vector<std::string> keys,
+                      std::shared_ptr<Recorder> recorder)
+      : IAlgorithm(name),
+        m_keys(std::move(keys)),
+        m_recorder(std::move(recorder)) {}
+
+  ProcessCode execute(const AlgorithmContext& ctx) const override {
+    Recorder::Execution execution;
+    execution.start = ++m_recorder->tick;
+    for (const auto& key : m_keys) {
+      if (!ctx.eventStore.exists(key)) {
+        return ProcessCode::ABORT;
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    execution.end = ++m_recorder->tick;
+    std::lock_guard lock(m_recorder->mutex);
+    m_recorder->executions[{ctx.eventNumber, name()}] = execution;
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::vector<std::string> m_keys;
+  std::shared_ptr<Recorder> m_recorder;
+};
+
+/// Algorithm name, input keys and output key of the test sequence
+///
+/// The sequence is a diamond with an independent branch and an element
+/// which only depends on an element added much earlier.
+const std::vector<std::tuple<std::string, std::vector<std::string>,
+                             std::string>>
+    kSequence = {
+        {"Source", {}, "a"},
+        {"Left", {"a"}, "b"},
+        {"Right", {"a"}, "c"},
+        {"Independent", {}, "x"},
+        {"Join", {"b", "c"}, "d"},
+        {"Late", {"a", "x"}, "e"},
+        {"Sink", {"d", "e", "x"}, "f"},
+};
+
+std::shared_ptr<Recorder> runSequence(bool concurrentAlgorithms,
+                                      int numThreads, std::size_t events) {
+  Sequencer::Config cfg;
+  cfg.events = events;
+  cfg.numThreads = numThreads;
+  cfg.trackFpes = false;
+  cfg.concurrentAlgorithms = concurrentAlgorithms;
+  cfg.logLevel = Acts::Logging::WARNING;
+  Sequencer sequencer(cfg);
+
+  auto recorder = std::make_shared<Recorder>();
+  for (const auto& [name, inputs, output] : kSequence) {
+    sequencer.addAlgorithm(
+        std::make_shared<CombineAlgorithm>(name, inputs, output, recorder));
+  }
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+  return recorder;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(FrameworkSequencer)
+
+BOOST_AUTO_TEST_CASE(ConcurrentAlgorithmsRespectDependencies) {
+  const std::size_t events = 20;
+  auto recorder = runSequence(true, 4, events);
+
+  BOOST_CHECK_EQUAL(recorder->executions.size(), events * kSequence.size());
+
+  // every algorithm starts only after the producers of its inputs finished
+  std::map<std::string, std::string> producers;
+  for (const auto& [name, inputs, output] : kSequence) {
+    producers[output] = name;
+  }
+  for (std::size_t event = 0; event < events; ++event) {
+    for (const auto& [name, inputs, output] : kSequence) {
+      const auto& consumer = recorder->executions.at({event, name});
+      for (const auto& input : inputs) {
+        const auto& producer =
+            recorder->executions.at({event, producers.at(input)});
+        BOOST_CHECK_LT(producer.end, consumer.start);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentAlgorithmsAreDeterministic) {
+  const std::size_t events = 20;
+  auto reference = runSequence(false, 1, events)->values();
+  BOOST_CHECK_EQUAL(reference.size(), events * kSequence.size());
+
+  for (int numThreads : {1, 4}) {
+    BOOST_TEST_CONTEXT("numThreads " << numThreads) {
+      // the concurrent schedule must not change the results of any element
+      for (bool concurrent : {false, true}) {
+        BOOST_TEST_CONTEXT("concurrentAlgorithms " << concurrent) {
+          auto values = runSequence(concurrent, numThreads, events)->values();
+          BOOST_CHECK(values == reference);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentAlgorithmsOrderElementsWithoutHandles) {
+  const std::size_t events = 20;
+  Sequencer::Config cfg;
+  cfg.events = events;
+  cfg.numThreads = 4;
+  cfg.trackFpes = false;
+  cfg.concurrentAlgorithms = true;
+  cfg.logLevel = Acts::Logging::WARNING;
+  Sequencer sequencer(cfg);
+
+  // the check reads the outputs of all earlier elements without declaring
+  // them, and the elements after it do not depend on it through any data
+  auto recorder = std::make_shared<Recorder>();
+  const std::vector<std::string> before = {"Source", "Left", "Right"};
+  const std::vector<std::string> after = {"Independent", "Late"};
+  sequencer.addAlgorithm(std::make_shared<CombineAlgorithm>(
+      "Source", std::vector<std::string>{}, "a", recorder));
+  sequencer.addAlgorithm(std::make_shared<CombineAlgorithm>(
+      "Left", std::vector<std::string>{"a"}, "b", recorder));
+  sequencer.addAlgorithm(std::make_shared<CombineAlgorithm>(
+      "Right", std::vector<std::string>{}, "c", recorder));
+  sequencer.addAlgorithm(std::make_shared<StoreCheckAlgorithm>(
+      "Check", std::vector<std::string>{"a", "b", "c"}, recorder));
+  sequencer.addAlgorithm(std::make_shared<CombineAlgorithm>(
+      "Independent", std::vector<std::string>{}, "x", recorder));
+  sequencer.addAlgorithm(std::make_shared<CombineAlgorithm>(
+      "Late", std::vector<std::string>{"a"}, "e", recorder));
+  BOOST_REQUIRE_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+  BOOST_CHECK_EQUAL(recorder->executions.size(), events * 6);
+  for (std::size_t event = 0; event < events; ++event) {
+    const auto& check = recorder->executions.at({event, "Check"});
+    for (const auto& name : before) {
+      BOOST_CHECK_LT(recorder->executions.at({event, name}).end, check.start);
+    }
+    for (const auto& name : after) {
+      BOOST_CHECK_LT(check.end, recorder->executions.at({event, name}).start);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MissingProducerIsRejected) {
+  Sequencer::Config cfg;
+  cfg.events = 1;
+  cfg.numThreads = 1;
+  cfg.concurrentAlgorithms = true;
+  cfg.logLevel = Acts::Logging::FATAL;
+  Sequencer sequencer(cfg);
+
+  auto recorder = std::make_shared<Recorder>();
+  BOOST_CHECK_THROW(
+      sequencer.addAlgorithm(std::make_shared<CombineAlgorithm>(
+          "Orphan", std::vector<std::string>{"missing"}, "y", recorder)),
+      SequenceConfigurationException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,126 @@
+// This file is part of the ACTS project.
+//
+// Copyright (C) 2016 CERN for the benefit of the ACTS project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/Framework/DataHandle.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Acts::Test;
+using namespace ActsExamples;
+
+BOOST_AUTO_TEST_SUITE(FrameworkWhiteBoard)
+
+BOOST_AUTO_TEST_CASE(SlotRegistry) {
+  const std::size_t a = WhiteBoard::slot("registry_a");
+  const std::size_t b = WhiteBoard::slot("registry_b");
+
+  // the slot of a name is stable, different names have different slots
+  BOOST_CHECK_NE(a, b);
+  BOOST_CHECK_EQUAL(WhiteBoard::slot("registry_a"), a);
+  BOOST_CHECK_EQUAL(WhiteBoard::slot("registry_b"), b);
+
+  // a registered name does not create an object
+  WhiteBoard board;
+  BOOST_CHECK(!board.exists("registry_a"));
+  BOOST_CHECK(!board.exists("registry_unknown"));
+}
+
+BOOST_AUTO_TEST_CASE(AddAndGet) {
+  WhiteBoard board;
+  addToWhiteBoard("add_int", 42, board);
+  addToWhiteBoard("add_string", std::string("value"), board);
+
+  BOOST_CHECK(board.exists("add_int"));
+  BOOST_CHECK_EQUAL(getFromWhiteBoard<int>("add_int", board), 42);
+  BOOST_CHECK_EQUAL(getFromWhiteBoard<std::string>("add_string", board),
+                    "value");
+
+  // duplicate objects, missing objects and type mismatches are errors
+  BOOST_CHECK_THROW(addToWhiteBoard("add_int", 43, board),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(getFromWhiteBoard<int>("add_missing", board),
+                    std::out_of_range);
+  BOOST_CHECK_THROW(getFromWhiteBoard<double>("add_int", board),
+                    std::out_of_range);
+
+  // the same name in another white board is independent
+  WhiteBoard other;
+  BOOST_CHECK(!other.exists("add_int"));
+  addToWhiteBoard("add_int", 7, other);
+  BOOST_CHECK_EQUAL(getFromWhiteBoard<int>("add_int", other), 7);
+  BOOST_CHECK_EQUAL(getFromWhiteBoard<int>("add_int", board), 42);
+}
+
+BOOST_AUTO_TEST_CASE(AliasAndClear) {
+  WhiteBoard board(Acts::getDefaultLogger("WhiteBoard", Acts::Logging::INFO),
+                   {{"alias_original", "alias_name"}});
+  addToWhiteBoard("alias_original", 5, board);
+  BOOST_CHECK(board.exists("alias_name"));
+  BOOST_CHECK_EQUAL(getFromWhiteBoard<int>("alias_name", board), 5);
+
+  // a cleared white board can be reused
+  board.clear();
+  BOOST_CHECK(!board.exists("alias_original"));
+  BOOST_CHECK(!board.exists("alias_name"));
+  addToWhiteBoard("alias_original", 6, board);
+  BOOST_CHECK_EQUAL(getFromWhiteBoard<int>("alias_name", board), 6);
+}
+
+BOOST_AUTO_TEST_CASE(GrowConcurrently) {
+  WhiteBoard board;
+
+  // the names are registered after the white board was created, so that it
+  // has to grow while the other threads access it
+  const std::size_t nThreads = 4;
+  const std::size_t nObjects = 500;
+  auto objectName = [](std::size_t thread, std::size_t i) {
+    return "grow_" + std::to_string(thread) + "_" + std::to_string(i);
+  };
+
+  std::vector<std::thread> threads;
+  std::vector<std::size_t> nCorrect(nThreads, 0);
+  for (std::size_t t = 0; t < nThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      DummySequenceElement element;
+      for (std::size_t i = 0; i < nObjects; ++i) {
+        WriteDataHandle<std::size_t> writeHandle(&element, "write");
+        writeHandle.initialize(objectName(t, i));
+        writeHandle(board, t * nObjects + i);
+
+        ReadDataHandle<std::size_t> readHandle(&element, "read");
+        readHandle.initialize(objectName(t, i / 2));
+        if (readHandle(board) == t * nObjects + i / 2) {
+          ++nCorrect[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (std::size_t t = 0; t < nThreads; ++t) {
+    BOOST_CHECK_EQUAL(nCorrect[t], nObjects);
+    for (std::size_t i = 0; i < nObjects; ++i) {
+      BOOST_CHECK_EQUAL(getFromWhiteBoard<std::size_t>(objectName(t, i), board),
+                        t * nObjects + i);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()